@@ -2,7 +2,8 @@
 
 // Sky gradient: t = dir.y*0.5+0.5, mix(bottom, top, t). 3 paradas: bottom, horizon, top.
 
-in vec3 rayDir;
+in vec4 nearPoint;
+in vec4 farPoint;
 
 out vec4 finalColor;
 
@@ -11,6 +12,7 @@ uniform vec3 skyHorizon;
 uniform vec3 skyTop;
 
 void main() {
+    vec3 rayDir = normalize(farPoint.xyz / farPoint.w - nearPoint.xyz / nearPoint.w);
     float t = clamp(rayDir.y * 0.5 + 0.5, 0.0, 1.0);
     vec3 sky;
     if (t < 0.5) {
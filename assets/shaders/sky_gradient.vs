@@ -1,7 +1,7 @@
 #version 330
 
-// Sky gradient por direção do raio: não usa depth. Esfera centrada na câmera.
-// rayDir = normal do vértice (direção do centro para o fragmento).
+// Sky gradient em triângulo de tela cheia: 3 vértices já em NDC, (-1,-1) (3,-1) (-1,3).
+// A direção do raio sai da inversa da view-projection (near e far do pixel); mvp não é usado.
 // vertexTexCoord/vertexColor existem para compatibilidade com o batch raylib.
 
 in vec3 vertexPosition;
@@ -9,11 +9,15 @@ in vec2 vertexTexCoord;
 in vec3 vertexNormal;
 in vec4 vertexColor;
 
-out vec3 rayDir;
+// Pontos homogêneos no near e no far: lineares na tela, divididos por w no fragment
+out vec4 nearPoint;
+out vec4 farPoint;
 
-uniform mat4 mvp;
+uniform mat4 invViewProj;
 
 void main() {
-    rayDir = normalize(vertexPosition);
-    gl_Position = mvp * vec4(vertexPosition, 1.0);
+    vec2 ndc = vertexPosition.xy;
+    nearPoint = invViewProj * vec4(ndc, -1.0, 1.0);
+    farPoint = invViewProj * vec4(ndc, 1.0, 1.0);
+    gl_Position = vec4(ndc, 0.0, 1.0);
 }
@@ -0,0 +1,42 @@
+#version 330
+
+// Voxel com vértice compactado (8 bytes, ver VoxelVertex em voxel_mesh.h).
+// Decodifica posição local + origem do chunk e cor pela paleta (a normal é a face).
+// Saídas iguais às de fog_forward.vs: usar com fog_forward.fs.
+
+layout(location = 0) in vec4 vertexPacked;  // x, z, face, blockType (u8)
+layout(location = 1) in float vertexHeight; // y (u16)
+layout(location = 2) in float vertexLight;  // luz da face x AO, assada no mesh (0..255)
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+out float viewPosZ;
+out float viewPosY;
+
+uniform mat4 mvp;
+uniform mat4 matView;
+uniform vec3 chunkOrigin;        // Canto mínimo do chunk em blocos (y = 0)
+uniform vec4 blockColors[16];    // VOXEL_MESH_PALETTE_SIZE
+uniform float faceOffset;        // Desloca pela normal da face (wireframe de debug; 0 = sem deslocamento)
+
+const vec3 faceNormals[6] = vec3[6](  // FaceDirection
+    vec3(-1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0),
+    vec3(0.0, -1.0, 0.0), vec3(0.0, 1.0, 0.0),
+    vec3(0.0, 0.0, -1.0), vec3(0.0, 0.0, 1.0)
+);
+
+void main() {
+    int face = int(vertexPacked.z) % 6;
+    vec3 position = chunkOrigin + vec3(vertexPacked.x, vertexHeight, vertexPacked.y) + faceNormals[face] * faceOffset;
+    int blockType = int(vertexPacked.w) & 15;   // luz da face já assada em vertexLight
+
+    fragTexCoord = vec2(0.0);
+    vec4 color = blockColors[blockType];
+    fragColor = vec4(color.rgb * (vertexLight / 255.0), color.a);
+
+    vec4 viewPos = matView * vec4(position, 1.0);
+    viewPosZ = viewPos.z;
+    viewPosY = viewPos.y;
+
+    gl_Position = mvp * vec4(position, 1.0);
+}
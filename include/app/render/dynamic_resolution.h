@@ -0,0 +1,57 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ============================================================================
+// DYNAMIC RESOLUTION - escala da cena 3D guiada pelo tempo de frame
+// ============================================================================
+// Controlador puro (sem GL): recebe o tempo de cada frame e devolve a escala
+// da resolução da cena. Desce quando a média passa do orçamento por alguns
+// frames seguidos; sobe só depois de um período estável. Entre os dois
+// limiares nada muda (histerese), e cada troca tem um tempo de espera.
+// Com o FPS travado (SetTargetFPS/vsync) o frame nunca fica abaixo do
+// orçamento: a subida é uma sonda. Se a sonda estoura o orçamento, a escala
+// volta e a próxima sonda espera o dobro.
+// ============================================================================
+
+#define DYNRES_MIN_SCALE 0.5f
+#define DYNRES_MAX_SCALE 1.0f
+#define DYNRES_STEP 0.0625f             // 1/16 da resolução nativa por troca
+#define DYNRES_SMOOTHING 0.1f           // Peso do frame novo na média móvel
+#define DYNRES_OVER_BUDGET 1.10f        // Média acima de orçamento * isto: frame estourado
+#define DYNRES_AT_BUDGET 1.03f          // Média até orçamento * isto: estável (travado no FPS)
+#define DYNRES_UNDER_BUDGET 0.85f       // Média abaixo de orçamento * isto: sobra (sem trava)
+#define DYNRES_OVER_FRAMES 8            // Frames estourados seguidos para descer
+#define DYNRES_COOLDOWN_FRAMES 30       // Frames sem trocar depois de uma troca
+#define DYNRES_PROBE_FRAMES 120         // Frames estáveis antes de sondar uma subida
+#define DYNRES_MAX_PROBE_FRAMES 1920
+#define DYNRES_MAX_FRAME_TIME 0.25f     // Frames mais longos (carga, janela arrastada) são ignorados
+
+typedef struct {
+    float scale;                // Escala atual (DYNRES_MIN_SCALE..DYNRES_MAX_SCALE)
+    float targetFrameTime;      // Orçamento em segundos
+    float averageFrameTime;     // Média móvel (0 = sem amostra)
+    int32_t overFrames;
+    int32_t stableFrames;
+    int32_t cooldown;
+    int32_t probeFrames;        // Espera atual da sonda (dobra a cada sonda falha)
+    bool probing;               // Última troca foi uma subida ainda não confirmada
+    bool enabled;               // false: escala fica em DYNRES_MAX_SCALE
+} DynamicResolution;
+
+void DynamicResolution_Init(DynamicResolution* dr, float targetFrameTime);
+
+// Alimenta o tempo do último frame (segundos). Retorna true se a escala mudou.
+bool DynamicResolution_Update(DynamicResolution* dr, float frameTime);
+
+void DynamicResolution_SetEnabled(DynamicResolution* dr, bool enabled);
+
+// Tamanho escalado de uma dimensão nativa (mínimo 1)
+static inline int32_t DynamicResolution_Scale(const DynamicResolution* dr, int32_t size) {
+    int32_t scaled = (int32_t)((float)size * dr->scale + 0.5f);
+    return scaled > 1 ? scaled : 1;
+}
+
+#endif // DYNAMIC_RESOLUTION_H
@@ -3,6 +3,7 @@
 
 #include "core/math/core_math.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // FRUSTUM CULLING
@@ -41,6 +42,12 @@ void Frustum_Calculate(Frustum* frustum,
                        Vec3 camPos, Vec3 camForward, Vec3 camUp,
                        float fovY, float aspect, float near, float far);
 
+// Mesmo cálculo sem o clamp de 15m: far é a distância de renderização de quem chama
+// (culling de chunks inteiros do VoxelRenderer)
+void Frustum_CalculateUnclamped(Frustum* frustum,
+                                Vec3 camPos, Vec3 camForward, Vec3 camUp,
+                                float fovY, float aspect, float near, float far);
+
 // ============================================================================
 // TESTES DE CULLING
 // ============================================================================
@@ -67,4 +74,68 @@ float Frustum_DistSqToCamera(const Frustum* frustum, Vec3 point);
 // Retorna true se chunk deve ser renderizado
 bool Frustum_ShouldRenderChunk(const Frustum* frustum, Vec3 chunkCenter, Vec3 chunkMin, Vec3 chunkMax);
 
+// ============================================================================
+// CULLING EM LOTE (SoA)
+// ============================================================================
+// Caixas em estrutura de arrays: cada eixo num array próprio, para testar 4 (SSE)
+// ou 8 (AVX) caixas por instrução contra cada plano. O caminho é escolhido na
+// compilação: AVX com -mavx, SSE em qualquer x86-64, escalar no resto.
+// Resultado em máscara de bits: caixa i -> bit (i % 32) da palavra i / 32.
+// ============================================================================
+
+// Palavras de máscara para `count` caixas
+#define FRUSTUM_MASK_WORDS(count) (((count) + 31) / 32)
+
+typedef struct {
+    float* minX;
+    float* minY;
+    float* minZ;
+    float* maxX;
+    float* maxY;
+    float* maxZ;
+    int32_t count;
+    int32_t capacity;   // Múltiplo de 8: o último grupo SIMD lê sem passar do fim
+} FrustumAABBBatch;
+
+// Reserva espaço para `capacity` caixas (um bloco só). false sem memória.
+bool FrustumAABBBatch_Init(FrustumAABBBatch* batch, int32_t capacity);
+void FrustumAABBBatch_Destroy(FrustumAABBBatch* batch);
+
+// Esvazia o lote (mantém a memória)
+static inline void FrustumAABBBatch_Clear(FrustumAABBBatch* batch) {
+    batch->count = 0;
+}
+
+// Acrescenta uma caixa; retorna o índice ou -1 com o lote cheio
+static inline int32_t FrustumAABBBatch_Push(FrustumAABBBatch* batch, Vec3 min, Vec3 max) {
+    if (batch->count >= batch->capacity) return -1;
+    int32_t i = batch->count++;
+    batch->minX[i] = min.x;
+    batch->minY[i] = min.y;
+    batch->minZ[i] = min.z;
+    batch->maxX[i] = max.x;
+    batch->maxY[i] = max.y;
+    batch->maxZ[i] = max.z;
+    return i;
+}
+
+static inline bool Frustum_MaskTest(const uint32_t* mask, int32_t index) {
+    return (mask[index >> 5] >> (index & 31)) & 1u;
+}
+
+// Testa todas as caixas do lote. visibleMask recebe o mesmo resultado de
+// Frustum_IsAABBInside por caixa; insideMask (opcional) marca as caixas inteiramente
+// dentro dos 6 planos, cujos filhos dispensam teste (culling hierárquico: colunas
+// primeiro, seções só das colunas que cruzam uma borda). Retorna quantas são visíveis.
+// As máscaras precisam de FRUSTUM_MASK_WORDS(batch->count) palavras.
+int32_t Frustum_CullAABBBatch(const Frustum* frustum, const FrustumAABBBatch* batch,
+                              uint32_t* visibleMask, uint32_t* insideMask);
+
+// Mesmo teste sempre escalar (referência e benchmark)
+int32_t Frustum_CullAABBBatchScalar(const Frustum* frustum, const FrustumAABBBatch* batch,
+                                    uint32_t* visibleMask, uint32_t* insideMask);
+
+// Caminho compilado em Frustum_CullAABBBatch: "AVX", "SSE" ou "escalar"
+const char* Frustum_BatchPathName(void);
+
 #endif // FRUSTUM_H
@@ -3,6 +3,7 @@
 
 #include <raylib.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // LIGHTING - Iluminação Direcional Fake
@@ -22,16 +23,20 @@ typedef struct {
 
 typedef struct {
     DirectionalLight sunLight;
+    uint32_t version;           // Sobe só quando a luz muda de fato (quem assa luz compara)
     bool initialized;
 } LightingSystem;
 
+// Faces na ordem -X, +X, -Y, +Y, -Z, +Z (mesma de FaceDirection)
+#define LIGHTING_FACE_COUNT 6
+
 // Inicializa sistema de iluminação com valores padrão
 void Lighting_Init(LightingSystem* lighting);
 
 // Limpa recursos do sistema de iluminação
 void Lighting_Shutdown(LightingSystem* lighting);
 
-// Configura luz direcional (sol)
+// Configura luz direcional (sol). Valores iguais aos atuais não mudam a versão.
 void Lighting_SetDirectionalLight(LightingSystem* lighting, 
                                    Vector3 direction, Color lightColor, 
                                    Color ambientColor, float intensity, float ambientIntensity);
@@ -43,6 +48,11 @@ void Lighting_SetDirectionalLight(LightingSystem* lighting,
 Color Lighting_ApplyDirectionalLight(LightingSystem* lighting, 
                                      Vector3 normal, Color baseColor);
 
+// Fator de luz (0..255, 255 = cor cheia) das 6 faces alinhadas aos eixos: o mesmo
+// de Lighting_ApplyDirectionalLight, para assar em vértices ou tabelas de cor.
+// Retorna a versão da luz usada.
+uint32_t Lighting_GetFaceLight(LightingSystem* lighting, uint8_t faceLight[LIGHTING_FACE_COUNT]);
+
 // Obtém a direção da luz atual
 Vector3 Lighting_GetLightDirection(LightingSystem* lighting);
 
@@ -0,0 +1,74 @@
+#ifndef OCCLUSION_CULLER_H
+#define OCCLUSION_CULLER_H
+
+#include "core/math/core_math.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// ============================================================================
+// OCCLUSION CULLER — culling por profundidade em CPU (hierarchical-Z)
+// ============================================================================
+// Rasteriza poucos oclusores grandes (faces do greedy meshing) num buffer de
+// profundidade de baixa resolução, monta a pirâmide de mínimos e testa caixas
+// contra ela. Tudo em CPU: não depende de GL (funciona com GL por software).
+// Profundidade guardada como 1/z de vista (linear na tela; 0 = nada desenhado).
+// O teste é conservador: caixa cruzando o near, fora da tela ou sobre qualquer
+// texel sem oclusor conta como visível.
+// ============================================================================
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+#define OCCLUSION_MIP_COUNT 8         // 256x128 até 2x1
+
+// Folga (blocos) entre o oclusor mais distante e a caixa: erro de ponto flutuante
+// na interpolação não esconde a caixa que contém o próprio oclusor
+#define OCCLUSION_DEPTH_BIAS 0.25f
+
+// Câmera do buffer (mesma do frustum do frame)
+typedef struct {
+    Vec3 position;
+    Vec3 forward;     // Normalizado
+    Vec3 up;
+    float fovY;       // Radianos
+    float aspect;     // Largura / altura
+    float nearPlane;
+} OcclusionView;
+
+typedef struct {
+    float* levels[OCCLUSION_MIP_COUNT];   // levels[0] = buffer rasterizado; depois mínimos 2x2
+    int32_t widths[OCCLUSION_MIP_COUNT];
+    int32_t heights[OCCLUSION_MIP_COUNT];
+    // Câmera do frame (Begin)
+    Vec3 position;
+    Vec3 forward;
+    Vec3 right;
+    Vec3 up;
+    float scaleX;     // 1 / tan(meia abertura horizontal)
+    float scaleY;
+    float nearPlane;
+    bool pyramidReady;
+    // Contadores desde o último Begin
+    int32_t occluderQuads;
+    int32_t trianglesRasterized;
+    int32_t boxesTested;
+    int32_t boxesOccluded;
+} OcclusionCuller;
+
+// Aloca o buffer e a pirâmide. false sem memória.
+bool OcclusionCuller_Init(OcclusionCuller* culler);
+void OcclusionCuller_Destroy(OcclusionCuller* culler);
+
+// Limpa o buffer e fixa a câmera do frame
+void OcclusionCuller_Begin(OcclusionCuller* culler, const OcclusionView* view);
+
+// Rasteriza um quad oclusor (4 cantos em ordem ao redor do quad, coordenadas do
+// mundo). Só superfícies opacas de verdade: tudo atrás delas passa a ser escondido.
+void OcclusionCuller_AddQuad(OcclusionCuller* culler, const Vec3 corners[4]);
+
+// Monta a pirâmide de mínimos; chamar depois dos oclusores e antes dos testes
+void OcclusionCuller_BuildPyramid(OcclusionCuller* culler);
+
+// true se alguma parte da caixa pode aparecer na frente dos oclusores
+bool OcclusionCuller_IsAABBVisible(OcclusionCuller* culler, Vec3 min, Vec3 max);
+
+#endif // OCCLUSION_CULLER_H
@@ -0,0 +1,117 @@
+#ifndef RENDER_MATERIAL_H
+#define RENDER_MATERIAL_H
+
+#include <raylib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// ============================================================================
+// RENDER MATERIAL - Shader, locations de uniforms e cache de valores enviados
+// ============================================================================
+// O material guarda o shader, a location de cada uniform e o último valor
+// enviado: Set com o mesmo valor não chega ao GL. Blocos de uniforms (câmera,
+// fog) são compartilhados entre shaders: o bloco guarda os valores e uma
+// versão; cada material ligado guarda a versão já sincronizada e, no Apply,
+// envia só os campos que mudaram desde então.
+// O rlgl não tem API de uniform buffer: o bloco é emulado na CPU com uniforms
+// soltos de mesmo nome em cada shader (campo ausente no shader é ignorado).
+// ============================================================================
+
+#define MATERIAL_MAX_UNIFORMS 16
+#define MATERIAL_MAX_BLOCKS 4
+#define UNIFORM_BLOCK_MAX_FIELDS 16
+#define MATERIAL_UNIFORM_MAX_BYTES 64     // mat4
+
+typedef enum {
+    MATERIAL_UNIFORM_FLOAT = 0,
+    MATERIAL_UNIFORM_VEC2,
+    MATERIAL_UNIFORM_VEC3,
+    MATERIAL_UNIFORM_VEC4,
+    MATERIAL_UNIFORM_INT,
+    MATERIAL_UNIFORM_MATRIX               // Matrix do raylib (SetShaderValueMatrix)
+} MaterialUniformType;
+
+typedef struct {
+    const char* name;                     // Nome no GLSL (string estática)
+    MaterialUniformType type;
+    uint32_t version;                     // Versão do bloco na última mudança deste campo
+    unsigned char value[MATERIAL_UNIFORM_MAX_BYTES];
+} UniformBlockField;
+
+// Valores compartilhados por vários materiais
+typedef struct {
+    UniformBlockField fields[UNIFORM_BLOCK_MAX_FIELDS];
+    int32_t fieldCount;
+    uint32_t version;                     // Sobe só quando algum campo muda de fato
+} UniformBlock;
+
+typedef struct {
+    int loc;
+    MaterialUniformType type;
+    bool cached;                          // value tem o que foi enviado
+    unsigned char value[MATERIAL_UNIFORM_MAX_BYTES];
+} RenderMaterialUniform;
+
+typedef struct {
+    const UniformBlock* block;
+    uint32_t syncedVersion;               // 0 = nunca sincronizado
+    int locs[UNIFORM_BLOCK_MAX_FIELDS];   // -1 = campo ausente no shader
+} RenderMaterialBlockBinding;
+
+typedef struct {
+    Shader shader;
+    bool ownsShader;                      // Unload descarrega o shader
+    RenderMaterialUniform uniforms[MATERIAL_MAX_UNIFORMS];
+    int32_t uniformCount;
+    RenderMaterialBlockBinding blocks[MATERIAL_MAX_BLOCKS];
+    int32_t blockCount;
+    // Contadores desde o último RenderMaterial_ResetStats
+    int32_t uploads;                      // Valores enviados ao GL
+    int32_t skipped;                      // Sets e campos de bloco iguais ao cache
+} RenderMaterial;
+
+// ——— Blocos ———
+
+void UniformBlock_Init(UniformBlock* block);
+
+// Declara um campo; retorna o índice ou -1 com o bloco cheio
+int32_t UniformBlock_AddField(UniformBlock* block, const char* name, MaterialUniformType type);
+
+// Copia o valor (tamanho do tipo do campo); valor igual não muda a versão
+void UniformBlock_Set(UniformBlock* block, int32_t field, const void* value);
+void UniformBlock_SetFloat(UniformBlock* block, int32_t field, float value);
+void UniformBlock_SetInt(UniformBlock* block, int32_t field, int value);
+void UniformBlock_SetColor(UniformBlock* block, int32_t field, Color color);   // vec3 em 0..1
+
+// ——— Materiais ———
+
+// Carrega o shader (o material passa a ser dono). false se o shader não compilou.
+bool RenderMaterial_Load(RenderMaterial* material, const char* vsPath, const char* fsPath);
+
+// Envolve um shader de outro dono (ex. o do VoxelRenderer); Unload não o descarrega
+void RenderMaterial_InitFromShader(RenderMaterial* material, Shader shader);
+
+void RenderMaterial_Unload(RenderMaterial* material);
+
+static inline bool RenderMaterial_IsReady(const RenderMaterial* material) {
+    return material && material->shader.id != 0;
+}
+
+// Uniform próprio do material; retorna o índice ou -1 (ausente no shader ou tabela cheia)
+int32_t RenderMaterial_AddUniform(RenderMaterial* material, const char* name, MaterialUniformType type);
+
+// Envia só se o valor diferir do último enviado. Índice -1 é ignorado.
+// Como SetShaderValue: se o shader estiver ativo com vértices no batch, descarregar antes.
+void RenderMaterial_SetUniform(RenderMaterial* material, int32_t uniform, const void* value);
+void RenderMaterial_SetColor(RenderMaterial* material, int32_t uniform, Color color);      // vec3 em 0..1
+
+// Liga um bloco (resolve a location de cada campo pelo nome; declarar os campos antes).
+// false com a tabela cheia.
+bool RenderMaterial_BindBlock(RenderMaterial* material, const UniformBlock* block);
+
+// Sincroniza os blocos ligados: envia os campos alterados desde o último Apply
+void RenderMaterial_Apply(RenderMaterial* material);
+
+void RenderMaterial_ResetStats(RenderMaterial* material);
+
+#endif // RENDER_MATERIAL_H
@@ -0,0 +1,85 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <raylib.h>
+
+// ============================================================================
+// RENDER QUEUE — fila de draws ordenada por chave de 64 bits
+// ============================================================================
+// A cena grava comandos (callback + dados) com uma chave; Submit ordena e executa,
+// trocando shader/estado e descarregando o batch do rlgl só na fronteira entre
+// grupos. Chave, do bit mais alto para o mais baixo:
+//   passe (4) | shader (8) | estado (8) | profundidade (24) | ordem de gravação (20)
+// No passe translúcido a profundidade é invertida (de trás para frente); nos
+// outros, perto primeiro. A ordem de gravação desempata (sort estável).
+// ============================================================================
+
+typedef enum {
+    RENDER_PASS_SKY = 0,        // Fundo: sem escrita de profundidade
+    RENDER_PASS_OPAQUE,
+    RENDER_PASS_TRANSLUCENT,
+    RENDER_PASS_DEBUG,          // Wireframe e caixas de debug, por cima do resto
+    RENDER_PASS_COUNT
+} RenderPass;
+
+// Estado fixo do grupo (bits do campo estado; 0 = padrão do rlgl)
+#define RENDER_STATE_NO_CULL        0x01    // Sem backface culling
+#define RENDER_STATE_NO_DEPTH_WRITE 0x02    // Testa, mas não escreve profundidade
+#define RENDER_STATE_NO_DEPTH_TEST  0x04
+#define RENDER_STATE_WIREFRAME      0x08    // Polígonos em modo de linhas
+
+#define RENDER_QUEUE_MAX_COMMANDS 256
+#define RENDER_QUEUE_MAX_SHADERS 16         // Slot 0 = shader padrão do rlgl
+#define RENDER_QUEUE_MAX_DEPTH 4096.0f      // Profundidade (m) saturada na chave
+
+// Executa o draw. Retorna quantos draws diretos (fora do batch do rlgl, ex. VAOs
+// dos chunks) o comando emitiu; draws pelo batch contam nas descargas da fila.
+// Um comando que muda uniforms do shader do grupo deve descarregar o batch antes.
+typedef int32_t (*RenderCommandFn)(void* userData);
+
+typedef struct {
+    uint64_t key;
+    RenderCommandFn draw;
+    void* userData;
+} RenderCommand;
+
+// Contadores do último Submit
+typedef struct {
+    int32_t commands;       // Comandos executados
+    int32_t drawCalls;      // Descargas do batch + draws diretos dos comandos
+    int32_t stateChanges;   // Trocas de estado (culling/profundidade/wireframe)
+    int32_t shaderChanges;
+    int32_t flushes;        // Descargas do batch forçadas pela fila (só com vértices pendentes)
+} RenderQueueStats;
+
+typedef struct {
+    RenderCommand commands[RENDER_QUEUE_MAX_COMMANDS];
+    int32_t count;
+    uint32_t sequence;
+    Shader shaders[RENDER_QUEUE_MAX_SHADERS];
+    int32_t shaderCount;
+    RenderQueueStats stats;
+} RenderQueue;
+
+void RenderQueue_Init(RenderQueue* queue);
+
+// Slot do shader na chave (o mesmo id devolve o mesmo slot). 0 para id 0 ou tabela cheia
+// (cai no shader padrão).
+uint8_t RenderQueue_RegisterShader(RenderQueue* queue, Shader shader);
+
+// Começa um frame (esvazia a fila)
+void RenderQueue_Begin(RenderQueue* queue);
+
+// Monta a chave; `depth` em metros da câmera
+uint64_t RenderQueue_MakeKey(RenderPass pass, uint8_t shaderSlot, uint8_t state, float depth);
+
+// Grava um comando; false com a fila cheia (o comando é descartado)
+bool RenderQueue_Push(RenderQueue* queue, uint64_t key, RenderCommandFn draw, void* userData);
+
+// Ordena e executa. Chamar entre BeginMode3D/EndMode3D (ou no modo em que os comandos
+// desenham). Deixa shader e estado no padrão.
+void RenderQueue_Submit(RenderQueue* queue);
+
+#endif // RENDER_QUEUE_H
@@ -4,16 +4,23 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <raylib.h>
+#include "core/world/chunk.h"
 
 // Forward declarations
-typedef struct VoxelWorld VoxelWorld;
 typedef struct Camera3D Camera3D;
 
-// Vértice de um triângulo
+// Vértice compactado (8 bytes). Posição relativa à origem do chunk (VoxelMesh.originX/Z),
+// normal implícita pela face e cor pela paleta de blocos. Os quads do greedy meshing
+// terminam em 16 (x/z) e 256 (y), por isso y é u16.
+// Layout casado com assets/shaders/voxel_packed.vs.
 typedef struct {
-    Vector3 position;
-    Vector3 normal;
-    Color color;
+    uint8_t x;          // 0..16
+    uint8_t z;          // 0..16
+    uint8_t face;       // FaceDirection (3 bits)
+    uint8_t blockType;  // Índice na paleta de cores
+    uint16_t y;         // 0..256
+    uint8_t light;      // Luz assada: luz da face x AO (0..255, 255 = luz cheia)
+    uint8_t ao;         // Oclusão do canto 0..3 (3 = aberto); guardada para reiluminar sem remesh
 } VoxelVertex;
 
 // Face de um bloco (2 triângulos)
@@ -32,29 +39,191 @@ typedef enum {
     FACE_POSITIVE_Z = 5   // Face frontal (+Z)
 } FaceDirection;
 
-// Sistema de mesh para voxels
+// Estatísticas do último VoxelMesh_GenerateChunk
+typedef struct {
+    int32_t solidBlocks;        // Blocos não-ar no chunk
+    int32_t naiveVertexCount;   // 36 por bloco (todas as faces, sem culling)
+    int32_t visibleFaces;       // Faces expostas após o culling, antes da fusão
+    int32_t quadCount;          // Retângulos após o greedy meshing
+    int32_t vertexCount;        // Vértices emitidos (4 por quad; índices no buffer compartilhado)
+    int32_t translucentQuads;   // Quads no sub-mesh translúcido (cor com alpha < 255)
+} VoxelMeshStats;
+
+// Face opaca grande do greedy, guardada como oclusor do culling em CPU (retângulo
+// alinhado aos eixos em blocos relativos à origem do chunk; um eixo tem min == max)
+typedef struct {
+    uint8_t minX, minZ, maxX, maxZ;
+    uint16_t minY, maxY;
+} VoxelOccluderQuad;
+
+// Oclusores por mesh (as maiores faces; só meshes de voxel completo, sem LOD)
+#define VOXEL_MESH_MAX_OCCLUDERS 8
+// Área mínima (blocos²) para uma face entrar como oclusor
+#define VOXEL_MESH_OCCLUDER_MIN_AREA 16
+
+// Sistema de mesh para voxels (um chunk por mesh: as posições são relativas à origem).
+// Dois sub-meshes no mesmo buffer: opacos em [0, opaqueVertexCount) e translúcidos no
+// resto, desenhados depois, de trás para frente, sem escrever profundidade.
 typedef struct {
     VoxelVertex* vertices;
     int32_t vertexCount;
+    int32_t opaqueVertexCount;
     int32_t vertexCapacity;
     bool initialized;
+    int32_t originX;            // Canto mínimo do chunk em blocos (chunkX * CHUNK_SIZE_X)
+    int32_t originZ;
+    int32_t minY;               // Faixa Y das seções com blocos [minY, maxY) (culling do chunk)
+    int32_t maxY;
+    uint16_t sectionMask;       // Bit s: seção s com blocos (caixas do culling por seção)
+    VoxelOccluderQuad occluders[VOXEL_MESH_MAX_OCCLUDERS];
+    int32_t occluderCount;
+    VoxelMeshStats chunkStats;
+    // GPU (rlgl): VAO/VBO com os vértices compactados
+    unsigned int vaoId;
+    unsigned int vboId;
+    int32_t gpuVertexCapacity;  // Vértices que cabem no VBO atual
+    int32_t gpuVertexCount;     // Vértices enviados no último upload
+    // Ordem dos quads translúcidos: válida para a câmera em sortCamera (coordenadas do mundo)
+    bool translucentSorted;
+    Vector3 sortCamera;
 } VoxelMesh;
 
+// Câmera que anda menos que isto (blocos) não reordena os quads translúcidos do chunk
+#define VOXEL_MESH_SORT_THRESHOLD 1.0f
+
+// Entradas da paleta blockColors[] em voxel_packed.vs
+#define VOXEL_MESH_PALETTE_SIZE 16
+
+// Shader do formato compactado (locations resolvidas em VoxelMesh_InitShader)
+typedef struct {
+    unsigned int shaderId;      // Shader de voxel_packed.vs (0 = sem GPU: DrawTriangle3D)
+    int locMvp;
+    int locMatView;
+    int locChunkOrigin;
+    int locBlockColors;
+    int locColDiffuse;
+    int locTexture0;
+    int locFaceOffset;          // Opcional (-1): só o wireframe de debug usa
+} VoxelMeshShader;
+
 // Inicializa o sistema de mesh
 void VoxelMesh_Init(VoxelMesh* mesh);
 
+// Garante capacidade para vertexCount vértices (cresce em potências de 2, nunca encolhe).
+// false sem memória; o conteúdo atual é preservado.
+bool VoxelMesh_Reserve(VoxelMesh* mesh, int32_t vertexCount);
+
 // Limpa o mesh
 void VoxelMesh_Clear(VoxelMesh* mesh);
 
 // Destrói o mesh
 void VoxelMesh_Destroy(VoxelMesh* mesh);
 
-// Gera mesh de um chunk (apenas faces visíveis)
+// Níveis de detalhe: 0 = voxels completos; 1..3 = heightfield do topo das colunas com
+// redução 2x, 4x e 8x (células de 2, 4 e 8 blocos), para terreno distante
+#define VOXEL_MESH_LOD_COUNT 4
+
+// Vizinhos lidos pelo mesher: 4 lados (ordem CHUNK_SIDE_*) + 4 cantos (-X-Z, +X-Z, -X+Z, +X+Z)
+#define VOXEL_MESH_NEIGHBOR_COUNT 8
+
+// Cópia estável do que o mesher lê: o chunk (seções internadas compartilhadas, privadas
+// copiadas) + a tira de um voxel de cada vizinho voltada para ele. Capturar e liberar na
+// thread dona do mundo; o build pode rodar em qualquer thread.
+typedef struct VoxelMeshSnapshot {
+    Chunk* chunk;
+    uint8_t sideTypes[4][CHUNK_SIZE_Y][CHUNK_SIZE_X];  // [CHUNK_SIDE_*][y][x ou z]: tipo do bloco
+    uint8_t cornerTypes[4][CHUNK_SIZE_Y];              // Coluna do vizinho diagonal
+    uint8_t faceLight[6];  // Luz por FaceDirection assada nos vértices (Capture: 255 = neutra)
+    uint8_t lod;           // Nível de detalhe (> 0: bordas dos vizinhos não são capturadas)
+} VoxelMeshSnapshot;
+
+// Entrada acolchoada do mesher: chunk + 1 voxel de cada vizinho, 18x18 por camada, só na
+// faixa Y ocupada (+1 camada abaixo e acima). occupancy[py][pz] tem um bit por px.
+// ~110 KB: um por worker, reaproveitado entre chunks.
+#define VOXEL_MESH_PADDED_DIM (CHUNK_SIZE_X + 2)
+
+typedef struct VoxelMeshScratch {
+    int32_t yBase;      // y do chunk na camada py = 0
+    int32_t layers;
+    uint8_t types[(CHUNK_SIZE_Y + 2) * VOXEL_MESH_PADDED_DIM * VOXEL_MESH_PADDED_DIM]; // [py][pz][px]
+    uint32_t occupancy[(CHUNK_SIZE_Y + 2) * VOXEL_MESH_PADDED_DIM];                    // [py][pz]
+    uint32_t translucent[(CHUNK_SIZE_Y + 2) * VOXEL_MESH_PADDED_DIM];                  // Ocupados por bloco translúcido
+    bool anyTranslucent;                               // Algum translúcido, com vizinhos (senão regra só de ocupação)
+    bool ownTranslucent;                               // Algum translúcido no chunk (senão o passe é pulado)
+    uint32_t visible[CHUNK_SIZE_Y * CHUNK_SIZE_Z];     // Faces expostas da direção atual
+    uint16_t mask[CHUNK_SIZE_X * CHUNK_SIZE_Y];        // Máscara da fatia: tipo | AO dos 4 cantos << 8
+} VoxelMeshScratch;
+
+// false se o chunk não está pronto (ou sem memória). lod > 0 dispensa os vizinhos: o
+// heightfield fecha as bordas com saias até o chão em vez de costurar com eles.
+// O snapshot começa zerado; recapturar o mesmo snapshot reaproveita a cópia do chunk.
+bool VoxelMeshSnapshot_Capture(VoxelMeshSnapshot* snap, VoxelWorld* world, int32_t chunkX, int32_t chunkZ, int32_t lod);
+void VoxelMeshSnapshot_Release(VoxelMeshSnapshot* snap);
+
+// Refaz o mesh a partir do snapshot (não toca o mundo: seguro em worker, um scratch por thread).
+// Dois passes: conta as faces expostas, reserva o teto de vértices uma vez e preenche.
+// Blocos com alpha < 255 na paleta vão para o sub-mesh translúcido: escondem só faces de
+// outros translúcidos (não as opacas atrás) e são escondidos por qualquer vizinho.
+// Com buffer reaproveitado de tamanho suficiente não há alocação. false sem memória.
+bool VoxelMesh_BuildFromSnapshot(VoxelMesh* mesh, const VoxelMeshSnapshot* snap, VoxelMeshScratch* scratch);
+
+// Reassa a luz dos vértices (face x AO guardado) sem refazer a geometria. Chamar
+// VoxelMesh_Upload depois se o mesh já está na GPU.
+void VoxelMesh_Relight(VoxelMesh* mesh, const uint8_t faceLight[6]);
+
+// Troca os dados de CPU (vértices, origem, estatísticas) entre dois meshes; VAO/VBO ficam
+void VoxelMesh_SwapVertices(VoxelMesh* a, VoxelMesh* b);
+
+// Refaz o mesh com as faces visíveis de um chunk (greedy meshing: faces cobertas por
+// vizinhos sólidos são descartadas e faces coplanares do mesmo tipo e mesma AO viram um
+// retângulo). Luz neutra nas faces (só AO): reiluminar com VoxelMesh_Relight.
+// Estatísticas do chunk em mesh->chunkStats.
 void VoxelMesh_GenerateChunk(VoxelMesh* mesh, VoxelWorld* world, 
                              int32_t chunkX, int32_t chunkZ,
                              float playerX, float playerY, float playerZ);
 
-// Renderiza o mesh
-void VoxelMesh_Render(VoxelMesh* mesh, Camera3D* camera);
+// Mesmo que GenerateChunk no nível de detalhe pedido (0..VOXEL_MESH_LOD_COUNT-1).
+// Aloca snapshot e scratch a cada chamada (ferramentas); no laço de frame, capturar num
+// snapshot reaproveitado e usar VoxelMesh_BuildFromSnapshot.
+void VoxelMesh_GenerateChunkLod(VoxelMesh* mesh, VoxelWorld* world, int32_t chunkX, int32_t chunkZ, int32_t lod);
+
+// Quads por draw indexado: o buffer de índices compartilhado é u16 (65536 vértices).
+// Chunks acima disso (só em casos patológicos) desenham em mais de um lote.
+#define VOXEL_MESH_QUADS_PER_DRAW 16384
+
+// Libera o buffer de índices compartilhado (junto com o contexto GL)
+void VoxelMesh_UnloadShared(void);
+
+// Envia os vértices para a GPU (reaproveita o VBO se couber). Chamar na thread do GL.
+void VoxelMesh_Upload(VoxelMesh* mesh);
+
+// Resolve as locations e a paleta de cores do shader já carregado (id 0 = sem GPU)
+void VoxelMesh_InitShader(VoxelMeshShader* shader, unsigned int shaderId);
+
+// Ativa o shader e as matrizes atuais (dentro de BeginMode3D) antes de uma sequência de
+// VoxelMesh_Render. Retorna false sem shader (o Render cai no DrawTriangle3D).
+bool VoxelMesh_BeginShader(const VoxelMeshShader* shader);
+void VoxelMesh_EndShader(const VoxelMeshShader* shader);
+
+// Troca a cor multiplicada (colDiffuse) e o deslocamento pela normal da face dentro de
+// Begin/EndShader. BeginShader volta para branco e deslocamento 0.
+void VoxelMesh_SetShaderTint(const VoxelMeshShader* shader, Color tint, float faceOffset);
+
+// Renderiza os dois sub-meshes num único draw (wireframe de debug com rlEnableWireMode:
+// as arestas dos triângulos do mesh em cache, sem buffer de linhas à parte)
+void VoxelMesh_RenderAll(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera);
+
+// Renderiza o sub-mesh opaco: um draw indexado do VAO com a origem do chunk como uniform
+// se houver shader ativo e upload feito; senão decodifica e usa DrawTriangle3D.
+void VoxelMesh_Render(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera);
+
+// Reordena os quads translúcidos de trás para frente para a câmera, se ela andou mais que
+// VOXEL_MESH_SORT_THRESHOLD desde a última ordenação (ou o mesh mudou), e reenvia só essa
+// faixa do VBO. Retorna true se ordenou. Chamar na thread do GL.
+bool VoxelMesh_SortTranslucent(VoxelMesh* mesh, Vector3 cameraPosition);
+
+// Renderiza o sub-mesh translúcido (depois de todos os opacos; profundidade só leitura
+// fica com quem chama)
+void VoxelMesh_RenderTranslucent(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera);
 
 #endif // VOXEL_MESH_H
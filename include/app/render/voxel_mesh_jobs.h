@@ -0,0 +1,62 @@
+#ifndef VOXEL_MESH_JOBS_H
+#define VOXEL_MESH_JOBS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app/render/voxel_mesh.h"
+
+// ============================================================================
+// VOXEL MESH JOBS — geração de meshes de chunk em threads de trabalho
+// A thread de render captura o snapshot, enfileira o job e depois recolhe os
+// prontos (PollFinished). Workers só leem o snapshot e escrevem no mesh do job:
+// nada de mundo, nada de GL.
+// ============================================================================
+
+typedef struct VoxelMeshJobs VoxelMeshJobs;
+
+// Jobs ociosos guardados para reuso (cada um segura um chunk de snapshot e um buffer)
+#define VOXEL_MESH_JOB_POOL_MAX 64
+
+typedef struct VoxelMeshJob {
+    int32_t chunkX;
+    int32_t chunkZ;
+    uint32_t serial;                // Quem enfileirou usa para casar o resultado
+    uint32_t version;               // Chunk->version capturada
+    uint32_t neighborVersions[VOXEL_MESH_NEIGHBOR_COUNT]; // Bordas dos vizinhos capturadas
+    uint32_t lightingVersion;       // Luz assada (snapshot.faceLight)
+    VoxelMeshSnapshot snapshot;     // Entrada (liberada em VoxelMeshJob_Destroy)
+    VoxelMesh mesh;                 // Saída (só CPU)
+    bool built;                     // false: sem memória no build (mesh vazio, não publicar)
+    struct VoxelMeshJob* next;
+} VoxelMeshJob;
+
+// Cria o pool com `workerCount` threads (<= 0: núcleos - 1, entre 1 e 4). NULL em falha.
+VoxelMeshJobs* VoxelMeshJobs_Create(int32_t workerCount);
+
+// Encerra os workers; jobs pendentes ou prontos são descartados
+void VoxelMeshJobs_Destroy(VoxelMeshJobs* jobs);
+
+// Job vazio (mesh inicializado). NULL sem memória.
+VoxelMeshJob* VoxelMeshJob_Create(void);
+
+// Job reciclado do pool (snapshot e buffer de vértices de rodadas anteriores, sem alocar)
+// ou novo se o pool está vazio. Só na thread que submete.
+VoxelMeshJob* VoxelMeshJobs_AcquireJob(VoxelMeshJobs* jobs);
+
+// Devolve o job ao pool (até VOXEL_MESH_JOB_POOL_MAX; o excedente é destruído).
+// Mantém o chunk do snapshot e a capacidade do mesh para o próximo Acquire.
+void VoxelMeshJobs_RecycleJob(VoxelMeshJobs* jobs, VoxelMeshJob* job);
+
+// Libera snapshot e mesh (thread de render: o snapshot solta seções do chunk)
+void VoxelMeshJob_Destroy(VoxelMeshJob* job);
+
+// Enfileira um job com snapshot capturado. O pool assume a posse até PollFinished.
+void VoxelMeshJobs_Submit(VoxelMeshJobs* jobs, VoxelMeshJob* job);
+
+// Próximo job pronto (o chamador assume a posse) ou NULL
+VoxelMeshJob* VoxelMeshJobs_PollFinished(VoxelMeshJobs* jobs);
+
+// Jobs enfileirados ou em construção (ainda não recolhidos)
+int32_t VoxelMeshJobs_GetPendingCount(VoxelMeshJobs* jobs);
+
+#endif // VOXEL_MESH_JOBS_H
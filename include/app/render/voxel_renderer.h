@@ -3,34 +3,147 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "app/render/voxel_mesh.h"
+#include "app/render/lighting.h"
+#include "app/render/frustum.h"
+#include "app/render/occlusion_culler.h"
 
 // Forward declarations
 typedef struct VoxelWorld VoxelWorld;
-typedef struct Camera3D Camera3D;
 
 // Cores para cada tipo de bloco
 typedef struct {
     unsigned char r, g, b, a;
 } BlockColor;
 
+// Cache de meshes: anel VOXEL_MESH_CACHE_DIM x VOXEL_MESH_CACHE_DIM indexado pelas
+// coordenadas do chunk módulo a dimensão (a janela renderizada cabe sem colisões:
+// distância de visão até (DIM - 1) / 2 chunks = 496 m)
+#define VOXEL_MESH_CACHE_DIM 64
+
+// Vértices publicados (swap + upload) por frame; o resto dos prontos espera o próximo.
+// Pelo menos um mesh por frame; meshes de LOD são pequenos e passam vários de uma vez.
+#define VOXEL_RENDERER_UPLOAD_BUDGET 32768
+
+// Jobs de mesh em voo; chunks além disso esperam o próximo frame (perto primeiro)
+#define VOXEL_RENDERER_MAX_JOBS_IN_FLIGHT 64
+
+// Quads oclusores rasterizados por frame (chunks mais perto primeiro)
+#define VOXEL_RENDERER_MAX_OCCLUDER_QUADS 512
+
+// Raio externo padrão (chunks) de cada nível de detalhe: voxels até 64 m, depois
+// heightfield 2x, 4x e 8x até 384 m
+#define VOXEL_RENDERER_LOD0_RADIUS 4
+#define VOXEL_RENDERER_LOD1_RADIUS 8
+#define VOXEL_RENDERER_LOD2_RADIUS 14
+#define VOXEL_RENDERER_LOD3_RADIUS 24
+
+typedef struct VoxelChunkMesh VoxelChunkMesh;
+typedef struct VoxelMeshJobs VoxelMeshJobs;
+typedef struct VoxelTranslucentDraw VoxelTranslucentDraw;
+typedef struct VoxelCullScratch VoxelCullScratch;
+
+// Estatísticas do último VoxelRenderer_Render
+typedef struct {
+    int32_t cachedMeshes;   // Meshes residentes no cache
+    int32_t meshesRebuilt;  // Enviados para gerar neste frame (chunk novo/editado ou borda vizinha mudou)
+    int32_t meshesPublished;// Prontos trocados + enviados à GPU neste frame (até VOXEL_RENDERER_UPLOAD_BUDGET vértices)
+    int32_t jobsPending;    // Em construção ou prontos aguardando publicação
+    int32_t meshesEvicted;  // Descartados neste frame (chunk descarregado ou fora do raio)
+    int32_t meshesRelit;    // Luz reassada sem remesh neste frame (luz direcional mudou)
+    int32_t chunksTested;   // Meshes não vazios testados contra o frustum
+    int32_t chunksCulled;   // Fora do frustum (nem opaco nem translúcido desenhado)
+    int32_t sectionsTested; // Seções testadas das colunas que cruzam a borda do frustum
+    int32_t chunksOccluded; // Dentro do frustum mas escondidos atrás dos oclusores
+    int32_t occluderQuads;  // Faces rasterizadas no buffer de oclusão
+    int32_t chunksDrawn;
+    int32_t verticesDrawn;
+    int32_t lodChunksDrawn[VOXEL_MESH_LOD_COUNT]; // chunksDrawn por nível de detalhe
+    int32_t translucentChunksDrawn; // Chunks com quads no passe translúcido
+    int32_t translucentSorts;       // Chunks cujos quads translúcidos foram reordenados (câmera andou)
+} VoxelRendererStats;
+
 // Renderizador de mundo voxel
 typedef struct {
     bool initialized;
-    int32_t renderDistance; // Distância de renderização em chunks
+    int32_t renderDistance; // Distância de renderização em chunks (= lodRadius do último nível)
+    int32_t lodRadius[VOXEL_MESH_LOD_COUNT]; // Raio externo de cada nível (chunks, crescente)
+    VoxelChunkMesh* meshCache; // VOXEL_MESH_CACHE_DIM² entradas
+    VoxelMeshJobs* meshJobs;   // Workers de geração (NULL = gera na thread de render)
+    VoxelTranslucentDraw* translucentDraws; // Fila do passe translúcido (VOXEL_MESH_CACHE_DIM² entradas)
+    VoxelCullScratch* cull;    // Caixas SoA e máscaras do culling em lote
+    VoxelMeshSnapshot* syncSnapshot; // Geração na thread de render (sem job): alocados na
+    VoxelMeshScratch* syncScratch;   // primeira vez e reaproveitados, como nos workers
+    uint32_t nextJobSerial;
+    int32_t jobsInFlight;      // Enviados e ainda não recolhidos
+    uint32_t lightingVersion;  // LightingSystem.version da luz em faceLight (0 = neutra)
+    uint8_t faceLight[6];      // Luz por FaceDirection assada nos vértices
+    Frustum frustum;           // Frustum da câmera do frame (VoxelRenderer_SetFrustum)
+    bool frustumEnabled;       // false: desenha todos os meshes dentro da distância
+    OcclusionCuller occlusion; // Buffer de profundidade em CPU (oclusores do frame)
+    OcclusionView occlusionView;
+    bool occlusionEnabled;     // VoxelRenderer_SetOcclusionView com câmera
+    Shader shader;             // voxel_packed.vs + fs (id 0 = fallback DrawTriangle3D)
+    VoxelMeshShader meshShader;
+    VoxelRendererStats stats;
 } VoxelRenderer;
 
 // Inicializa o renderizador
 void VoxelRenderer_Init(VoxelRenderer* renderer);
 
-// Renderiza o mundo voxel
+// Carrega o shader dos vértices compactados (assets/shaders/voxel_packed.vs com um fs
+// de mesma interface que fog_forward.fs). Uniforms de fog ficam com quem chama, via renderer->shader.
+bool VoxelRenderer_LoadShader(VoxelRenderer* renderer, const char* vsPath, const char* fsPath);
+
+// Libera os meshes em cache e o shader
+void VoxelRenderer_Destroy(VoxelRenderer* renderer);
+
+// Atualiza a luz assada nos vértices. Barato se a versão não mudou: chamar todo frame.
+// Meshes em cache são reiluminados (sem remesh) no próximo Render.
+void VoxelRenderer_SetLighting(VoxelRenderer* renderer, LightingSystem* lighting);
+
+// Frustum usado no culling dos chunks no próximo Render (copiado). NULL desliga o culling.
+// Calcular com Frustum_CalculateUnclamped e far na distância de renderização.
+void VoxelRenderer_SetFrustum(VoxelRenderer* renderer, const Frustum* frustum);
+
+// Câmera da oclusão em CPU no próximo Render (copiada). NULL desliga. Os chunks que passam
+// no frustum ainda são testados contra as maiores faces dos chunks próximos
+// (VoxelMesh.occluders) e somem se ficarem inteiramente atrás delas.
+void VoxelRenderer_SetOcclusionView(VoxelRenderer* renderer, const OcclusionView* view);
+
+// Renderiza o mundo voxel. Cada chunk tem seu mesh em cache, refeito só quando a versão
+// do chunk, a borda de um vizinho ou o nível de detalhe muda; chunks descarregados perdem
+// o mesh. Perto: voxels completos; longe: heightfield com redução 2x/4x/8x (lodRadius).
+// Usa os chunks já prontos no mundo (o streaming fica com quem chama); só os meshes cuja
+// caixa (chunk x faixa Y ocupada) toca o frustum são desenhados. O culling é em lote e
+// hierárquico: todas as colunas de uma vez, depois as seções ocupadas só das colunas
+// que cruzam uma borda do frustum. Com SetOcclusionView, os que passam ainda são testados
+// contra o buffer de oclusão em CPU.
+// A geração roda nos workers; enquanto o mesh novo não fica pronto o antigo continua
+// sendo desenhado, e no máximo VOXEL_RENDERER_UPLOAD_BUDGET são publicados por frame.
+// Depois dos opacos, os chunks com blocos translúcidos são desenhados de trás para frente
+// sem escrever profundidade (sem translúcidos na tela o passe não acontece).
 void VoxelRenderer_Render(VoxelRenderer* renderer, VoxelWorld* world, 
                          float playerX, float playerY, float playerZ,
                          Camera3D* camera);
 
+// Deslocamento das linhas do wireframe pela normal da face (evita z-fighting com as faces)
+#define VOXEL_RENDERER_WIRE_OFFSET 0.0015f
+
+// Wireframe de debug dos chunks desenhados no último Render: um draw por chunk do mesh em
+// cache em modo de linhas (arestas dos quads e a diagonal), na cor `color`. Sem varredura
+// de blocos: as linhas só mudam quando o mesh é refeito.
+void VoxelRenderer_RenderWireframe(VoxelRenderer* renderer, Camera3D* camera, Color color);
+
 // Retorna a cor de um tipo de bloco
 BlockColor VoxelRenderer_GetBlockColor(uint8_t blockType);
 
-// Define a distância de renderização
+// Define a distância de renderização (chunks, até (VOXEL_MESH_CACHE_DIM - 1) / 2).
+// Níveis internos com raio maior são encurtados junto.
 void VoxelRenderer_SetRenderDistance(VoxelRenderer* renderer, int32_t distance);
 
+// Define o raio externo (chunks) de cada nível de detalhe; valores forçados a crescentes
+// e dentro do cache. O último vira a distância de renderização.
+void VoxelRenderer_SetLodRadii(VoxelRenderer* renderer, const int32_t radii[VOXEL_MESH_LOD_COUNT]);
+
 #endif // VOXEL_RENDERER_H
@@ -12,4 +12,9 @@ void arc_get_cpu_name(char* buffer);
 
 void Arc_GetFormattedDateTime(char* out, size_t outSize);
 
+/* FNV-1a 64 bits: assinatura barata do que uma região desenha */
+#define ARC_HASH_SEED 14695981039346656037ULL
+unsigned long long arc_hash_bytes(unsigned long long h, const void* data, size_t n);
+unsigned long long arc_hash_str(unsigned long long h, const char* s);
+
 #endif
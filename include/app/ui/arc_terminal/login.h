@@ -21,5 +21,7 @@ typedef struct {
 /* Processa uma tecla; retorna true se transicionou para LOADING */
 bool Arc_Login_ProcessKey(ArcLoginLogicContext* ctx, int key);
 void Arc_Login_Render(ArcLoginRenderContext* ctx, Font font);
+/* Muda quando o login desenhado mudaria (texto, erro, fase do cursor) */
+unsigned long long Arc_Login_RenderSignature(const ArcLoginRenderContext* ctx);
 
 #endif
@@ -8,6 +8,15 @@
 /* Contexto completo do shell (estado, histórico, comandos, etc.) */
 typedef struct ArcShellContext ArcShellContext;
 
+/* Regiões redesenhadas separadamente. BODY cobre o overlay inteiro (seu redesenho
+ * refaz tudo); CLOCK e PROMPT são faixas que mudam sozinhas com o terminal parado. */
+typedef enum {
+    ARC_SHELL_REGION_BODY,
+    ARC_SHELL_REGION_CLOCK,
+    ARC_SHELL_REGION_PROMPT,
+    ARC_SHELL_REGION_COUNT
+} ArcShellRegion;
+
 ArcShellContext* Arc_Shell_Create(void);
 void Arc_Shell_Destroy(ArcShellContext* ctx);
 
@@ -25,6 +34,18 @@ void Arc_Shell_Render(ArcShellContext* ctx, Font font, Texture2D logo, bool logo
                       const char* username, const char* cpuName, unsigned long long totalRam,
                       float screenW, float screenH);
 
+/* Fundo fixo (marca d'água do logo, moldura): desenhado uma vez numa textura própria */
+void Arc_Shell_RenderStatic(Texture2D logo, bool logoOk, float screenW, float screenH);
+
+/* Desenha só o conteúdo da região, sem fundo (o chamador restaura o fundo fixo antes) */
+void Arc_Shell_RenderRegion(const ArcShellContext* ctx, ArcShellRegion region, Font font,
+                            const char* username, float screenW, float screenH);
+Rectangle Arc_Shell_RegionRect(ArcShellRegion region, float screenW, float screenH);
+
+/* Assinatura do que a região mostra agora; igual à do último desenho = nada a refazer */
+unsigned long long Arc_Shell_RegionSignature(const ArcShellContext* ctx, ArcShellRegion region,
+                                             const char* username);
+
 /* Callbacks que o shell precisa (AddToTerminal, AddToLog, ExecuteCommand) são internos. */
 
 #endif
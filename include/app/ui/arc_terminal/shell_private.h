@@ -12,6 +12,7 @@
 struct ArcShellContext {
     char terminalHistory[SHELL_MAX_LINES][256];
     int lineCount;
+    unsigned int historyVersion;   /* Muda a cada linha nova no terminal/log (redesenho) */
     char command_str[1024];
     int shellLetterCount;
     char logHistory[SHELL_MAX_LOG_LINES][256];
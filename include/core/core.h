@@ -13,6 +13,11 @@ int Core_Init(void);
 // Atualiza a simulação do jogo (chamado todo frame)
 void Core_Tick(float dt);
 
+// Simulação em thread própria (SimThread): enquanto ligado, o poll de rede e a simulação
+// saem do Core_Tick e passam a rodar em Core_SimStep, chamado a cada passo daquela thread.
+void Core_SetSimThreaded(bool threaded);
+void Core_SimStep(float dt);
+
 // Finaliza o sistema Core
 void Core_Shutdown(void);
 
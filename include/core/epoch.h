@@ -0,0 +1,49 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "thread.h"
+
+// Reclamação por épocas (EBR) para estruturas lidas sem lock.
+// Leitores: Epoch_Enter / Epoch_Exit em volta do uso dos ponteiros (lock-free).
+// Escritores: tiram o objeto da estrutura e chamam Epoch_Retire; a memória só é
+// liberada por Epoch_Collect depois que todos os leitores ativos avançaram de época.
+// O domínio é zero-inicializável (pode ser `static`).
+
+#define EPOCH_MAX_READERS 64
+
+typedef void (*EpochFreeFunc)(void* ptr);
+
+typedef struct EpochRetired {
+    void* ptr;
+    EpochFreeFunc freeFn;
+    uint64_t epoch;
+} EpochRetired;
+
+typedef struct EpochDomain {
+    uint64_t globalEpoch;                       // Atômico
+    uint64_t readers[EPOCH_MAX_READERS];        // (época << 1) | 1; 0 = slot livre
+    SpinLock retireLock;
+    EpochRetired* retired;
+    int32_t retiredCount;
+    int32_t retiredCapacity;
+} EpochDomain;
+
+// Entra numa seção de leitura. Retorna o slot a passar para Epoch_Exit.
+int32_t Epoch_Enter(EpochDomain* domain);
+void Epoch_Exit(EpochDomain* domain, int32_t slot);
+
+// Agenda freeFn(ptr) para quando nenhum leitor puder mais enxergar ptr (qualquer thread)
+void Epoch_Retire(EpochDomain* domain, void* ptr, EpochFreeFunc freeFn);
+
+// Avança a época se possível e libera o que já é seguro. Barato; chamar uma vez por frame.
+void Epoch_Collect(EpochDomain* domain);
+
+// Espera até liberar tudo que foi aposentado antes da chamada (bloqueia enquanto houver leitores antigos)
+void Epoch_Synchronize(EpochDomain* domain);
+
+// Objetos aguardando liberação
+int32_t Epoch_GetPendingCount(EpochDomain* domain);
+
+#endif // EPOCH_H
@@ -0,0 +1,21 @@
+#ifndef FILE_MAP_H
+#define FILE_MAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Arquivo mapeado em memória, só leitura (MapViewOfFile no Windows, mmap no resto).
+// O sistema pagina sob demanda: abrir um arquivo grande não lê nada do disco.
+
+typedef struct FileMap FileMap;
+
+// Mapeia o arquivo inteiro. NULL se não existir, estiver vazio ou falhar.
+FileMap* FileMap_Open(const char* path);
+
+// Desfaz o mapeamento (ponteiros obtidos de GetData deixam de valer)
+void FileMap_Close(FileMap* map);
+
+const uint8_t* FileMap_GetData(const FileMap* map);
+size_t FileMap_GetSize(const FileMap* map);
+
+#endif // FILE_MAP_H
@@ -0,0 +1,36 @@
+#ifndef SIM_THREAD_H
+#define SIM_THREAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Simulação em passo fixo numa thread própria. O passo roda no ritmo do relógio
+// (Time_GetSeconds), não do frame: a thread dorme até a hora do próximo passo e, se
+// atrasou (passo lento, SO), recupera até SIM_THREAD_MAX_CATCHUP passos seguidos;
+// o que passar disso é descartado (evita a espiral de passos cada vez mais atrasados).
+// O resultado de cada passo sai por conta do callback (ex.: snapshot num TripleBuffer).
+
+#define SIM_THREAD_MAX_CATCHUP 5
+
+typedef struct SimThread SimThread;
+
+// dt = passo fixo; tickTime = hora (Time_GetSeconds) que o estado após o passo representa
+typedef void (*SimStepFunc)(void* userData, float dt, double tickTime);
+
+typedef struct SimThreadStats {
+    uint64_t steps;             // Passos executados
+    uint64_t droppedSteps;      // Passos descartados por atraso
+    float lastStepTime;         // Duração do último passo (segundos)
+    float maxStepTime;          // Maior duração desde o Start
+} SimThreadStats;
+
+// Cria a thread e começa a simular. Retorna NULL em falha (quem chama simula no frame).
+SimThread* SimThread_Start(float stepSeconds, SimStepFunc step, void* userData);
+
+// Pede a parada, espera o passo em andamento terminar e libera
+void SimThread_Stop(SimThread* sim);
+
+float SimThread_GetStep(const SimThread* sim);
+void SimThread_GetStats(SimThread* sim, SimThreadStats* outStats);
+
+#endif // SIM_THREAD_H
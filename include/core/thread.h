@@ -0,0 +1,59 @@
+#ifndef THREAD_H
+#define THREAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Threads, mutex e variáveis de condição (Win32 no Windows, pthreads no resto).
+// Tipos opacos: windows.h / pthread.h não vazam para quem inclui este header.
+
+typedef struct Thread Thread;
+typedef struct Mutex Mutex;
+typedef struct CondVar CondVar;
+
+typedef void (*ThreadFunc)(void* userData);
+
+// Cria e inicia uma thread. Retorna NULL em falha.
+Thread* Thread_Create(ThreadFunc func, void* userData);
+
+// Espera a thread terminar e libera o handle
+void Thread_Join(Thread* thread);
+
+// Número de núcleos lógicos (mínimo 1)
+int32_t Thread_GetCpuCount(void);
+
+// Cede o restante da fatia de tempo (spin de espera)
+void Thread_Yield(void);
+
+// Dorme pelo menos `milliseconds` (granularidade do escalonador do SO)
+void Thread_Sleep(uint32_t milliseconds);
+
+// Mutex (não recursivo)
+Mutex* Mutex_Create(void);
+void Mutex_Destroy(Mutex* mutex);
+void Mutex_Lock(Mutex* mutex);
+void Mutex_Unlock(Mutex* mutex);
+
+// Variável de condição (sempre usada com um Mutex travado)
+CondVar* CondVar_Create(void);
+void CondVar_Destroy(CondVar* cond);
+void CondVar_Wait(CondVar* cond, Mutex* mutex);
+void CondVar_Signal(CondVar* cond);
+void CondVar_Broadcast(CondVar* cond);
+
+// Spinlock para seções curtíssimas. Zero-inicializável: pode ser `static` sem Create.
+typedef struct SpinLock {
+    volatile int32_t locked;
+} SpinLock;
+
+static inline void SpinLock_Lock(SpinLock* lock) {
+    while (__atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE)) {
+        Thread_Yield();
+    }
+}
+
+static inline void SpinLock_Unlock(SpinLock* lock) {
+    __atomic_store_n(&lock->locked, 0, __ATOMIC_RELEASE);
+}
+
+#endif // THREAD_H
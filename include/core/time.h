@@ -18,4 +18,7 @@ float Time_GetTotalTime(void);
 // Retorna o número de ticks desde o início
 uint64_t Time_GetTicks(void);
 
+// Relógio monotônico de alta resolução (segundos desde Time_Init); para medições/benchmarks
+double Time_GetSeconds(void);
+
 #endif // TIME_H
@@ -0,0 +1,36 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Buffer triplo lock-free: um escritor publica estados inteiros, um leitor pega o mais novo.
+// Três slots de slotSize bytes: o escritor preenche o seu (back), Publish troca com o do meio;
+// o leitor troca o seu (front) com o do meio só quando há publicação nova. Ninguém espera:
+// o escritor pode publicar várias vezes entre duas leituras (o leitor vê só a última), e o
+// slot devolvido por Read fica intacto até a próxima Read da mesma thread.
+// Um escritor e um leitor, cada um sempre na mesma thread.
+
+typedef struct TripleBuffer {
+    uint8_t* slots;         // 3 * slotSize
+    size_t slotSize;
+    uint32_t middle;        // Atômico: índice do slot do meio + bit "publicado, não lido"
+    uint32_t back;          // Só o escritor
+    uint32_t front;         // Só o leitor
+} TripleBuffer;
+
+bool TripleBuffer_Init(TripleBuffer* tb, size_t slotSize);
+void TripleBuffer_Destroy(TripleBuffer* tb);
+
+// Escritor: slot a preencher (conteúdo é o de uma publicação antiga, não zerado)
+void* TripleBuffer_WriteSlot(TripleBuffer* tb);
+
+// Escritor: publica o slot preenchido e recebe outro livre
+void TripleBuffer_Publish(TripleBuffer* tb);
+
+// Leitor: estado publicado mais recente. outFresh = true se mudou desde a última leitura.
+// Antes da primeira publicação devolve um slot zerado.
+const void* TripleBuffer_Read(TripleBuffer* tb, bool* outFresh);
+
+#endif // TRIPLE_BUFFER_H
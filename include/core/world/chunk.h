@@ -11,6 +11,19 @@
 #define CHUNK_SIZE_Y 256
 #define CHUNK_VOLUME (CHUNK_SIZE_X * CHUNK_SIZE_Z * CHUNK_SIZE_Y)
 
+// Seções: fatias verticais de 16 camadas (16x16x16). Com a indexação [y][z][x],
+// cada seção é um trecho contíguo de CHUNK_SECTION_VOLUME blocos.
+#define CHUNK_SECTION_HEIGHT 16
+#define CHUNK_SECTION_COUNT (CHUNK_SIZE_Y / CHUNK_SECTION_HEIGHT)
+#define CHUNK_SECTION_VOLUME (CHUNK_SIZE_X * CHUNK_SIZE_Z * CHUNK_SECTION_HEIGHT)
+
+// Lados do chunk (índices de Chunk.borderVersions)
+#define CHUNK_SIDE_NEG_X 0
+#define CHUNK_SIDE_POS_X 1
+#define CHUNK_SIDE_NEG_Z 2
+#define CHUNK_SIDE_POS_Z 3
+#define CHUNK_SIDES_ALL  0xF
+
 // Estados do chunk
 typedef enum {
     CHUNK_STATE_EMPTY,      // Chunk não existe
@@ -19,14 +32,29 @@ typedef enum {
     CHUNK_STATE_INVALID     // Chunk inválido (erro)
 } ChunkState;
 
+// Seção 16x16x16. Seções internadas são imutáveis e compartilhadas por conteúdo
+// entre todos os chunks (inclusive de VoxelWorlds diferentes); escrever exige
+// cópia privada (Chunk_GetSectionMut).
+typedef struct ChunkSection {
+    Voxel blocks[CHUNK_SECTION_VOLUME]; // Indexado como [y][z][x] dentro da seção
+    uint64_t hash;          // Hash do conteúdo (válido se interned)
+    int32_t solidCount;     // Voxels não-ar (válido se interned)
+    int32_t refCount;       // Chunks que apontam para ela (interned)
+    bool interned;
+    struct ChunkSection* nextInTable;
+} ChunkSection;
+
 // Estrutura de um chunk
 typedef struct Chunk {
     int32_t chunkX;         // Coordenada X do chunk
     int32_t chunkZ;         // Coordenada Z do chunk
     uint64_t chunkSeed;     // Seed específica deste chunk
-    ChunkState state;       // Estado atual
-    Voxel blocks[CHUNK_VOLUME]; // Array de blocos (indexado como [y][z][x])
-    bool dirty;             // Precisa ser salvo/atualizado
+    ChunkState state;       // Estado atual (atômico: lido pela thread de render)
+    ChunkSection* sections[CHUNK_SECTION_COUNT]; // De baixo para cima; nunca NULL
+    uint32_t version;       // Muda a cada alteração de conteúdo (único entre chunks; 0 = nunca; atômico)
+    uint32_t borderVersions[4]; // Idem, por lado (-X, +X, -Z, +Z): alterações que podem tocar aquela borda
+    bool dirty;             // Editado desde a última gravação (geração não conta)
+    bool storagePending;    // Região ainda carregando; edições salvas serão aplicadas depois
     struct Chunk* next;     // Para hash table
 } Chunk;
 
@@ -36,6 +64,9 @@ Chunk* Chunk_Create(int32_t chunkX, int32_t chunkZ, uint64_t chunkSeed);
 // Destrói um chunk
 void Chunk_Destroy(Chunk* chunk);
 
+// Reinicializa um chunk existente (tudo ar, estado GENERATING), reaproveitando a memória
+void Chunk_Reset(Chunk* chunk, int32_t chunkX, int32_t chunkZ, uint64_t chunkSeed);
+
 // Retorna o bloco em coordenadas locais do chunk (0-15, 0-255, 0-15)
 Voxel Chunk_GetBlock(const Chunk* chunk, int32_t localX, int32_t localY, int32_t localZ);
 
@@ -55,4 +86,62 @@ void Chunk_LocalToGlobal(int32_t chunkX, int32_t chunkZ,
 // Verifica se coordenadas locais são válidas
 bool Chunk_IsValidLocalPos(int32_t localX, int32_t localY, int32_t localZ);
 
+// Seção somente leitura (índice 0..CHUNK_SECTION_COUNT-1). Com escritor concorrente, só
+// dentro de Chunk_ReadBegin/End: o ponteiro vale até o ReadEnd e os voxels em si podem
+// estar sendo editados. Para ficar com as seções depois disso, Chunk_CopyBlocks.
+static inline const Voxel* Chunk_GetSectionVoxels(const Chunk* chunk, int32_t section) {
+    return __atomic_load_n(&chunk->sections[section], __ATOMIC_ACQUIRE)->blocks;
+}
+
+// Leituras de estado/versão seguras com a simulação escrevendo em outra thread
+static inline bool Chunk_IsReady(const Chunk* chunk) {
+    return __atomic_load_n(&chunk->state, __ATOMIC_ACQUIRE) == CHUNK_STATE_READY;
+}
+
+static inline uint32_t Chunk_GetVersion(const Chunk* chunk) {
+    return __atomic_load_n(&chunk->version, __ATOMIC_ACQUIRE);
+}
+
+static inline uint32_t Chunk_GetBorderVersion(const Chunk* chunk, int32_t side) {
+    return __atomic_load_n(&chunk->borderVersions[side], __ATOMIC_ACQUIRE);
+}
+
+// Seção inteira de ar (O(1) para seções internadas)
+bool Chunk_IsSectionEmpty(const Chunk* chunk, int32_t section);
+
+// Seção para escrita: copia se estiver compartilhada (copy-on-write). NULL sem memória.
+// Conta como alteração de conteúdo em todas as bordas.
+Voxel* Chunk_GetSectionMut(Chunk* chunk, int32_t section);
+
+// Preenche a seção inteira com um voxel (compartilha a seção uniforme, sem cópia)
+void Chunk_FillSection(Chunk* chunk, int32_t section, Voxel voxel);
+
+// Interna as seções privadas (fim da geração/decodificação): iguais passam a ser compartilhadas
+void Chunk_InternSections(Chunk* chunk);
+
+// Copia os blocos de `src` para `dst` compartilhando as seções internadas. `src` pode estar
+// sendo editado por outra thread (chamar dentro de Chunk_ReadBegin/End); `dst` não.
+void Chunk_CopyBlocks(Chunk* dst, const Chunk* src);
+
+// Compara o conteúdo (seções compartilhadas comparam por ponteiro)
+bool Chunk_SameBlocks(const Chunk* a, const Chunk* b);
+
+// Leitura concorrente (outras threads): ponteiros de Chunk/seção obtidos entre
+// ReadBegin e ReadEnd continuam válidos até o ReadEnd. Lock-free.
+int32_t Chunk_ReadBegin(void);
+void Chunk_ReadEnd(int32_t guard);
+
+// Destrói o chunk quando nenhum leitor puder mais vê-lo (já fora de qualquer tabela)
+void Chunk_Retire(Chunk* chunk);
+
+// Libera chunks/seções aposentados já seguros (uma vez por frame).
+// waitForReaders = true espera os leitores atuais saírem e libera tudo o que estava pendente.
+void Chunk_CollectRetired(bool waitForReaders);
+
+// Chunks + seções aguardando liberação
+int32_t Chunk_GetRetiredCount(void);
+
+// Estatística global de deduplicação: referências de chunks, seções internadas únicas, privadas
+void Chunk_GetSectionStats(int32_t* outReferenced, int32_t* outUnique, int32_t* outPrivate);
+
 #endif // CHUNK_H
@@ -0,0 +1,94 @@
+#ifndef CHUNK_CODEC_H
+#define CHUNK_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "chunk.h"
+
+/* ============================================================================
+ * CHUNK CODEC — serialização binária versionada de um Chunk
+ * Base para persistência, rede e compressão em memória.
+ *
+ * Formato (v1), tudo em varint LEB128 salvo indicação:
+ *   "BTDC" (4 bytes) | versão | chunkX (zigzag) | chunkZ (zigzag) | chunkSeed
+ *   | nº de seções | altura da seção
+ *   Por seção (16 camadas, ordem [y][z][x]):
+ *     tamanho da paleta | chaves da paleta (type * 256 + metadata)
+ *     paleta == 1 → seção uniforme (sem runs)
+ *     paleta == 0 → modo direto: runs carregam a chave inteira (12 bits)
+ *     runs ao longo das linhas X: varint(((len - 1) << bitsIndice) | indice)
+ *   Checksum FNV-1a 32 bits de tudo acima (4 bytes, little-endian).
+ *
+ * Encode/decode incrementais: o chamador fornece o buffer (qualquer tamanho)
+ * e chama de novo quando acabar o espaço/entrada. Nenhuma alocação.
+ * ============================================================================ */
+
+#define CHUNK_CODEC_VERSION      1
+#define CHUNK_CODEC_MAX_PALETTE  64
+#define CHUNK_CODEC_KEY_COUNT    (BLOCK_COUNT * 256)
+#define CHUNK_CODEC_DIRECT_BITS  12   /* CHUNK_CODEC_KEY_COUNT < 4096 */
+
+/* Pior caso: cabeçalho + por seção (paleta cheia + 1 run de 4 bytes por voxel) + checksum. */
+#define CHUNK_CODEC_MAX_ENCODED_SIZE \
+    (64 + CHUNK_SECTION_COUNT * (2 + CHUNK_CODEC_MAX_PALETTE * 2 + CHUNK_SECTION_VOLUME * 4) + 4)
+
+typedef enum {
+    CHUNK_CODEC_OK = 0,          /* Terminou (chunk inteiro escrito/lido) */
+    CHUNK_CODEC_NEED_OUTPUT,     /* Encoder: buffer de saída cheio; chame de novo */
+    CHUNK_CODEC_NEED_INPUT,      /* Decoder: entrada acabou antes do fim; chame de novo */
+    CHUNK_CODEC_ERROR_VERSION,   /* Magic/versão/dimensões incompatíveis */
+    CHUNK_CODEC_ERROR_CORRUPT    /* Dados inválidos ou checksum errado */
+} ChunkCodecResult;
+
+/* Estado do encoder (pode ficar na stack; ~2,5 KB). */
+typedef struct ChunkEncoder {
+    const Chunk* chunk;
+    int32_t phase;
+    int32_t section;
+    int32_t cursor;              /* voxel (dentro da seção) ou entrada da paleta */
+    int32_t paletteCount;        /* 0 = modo direto */
+    int32_t indexBits;
+    uint16_t palette[CHUNK_CODEC_MAX_PALETTE];
+    uint8_t paletteIndexOf[CHUNK_CODEC_KEY_COUNT]; /* chave → índice; 0xFF = ausente */
+    uint8_t pending[32];         /* token atual ainda não copiado para a saída */
+    int32_t pendingLen;
+    int32_t pendingPos;
+    uint32_t checksum;
+} ChunkEncoder;
+
+/* Estado do decoder. Escreve direto no Chunk fornecido. */
+typedef struct ChunkDecoder {
+    Chunk* chunk;
+    int32_t phase;
+    int32_t section;
+    int32_t cursor;
+    int32_t paletteCount;
+    int32_t paletteRemaining;
+    int32_t indexBits;
+    uint16_t palette[CHUNK_CODEC_MAX_PALETTE];
+    uint64_t varValue;           /* varint parcial (pode atravessar buffers) */
+    int32_t varShift;
+    int32_t rawCount;            /* bytes crus lidos (magic / checksum) */
+    uint32_t checksum;
+    uint32_t storedChecksum;
+} ChunkDecoder;
+
+/* Prepara o encoder para serializar `chunk` (que não deve mudar até o fim). */
+void ChunkEncoder_Begin(ChunkEncoder* enc, const Chunk* chunk);
+
+/* Escreve o máximo possível em out[0..outCapacity). *outWritten = bytes escritos.
+ * Retorna CHUNK_CODEC_OK ao terminar ou CHUNK_CODEC_NEED_OUTPUT se faltou espaço. */
+ChunkCodecResult ChunkEncoder_Encode(ChunkEncoder* enc, uint8_t* out, size_t outCapacity, size_t* outWritten);
+
+/* Prepara o decoder para preencher `chunk` (coordenadas e seed vêm do stream). */
+void ChunkDecoder_Begin(ChunkDecoder* dec, Chunk* chunk);
+
+/* Consome in[0..inLength). *outConsumed = bytes usados (pode ser < inLength ao terminar).
+ * Retorna CHUNK_CODEC_OK ao terminar, CHUNK_CODEC_NEED_INPUT se a entrada acabou, ou erro. */
+ChunkCodecResult ChunkDecoder_Decode(ChunkDecoder* dec, const uint8_t* in, size_t inLength, size_t* outConsumed);
+
+/* Atalhos de uma chamada (buffer inteiro). Encode falha com NEED_OUTPUT se não couber. */
+ChunkCodecResult ChunkCodec_EncodeToBuffer(const Chunk* chunk, uint8_t* out, size_t outCapacity, size_t* outSize);
+ChunkCodecResult ChunkCodec_DecodeFromBuffer(Chunk* chunk, const uint8_t* in, size_t inLength);
+
+#endif /* CHUNK_CODEC_H */
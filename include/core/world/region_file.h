@@ -0,0 +1,68 @@
+#ifndef REGION_FILE_H
+#define REGION_FILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ============================================================================
+ * REGION FILE — arquivo com até 32x32 chunks editados
+ * Formato (little-endian):
+ *   "BTDR" | versão u32 | regionX i32 | regionZ i32
+ *   | offsets u32[1024] | tamanhos u32[1024] | blobs (chunk_codec)
+ * Slot vazio = tamanho 0 (chunk igual ao gerado pela seed).
+ * ============================================================================ */
+
+#define REGION_SIZE_CHUNKS   32
+#define REGION_CHUNK_COUNT   (REGION_SIZE_CHUNKS * REGION_SIZE_CHUNKS)
+#define REGION_FILE_VERSION  1
+#define REGION_HEADER_SIZE   (16 + REGION_CHUNK_COUNT * 8)
+
+/* Região em memória: um blob codificado por slot (NULL = não editado). */
+typedef struct RegionData {
+    int32_t regionX;
+    int32_t regionZ;
+    uint8_t* blobs[REGION_CHUNK_COUNT];
+    uint32_t sizes[REGION_CHUNK_COUNT];
+    int32_t chunkCount;         /* slots ocupados */
+} RegionData;
+
+/* Coordenada de região de um chunk (divisão com floor; funciona para negativos). */
+static inline int32_t Region_FromChunk(int32_t chunkCoord) {
+    return (chunkCoord >= 0) ? (chunkCoord / REGION_SIZE_CHUNKS)
+                             : ((chunkCoord + 1) / REGION_SIZE_CHUNKS - 1);
+}
+
+/* Índice do slot do chunk dentro da sua região ([z][x]). */
+static inline int32_t Region_SlotIndex(int32_t chunkX, int32_t chunkZ) {
+    int32_t lx = chunkX - Region_FromChunk(chunkX) * REGION_SIZE_CHUNKS;
+    int32_t lz = chunkZ - Region_FromChunk(chunkZ) * REGION_SIZE_CHUNKS;
+    return lz * REGION_SIZE_CHUNKS + lx;
+}
+
+/* Inicializa vazia. */
+void RegionData_Init(RegionData* region, int32_t regionX, int32_t regionZ);
+
+/* Libera todos os blobs (a struct continua utilizável). */
+void RegionData_Clear(RegionData* region);
+
+/* Troca o blob do slot (assume a posse de `blob`; NULL remove). */
+void RegionData_SetChunk(RegionData* region, int32_t slot, uint8_t* blob, uint32_t size);
+
+/* Monta "<dir>/r.<rx>.<rz>.btdr". Retorna false se não couber. */
+bool RegionFile_MakePath(char* out, size_t outSize, const char* directory, int32_t regionX, int32_t regionZ);
+
+/* Cria o diretório (um nível) se não existir. */
+bool RegionFile_EnsureDirectory(const char* directory);
+
+/* Lê o arquivo para `out` (já inicializado com as coords). Arquivo ausente → true com região vazia.
+ * Arquivo inválido/corrompido → false (região fica vazia). */
+bool RegionFile_Read(const char* path, RegionData* out);
+
+/* Serializa a região num buffer novo (malloc). Usado para copiar sob lock e gravar fora dele. */
+uint8_t* RegionFile_Serialize(const RegionData* region, size_t* outSize);
+
+/* Grava bytes já serializados (arquivo temporário + rename). size == 0 remove o arquivo. */
+bool RegionFile_WriteBytes(const char* path, const uint8_t* bytes, size_t size);
+
+#endif /* REGION_FILE_H */
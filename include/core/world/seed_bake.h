@@ -0,0 +1,41 @@
+#ifndef SEED_BAKE_H
+#define SEED_BAKE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ============================================================================
+ * SEED BAKE — pista inteira de uma seed pré-gerada num único arquivo
+ * A pista é finita e determinada pela seed; hosts dedicados que repetem as
+ * mesmas missões geram uma vez (--bake) e depois só mapeiam o arquivo.
+ *
+ * Formato (little-endian):
+ *   "BTDB" | versão u32 | versão do codec u32 | seed u64
+ *   | minChunkX i32 | largura i32 | linhas i32
+ *   | índice (offset u32, tamanho u32)[linhas][largura] | blobs (chunk_codec)
+ * Arquivo: <dir>/<seed hex>.btdb
+ * ============================================================================ */
+
+#define SEED_BAKE_VERSION  1
+
+typedef struct Chunk Chunk;
+typedef struct SeedBake SeedBake;
+
+/* Monta "<dir>/<seed hex>.btdb". Retorna false se não couber. */
+bool SeedBake_MakePath(char* out, size_t outSize, const char* directory, uint64_t worldSeed);
+
+/* Gera todos os chunks da pista e grava o arquivo. *outFileSize (opcional) = bytes gravados. */
+bool SeedBake_Build(const char* directory, uint64_t worldSeed, size_t* outFileSize);
+
+/* Mapeia o bake da seed. NULL se ausente, corrompido ou desatualizado
+ * (versão diferente ou amostras que não batem mais com o gerador atual). */
+SeedBake* SeedBake_Open(const char* directory, uint64_t worldSeed);
+
+void SeedBake_Close(SeedBake* bake);
+
+/* Preenche o chunk (chunkX/chunkZ do próprio Chunk) a partir do bake.
+ * false se estiver fora da pista ou o blob for inválido (chunk volta a ficar vazio). */
+bool SeedBake_LoadChunk(const SeedBake* bake, Chunk* chunk);
+
+#endif /* SEED_BAKE_H */
@@ -7,6 +7,12 @@
 #include "event_system.h"
 #include "structure_spawner.h"
 
+/* Extensão da pista em voxel chunks (16 m): X -32..31 (mundo -500..+500 m), Z 0..249 (0..4000 m).
+ * CHUNK_SIZE_Z vem de chunk.h (expande no uso). */
+#define VOXEL_WORLD_MIN_CHUNK_X   (-32)
+#define VOXEL_WORLD_MAX_CHUNK_X   31
+#define VOXEL_WORLD_CHUNK_ROWS    (CHUNKS_LONG * CHUNK_SIZE_M / CHUNK_SIZE_Z)
+
 // Forward declarations
 typedef struct Chunk Chunk;
 typedef struct VoxelWorld VoxelWorld;
@@ -40,6 +46,16 @@ void VoxelWorld_Destroy(VoxelWorld* world);
 // Define a seed global (string)
 void VoxelWorld_SetSeed(VoxelWorld* world, const char* seedString);
 
+/* Liga a persistência em <saveRoot>/<seed hex>: chunks editados são salvos em region files
+ * (thread de I/O) ao descarregar, periodicamente e no Destroy; ao carregar, a edição salva
+ * substitui o gerado. Retorna false se não conseguir criar o diretório/thread. */
+bool VoxelWorld_EnablePersistence(VoxelWorld* world, const char* saveRoot);
+
+/* Serve chunks do bake <bakeDir>/<seed hex>.btdb (ver seed_bake.h) em vez de gerar.
+ * Reaberto a cada SetSeed. Retorna false se o bake estiver ausente/desatualizado
+ * (o mundo continua gerando ao vivo). */
+bool VoxelWorld_UseSeedBake(VoxelWorld* world, const char* bakeDir);
+
 // Retorna a seed global como uint64
 uint64_t VoxelWorld_GetSeedU64(VoxelWorld* world);
 
@@ -47,6 +63,20 @@ uint64_t VoxelWorld_GetSeedU64(VoxelWorld* world);
 // Cria o chunk se não existir (streaming)
 Chunk* VoxelWorld_GetChunk(VoxelWorld* world, int32_t chunkX, int32_t chunkZ);
 
+/* Leitura concorrente (renderer, colisão, workers em outras threads):
+ *     int32_t guard = VoxelWorld_ReadBegin();
+ *     ... VoxelWorld_FindChunk / VoxelWorld_GetBlock / Chunk_GetBlock ...
+ *     VoxelWorld_ReadEnd(guard);
+ * Lookups são lock-free; um chunk descarregado nesse meio tempo só é liberado depois
+ * que todos os leitores que podiam vê-lo saírem (reclamação por épocas).
+ * Criar/descarregar/editar chunks continua exclusivo de uma thread só, a dona do mundo
+ * (a principal, ou a da simulação quando ela faz o streaming). */
+int32_t VoxelWorld_ReadBegin(void);
+void VoxelWorld_ReadEnd(int32_t guard);
+
+// Retorna o chunk se estiver carregado (não cria; seguro para leitores concorrentes)
+Chunk* VoxelWorld_FindChunk(const VoxelWorld* world, int32_t chunkX, int32_t chunkZ);
+
 // Descarrega um chunk (libera memória)
 void VoxelWorld_UnloadChunk(VoxelWorld* world, int32_t chunkX, int32_t chunkZ);
 
@@ -74,10 +104,24 @@ typedef struct ChunkGenContext {
     float threatLevel;
 } ChunkGenContext;
 
+/* Monta o contexto de geração do voxel chunk (chunkX, chunkZ) — o mesmo que o streaming usa.
+ * Permite regenerar qualquer chunk fora do streaming (codec, persistência, ferramentas). */
+void VoxelWorld_BuildGenContext(const VoxelWorld* world, int32_t chunkX, int32_t chunkZ, ChunkGenContext* outCtx);
+
+/* Idem, só a partir da seed (uso em outras threads, sem tocar no VoxelWorld). */
+void VoxelWorld_BuildGenContextForSeed(uint64_t worldSeed, int32_t chunkX, int32_t chunkZ, ChunkGenContext* outCtx);
+
 /* Gera o conteúdo do chunk com base no contexto (chão, corredor navegável, borda mortal). */
 void VoxelWorld_GenerateChunk(VoxelWorld* vw, Chunk* c, const ChunkGenContext* ctx);
 
 // Retorna estatísticas do mundo
 void VoxelWorld_GetStats(VoxelWorld* world, int32_t* loadedChunks, int32_t* generatingChunks);
 
+// Versão do conteúdo: muda a cada chunk carregado, descarregado ou bloco editado (qualquer thread)
+uint32_t VoxelWorld_GetVersion(const VoxelWorld* world);
+
+/* Deduplicação de seções (global: seções são compartilhadas entre VoxelWorlds).
+ * referenced = seções apontadas por chunks; stored = cópias em memória; ratio = referenced / stored. */
+void VoxelWorld_GetSectionStats(int32_t* referencedSections, int32_t* storedSections, float* dedupRatio);
+
 #endif // VOXEL_WORLD_H
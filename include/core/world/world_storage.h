@@ -0,0 +1,58 @@
+#ifndef WORLD_STORAGE_H
+#define WORLD_STORAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ============================================================================
+ * WORLD STORAGE — persistência de chunks editados em region files
+ * Só chunks diferentes do que a seed gera vão para disco; o resto é
+ * regenerado. Toda leitura/gravação de arquivo roda numa thread de I/O:
+ * a thread principal só enfileira (SaveChunk / PrefetchRegion) e consulta
+ * o que já está em memória (LoadChunk / PollLoadedRegions).
+ *
+ * Layout: <raiz>/<seed em hex>/r.<rx>.<rz>.btdr
+ * ============================================================================ */
+
+typedef struct Chunk Chunk;
+typedef struct WorldStorage WorldStorage;
+
+typedef enum {
+    STORAGE_CHUNK_PRISTINE = 0,  /* Sem edição salva: gerar pela seed */
+    STORAGE_CHUNK_EDITED,        /* Conteúdo salvo copiado para o chunk */
+    STORAGE_CHUNK_PENDING        /* Região ainda não está em memória (prefetch enfileirado) */
+} StorageChunkStatus;
+
+typedef struct WorldStorageStats {
+    int32_t pendingSaves;        /* Chunks aguardando a thread de I/O */
+    int32_t residentRegions;     /* Regiões em memória */
+    int32_t regionReads;
+    int32_t regionWrites;
+    int32_t chunksStored;        /* Chunks editados gravados */
+    int32_t chunksPristine;      /* Saves descartados por serem iguais ao gerado */
+} WorldStorageStats;
+
+/* Cria o storage da seed em <saveRoot>/<seed hex> e inicia a thread de I/O. NULL em falha. */
+WorldStorage* WorldStorage_Create(const char* saveRoot, uint64_t worldSeed);
+
+/* Processa todos os saves pendentes, grava regiões sujas e encerra a thread. */
+void WorldStorage_Destroy(WorldStorage* storage);
+
+/* Enfileira a leitura da região (rx, rz) se ela não estiver em memória. */
+void WorldStorage_PrefetchRegion(WorldStorage* storage, int32_t regionX, int32_t regionZ);
+
+/* Enfileira o chunk codificado (chunk_codec). Assume a posse de `blob` (malloc). */
+void WorldStorage_SaveChunk(WorldStorage* storage, int32_t chunkX, int32_t chunkZ, uint8_t* blob, uint32_t size);
+
+/* Consulta o chunk (chunkX/chunkZ do próprio Chunk). Se houver edição salva, copia para o chunk.
+ * Não bloqueia em disco: região ausente → PENDING e prefetch. */
+StorageChunkStatus WorldStorage_LoadChunk(WorldStorage* storage, Chunk* chunk);
+
+/* true se alguma região terminou de carregar desde a última chamada
+ * (hora de consultar de novo os chunks que receberam PENDING). */
+bool WorldStorage_PollRegionsLoaded(WorldStorage* storage);
+
+void WorldStorage_GetStats(WorldStorage* storage, WorldStorageStats* outStats);
+
+#endif /* WORLD_STORAGE_H */
@@ -0,0 +1,81 @@
+#include "app/render/dynamic_resolution.h"
+#include <string.h>
+
+void DynamicResolution_Init(DynamicResolution* dr, float targetFrameTime) {
+    if (!dr) return;
+    memset(dr, 0, sizeof(*dr));
+    dr->scale = DYNRES_MAX_SCALE;
+    dr->targetFrameTime = (targetFrameTime > 0.0f) ? targetFrameTime : (1.0f / 60.0f);
+    dr->probeFrames = DYNRES_PROBE_FRAMES;
+    dr->enabled = true;
+}
+
+void DynamicResolution_SetEnabled(DynamicResolution* dr, bool enabled) {
+    if (!dr) return;
+    dr->enabled = enabled;
+    if (!enabled) dr->scale = DYNRES_MAX_SCALE;
+    dr->overFrames = 0;
+    dr->stableFrames = 0;
+    dr->probing = false;
+}
+
+static void ChangeScale(DynamicResolution* dr, float scale) {
+    if (scale < DYNRES_MIN_SCALE) scale = DYNRES_MIN_SCALE;
+    if (scale > DYNRES_MAX_SCALE) scale = DYNRES_MAX_SCALE;
+    dr->scale = scale;
+    dr->cooldown = DYNRES_COOLDOWN_FRAMES;
+    dr->overFrames = 0;
+    dr->stableFrames = 0;
+    // A média veio da escala anterior: recomeça perto do orçamento
+    dr->averageFrameTime = dr->targetFrameTime;
+}
+
+bool DynamicResolution_Update(DynamicResolution* dr, float frameTime) {
+    if (!dr || !dr->enabled) return false;
+    if (frameTime <= 0.0f || frameTime > DYNRES_MAX_FRAME_TIME) return false;
+
+    dr->averageFrameTime = (dr->averageFrameTime > 0.0f)
+        ? dr->averageFrameTime + (frameTime - dr->averageFrameTime) * DYNRES_SMOOTHING
+        : frameTime;
+    if (dr->cooldown > 0) {
+        dr->cooldown--;
+        return false;
+    }
+
+    float budget = dr->targetFrameTime;
+    float average = dr->averageFrameTime;
+    float oldScale = dr->scale;
+
+    if (average > budget * DYNRES_OVER_BUDGET) {
+        dr->stableFrames = 0;
+        if (++dr->overFrames >= DYNRES_OVER_FRAMES && dr->scale > DYNRES_MIN_SCALE) {
+            if (dr->probing) {      // A subida não coube: espera mais antes de tentar de novo
+                dr->probeFrames *= 2;
+                if (dr->probeFrames > DYNRES_MAX_PROBE_FRAMES) dr->probeFrames = DYNRES_MAX_PROBE_FRAMES;
+            }
+            dr->probing = false;
+            ChangeScale(dr, dr->scale - DYNRES_STEP);
+        }
+    } else if (average <= budget * DYNRES_AT_BUDGET) {
+        dr->overFrames = 0;
+        // Sobra de verdade (FPS sem trava) conta mais rápido que o frame só travado no orçamento
+        dr->stableFrames += (average < budget * DYNRES_UNDER_BUDGET) ? 4 : 1;
+        if (dr->stableFrames >= dr->probeFrames) {
+            if (dr->probing) {      // Sonda anterior confirmada: a próxima espera menos
+                dr->probeFrames /= 2;
+                if (dr->probeFrames < DYNRES_PROBE_FRAMES) dr->probeFrames = DYNRES_PROBE_FRAMES;
+                dr->probing = false;
+            }
+            if (dr->scale < DYNRES_MAX_SCALE) {
+                ChangeScale(dr, dr->scale + DYNRES_STEP);
+                dr->probing = true;
+            } else {
+                dr->stableFrames = 0;
+            }
+        }
+    } else {
+        // Entre os limiares: mantém (histerese)
+        dr->overFrames = 0;
+    }
+    return dr->scale != oldScale;
+}
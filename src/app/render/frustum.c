@@ -1,5 +1,16 @@
 #include "app/render/frustum.h"
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Caminho SIMD do culling em lote (decidido na compilação)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define FRUSTUM_BATCH_AVX
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define FRUSTUM_BATCH_SSE
+#endif
 
 // ============================================================================
 // CONSTANTES
@@ -29,89 +40,70 @@ static float Plane_DistanceToPoint(const Plane* plane, Vec3 point) {
 // CÁLCULO DO FRUSTUM
 // ============================================================================
 
-void Frustum_Calculate(Frustum* frustum,
-                      Vec3 camPos, Vec3 camForward, Vec3 camUp,
-                      float fovY, float aspect, float near, float far) {
-    if (!frustum) return;
-    
-    // Clamp far a 15m + margem
-    if (far > MAX_FAR_DIST) {
-        far = MAX_FAR_DIST;
-    }
-    frustum->farDist = far + ANTI_POP_MARGIN;
+// Plano lateral pela câmera contendo a aresta `edge` e o eixo `axis`, com a normal
+// voltada para dentro (para o lado do forward)
+static Plane Frustum_SidePlane(Vec3 camPos, Vec3 camForward, Vec3 edge, Vec3 axis) {
+    Vec3 normal = Vec3_Normalize(Vec3_Cross(edge, axis));
+    if (Vec3_Dot(normal, camForward) < 0.0f) normal = Vec3_Scale(normal, -1.0f);
+    Plane plane = {normal, -Vec3_Dot(normal, camPos)};
+    return plane;
+}
+
+// Monta os 6 planos (far já decidido por quem chama)
+static void Frustum_Build(Frustum* frustum,
+                          Vec3 camPos, Vec3 camForward, Vec3 camUp,
+                          float fovY, float aspect, float near, float far) {
     frustum->camPos = camPos;
     
-    // Calcula right vector (right-handed)
+    // Base ortonormal (o up da câmera pode não ser perpendicular ao forward com pitch/roll)
     Vec3 right = Vec3_Normalize(Vec3_Cross(camForward, camUp));
+    Vec3 up = Vec3_Cross(right, camForward);
     
-    // Calcula dimensões do frustum no plano near
-    float nearHeight = 2.0f * tanf(fovY * 0.5f) * near;
-    float nearWidth = nearHeight * aspect;
+    // Meia abertura por unidade de distância
+    float halfHeight = tanf(fovY * 0.5f);
+    float halfWidth = halfHeight * aspect;
     
-    // Centro do plano near
     Vec3 nearCenter = Vec3_Add(camPos, Vec3_Scale(camForward, near));
-    
-    // Cantos do plano near
-    Vec3 nearTop = Vec3_Add(nearCenter, Vec3_Scale(camUp, nearHeight * 0.5f));
-    Vec3 nearBottom = Vec3_Sub(nearCenter, Vec3_Scale(camUp, nearHeight * 0.5f));
-    Vec3 nearLeft = Vec3_Sub(nearCenter, Vec3_Scale(right, nearWidth * 0.5f));
-    Vec3 nearRight = Vec3_Add(nearCenter, Vec3_Scale(right, nearWidth * 0.5f));
-    
-    // Centro do plano far
     Vec3 farCenter = Vec3_Add(camPos, Vec3_Scale(camForward, far));
     
-    // Dimensões do plano far
-    float farHeight = 2.0f * tanf(fovY * 0.5f) * far;
-    float farWidth = farHeight * aspect;
-    
-    // Cantos do plano far
-    Vec3 farTop = Vec3_Add(farCenter, Vec3_Scale(camUp, farHeight * 0.5f));
-    Vec3 farBottom = Vec3_Sub(farCenter, Vec3_Scale(camUp, farHeight * 0.5f));
-    Vec3 farLeft = Vec3_Sub(farCenter, Vec3_Scale(right, farWidth * 0.5f));
-    Vec3 farRight = Vec3_Add(farCenter, Vec3_Scale(right, farWidth * 0.5f));
-    
-    // Calcula planos
-    
-    // Near plane
+    // Near / far
     frustum->planes[PLANE_NEAR].normal = camForward;
     frustum->planes[PLANE_NEAR].d = -Vec3_Dot(camForward, nearCenter);
-    
-    // Far plane
     Vec3 farNormal = Vec3_Scale(camForward, -1.0f);
     frustum->planes[PLANE_FAR].normal = farNormal;
     frustum->planes[PLANE_FAR].d = -Vec3_Dot(farNormal, farCenter);
     
-    // Left plane (usa 3 pontos: camPos, nearLeft, farLeft)
-    Vec3 leftNormal = Vec3_Normalize(Vec3_Cross(
-        Vec3_Sub(nearLeft, camPos),
-        Vec3_Sub(farLeft, camPos)
-    ));
-    frustum->planes[PLANE_LEFT].normal = leftNormal;
-    frustum->planes[PLANE_LEFT].d = -Vec3_Dot(leftNormal, camPos);
-    
-    // Right plane
-    Vec3 rightNormal = Vec3_Normalize(Vec3_Cross(
-        Vec3_Sub(farRight, camPos),
-        Vec3_Sub(nearRight, camPos)
-    ));
-    frustum->planes[PLANE_RIGHT].normal = rightNormal;
-    frustum->planes[PLANE_RIGHT].d = -Vec3_Dot(rightNormal, camPos);
-    
-    // Top plane
-    Vec3 topNormal = Vec3_Normalize(Vec3_Cross(
-        Vec3_Sub(nearTop, camPos),
-        Vec3_Sub(farTop, camPos)
-    ));
-    frustum->planes[PLANE_TOP].normal = topNormal;
-    frustum->planes[PLANE_TOP].d = -Vec3_Dot(topNormal, camPos);
-    
-    // Bottom plane
-    Vec3 bottomNormal = Vec3_Normalize(Vec3_Cross(
-        Vec3_Sub(farBottom, camPos),
-        Vec3_Sub(nearBottom, camPos)
-    ));
-    frustum->planes[PLANE_BOTTOM].normal = bottomNormal;
-    frustum->planes[PLANE_BOTTOM].d = -Vec3_Dot(bottomNormal, camPos);
+    // Laterais: passam pela câmera e contêm a aresta do meio de cada lado da pirâmide
+    // (a aresta sozinha não define o plano: o segundo eixo é o up ou o right)
+    Vec3 leftEdge = Vec3_Sub(camForward, Vec3_Scale(right, halfWidth));
+    Vec3 rightEdge = Vec3_Add(camForward, Vec3_Scale(right, halfWidth));
+    Vec3 topEdge = Vec3_Add(camForward, Vec3_Scale(up, halfHeight));
+    Vec3 bottomEdge = Vec3_Sub(camForward, Vec3_Scale(up, halfHeight));
+    frustum->planes[PLANE_LEFT] = Frustum_SidePlane(camPos, camForward, leftEdge, up);
+    frustum->planes[PLANE_RIGHT] = Frustum_SidePlane(camPos, camForward, rightEdge, up);
+    frustum->planes[PLANE_TOP] = Frustum_SidePlane(camPos, camForward, topEdge, right);
+    frustum->planes[PLANE_BOTTOM] = Frustum_SidePlane(camPos, camForward, bottomEdge, right);
+}
+
+void Frustum_Calculate(Frustum* frustum,
+                      Vec3 camPos, Vec3 camForward, Vec3 camUp,
+                      float fovY, float aspect, float near, float far) {
+    if (!frustum) return;
+    
+    // Clamp far a 15m + margem
+    if (far > MAX_FAR_DIST) {
+        far = MAX_FAR_DIST;
+    }
+    frustum->farDist = far + ANTI_POP_MARGIN;
+    Frustum_Build(frustum, camPos, camForward, camUp, fovY, aspect, near, far);
+}
+
+void Frustum_CalculateUnclamped(Frustum* frustum,
+                                Vec3 camPos, Vec3 camForward, Vec3 camUp,
+                                float fovY, float aspect, float near, float far) {
+    if (!frustum) return;
+    frustum->farDist = far + ANTI_POP_MARGIN;
+    Frustum_Build(frustum, camPos, camForward, camUp, fovY, aspect, near, far);
 }
 
 // ============================================================================
@@ -192,3 +184,217 @@ bool Frustum_ShouldRenderChunk(const Frustum* frustum, Vec3 chunkCenter, Vec3 ch
     
     return true; // Dentro do frustum e dentro da distância
 }
+
+// ============================================================================
+// CULLING EM LOTE (SoA)
+// ============================================================================
+
+// Plano pronto para o lote: o sinal da normal escolhe, uma vez por plano, qual array
+// dá o vértice mais à frente (p: teste de fora) e o mais atrás (q: teste de dentro)
+typedef struct {
+    float nx, ny, nz, d;
+    const float* px;
+    const float* py;
+    const float* pz;
+    const float* qx;
+    const float* qy;
+    const float* qz;
+} BatchPlane;
+
+static void Frustum_PrepareBatchPlanes(const Frustum* frustum, const FrustumAABBBatch* batch, BatchPlane planes[6]) {
+    for (int i = 0; i < 6; i++) {
+        const Plane* plane = &frustum->planes[i];
+        BatchPlane* bp = &planes[i];
+        bp->nx = plane->normal.x;
+        bp->ny = plane->normal.y;
+        bp->nz = plane->normal.z;
+        bp->d = plane->d;
+        bp->px = (plane->normal.x < 0.0f) ? batch->minX : batch->maxX;
+        bp->py = (plane->normal.y < 0.0f) ? batch->minY : batch->maxY;
+        bp->pz = (plane->normal.z < 0.0f) ? batch->minZ : batch->maxZ;
+        bp->qx = (plane->normal.x < 0.0f) ? batch->maxX : batch->minX;
+        bp->qy = (plane->normal.y < 0.0f) ? batch->maxY : batch->minY;
+        bp->qz = (plane->normal.z < 0.0f) ? batch->maxZ : batch->minZ;
+    }
+}
+
+bool FrustumAABBBatch_Init(FrustumAABBBatch* batch, int32_t capacity) {
+    if (!batch) return false;
+    memset(batch, 0, sizeof(*batch));
+    if (capacity < 1) capacity = 1;
+    capacity = (capacity + 7) & ~7;
+    
+    // Zerado: as pistas além de `count` no último grupo leem valores válidos
+    float* data = (float*)calloc((size_t)capacity * 6, sizeof(float));
+    if (!data) return false;
+    batch->minX = data;
+    batch->minY = data + capacity;
+    batch->minZ = data + capacity * 2;
+    batch->maxX = data + capacity * 3;
+    batch->maxY = data + capacity * 4;
+    batch->maxZ = data + capacity * 5;
+    batch->capacity = capacity;
+    return true;
+}
+
+void FrustumAABBBatch_Destroy(FrustumAABBBatch* batch) {
+    if (!batch) return;
+    free(batch->minX);
+    memset(batch, 0, sizeof(*batch));
+}
+
+#if defined(FRUSTUM_BATCH_AVX)
+
+static int32_t Frustum_CullBatchSimd(const BatchPlane planes[6], int32_t count,
+                                     uint32_t* visibleMask, uint32_t* insideMask) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 allLanes = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    __m256 n[6][4];
+    for (int p = 0; p < 6; p++) {
+        n[p][0] = _mm256_set1_ps(planes[p].nx);
+        n[p][1] = _mm256_set1_ps(planes[p].ny);
+        n[p][2] = _mm256_set1_ps(planes[p].nz);
+        n[p][3] = _mm256_set1_ps(planes[p].d);
+    }
+    
+    int32_t visible = 0;
+    for (int32_t i = 0; i < count; i += 8) {
+        __m256 in = allLanes;
+        __m256 fully = allLanes;
+        for (int p = 0; p < 6; p++) {
+            const BatchPlane* bp = &planes[p];
+            __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(n[p][0], _mm256_loadu_ps(bp->px + i)),
+                _mm256_mul_ps(n[p][1], _mm256_loadu_ps(bp->py + i))),
+                _mm256_mul_ps(n[p][2], _mm256_loadu_ps(bp->pz + i))), n[p][3]);
+            in = _mm256_and_ps(in, _mm256_cmp_ps(dist, zero, _CMP_GE_OQ));
+            if (_mm256_movemask_ps(in) == 0) break;   // Grupo inteiro fora
+            if (insideMask) {
+                __m256 back = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                    _mm256_mul_ps(n[p][0], _mm256_loadu_ps(bp->qx + i)),
+                    _mm256_mul_ps(n[p][1], _mm256_loadu_ps(bp->qy + i))),
+                    _mm256_mul_ps(n[p][2], _mm256_loadu_ps(bp->qz + i))), n[p][3]);
+                fully = _mm256_and_ps(fully, _mm256_cmp_ps(back, zero, _CMP_GE_OQ));
+            }
+        }
+        uint32_t lanes = (uint32_t)_mm256_movemask_ps(in);
+        uint32_t inside = lanes & (uint32_t)_mm256_movemask_ps(fully);
+        if (count - i < 8) {
+            uint32_t valid = (1u << (count - i)) - 1u;
+            lanes &= valid;
+            inside &= valid;
+        }
+        visibleMask[i >> 5] |= lanes << (i & 31);
+        if (insideMask) insideMask[i >> 5] |= inside << (i & 31);
+        visible += __builtin_popcount(lanes);
+    }
+    return visible;
+}
+
+#elif defined(FRUSTUM_BATCH_SSE)
+
+static int32_t Frustum_CullBatchSimd(const BatchPlane planes[6], int32_t count,
+                                     uint32_t* visibleMask, uint32_t* insideMask) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 allLanes = _mm_cmpeq_ps(zero, zero);
+    __m128 n[6][4];
+    for (int p = 0; p < 6; p++) {
+        n[p][0] = _mm_set1_ps(planes[p].nx);
+        n[p][1] = _mm_set1_ps(planes[p].ny);
+        n[p][2] = _mm_set1_ps(planes[p].nz);
+        n[p][3] = _mm_set1_ps(planes[p].d);
+    }
+    
+    int32_t visible = 0;
+    for (int32_t i = 0; i < count; i += 4) {
+        __m128 in = allLanes;
+        __m128 fully = allLanes;
+        for (int p = 0; p < 6; p++) {
+            const BatchPlane* bp = &planes[p];
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(n[p][0], _mm_loadu_ps(bp->px + i)),
+                _mm_mul_ps(n[p][1], _mm_loadu_ps(bp->py + i))),
+                _mm_mul_ps(n[p][2], _mm_loadu_ps(bp->pz + i))), n[p][3]);
+            in = _mm_and_ps(in, _mm_cmpge_ps(dist, zero));
+            if (_mm_movemask_ps(in) == 0) break;   // Grupo inteiro fora
+            if (insideMask) {
+                __m128 back = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(n[p][0], _mm_loadu_ps(bp->qx + i)),
+                    _mm_mul_ps(n[p][1], _mm_loadu_ps(bp->qy + i))),
+                    _mm_mul_ps(n[p][2], _mm_loadu_ps(bp->qz + i))), n[p][3]);
+                fully = _mm_and_ps(fully, _mm_cmpge_ps(back, zero));
+            }
+        }
+        uint32_t lanes = (uint32_t)_mm_movemask_ps(in);
+        uint32_t inside = lanes & (uint32_t)_mm_movemask_ps(fully);
+        if (count - i < 4) {
+            uint32_t valid = (1u << (count - i)) - 1u;
+            lanes &= valid;
+            inside &= valid;
+        }
+        visibleMask[i >> 5] |= lanes << (i & 31);
+        if (insideMask) insideMask[i >> 5] |= inside << (i & 31);
+        visible += __builtin_popcount(lanes);
+    }
+    return visible;
+}
+
+#endif
+
+int32_t Frustum_CullAABBBatchScalar(const Frustum* frustum, const FrustumAABBBatch* batch,
+                                    uint32_t* visibleMask, uint32_t* insideMask) {
+    if (!frustum || !batch || !visibleMask) return 0;
+    size_t maskBytes = (size_t)FRUSTUM_MASK_WORDS(batch->count) * sizeof(uint32_t);
+    memset(visibleMask, 0, maskBytes);
+    if (insideMask) memset(insideMask, 0, maskBytes);
+    
+    BatchPlane planes[6];
+    Frustum_PrepareBatchPlanes(frustum, batch, planes);
+    int32_t visible = 0;
+    for (int32_t i = 0; i < batch->count; i++) {
+        bool in = true;
+        bool fully = true;
+        for (int p = 0; p < 6; p++) {
+            const BatchPlane* bp = &planes[p];
+            float dist = bp->nx * bp->px[i] + bp->ny * bp->py[i] + bp->nz * bp->pz[i] + bp->d;
+            if (dist < 0.0f) {
+                in = false;
+                break;
+            }
+            if (fully && bp->nx * bp->qx[i] + bp->ny * bp->qy[i] + bp->nz * bp->qz[i] + bp->d < 0.0f) {
+                fully = false;
+            }
+        }
+        if (!in) continue;
+        visibleMask[i >> 5] |= 1u << (i & 31);
+        if (insideMask && fully) insideMask[i >> 5] |= 1u << (i & 31);
+        visible++;
+    }
+    return visible;
+}
+
+int32_t Frustum_CullAABBBatch(const Frustum* frustum, const FrustumAABBBatch* batch,
+                              uint32_t* visibleMask, uint32_t* insideMask) {
+#if defined(FRUSTUM_BATCH_AVX) || defined(FRUSTUM_BATCH_SSE)
+    if (!frustum || !batch || !visibleMask) return 0;
+    size_t maskBytes = (size_t)FRUSTUM_MASK_WORDS(batch->count) * sizeof(uint32_t);
+    memset(visibleMask, 0, maskBytes);
+    if (insideMask) memset(insideMask, 0, maskBytes);
+    
+    BatchPlane planes[6];
+    Frustum_PrepareBatchPlanes(frustum, batch, planes);
+    return Frustum_CullBatchSimd(planes, batch->count, visibleMask, insideMask);
+#else
+    return Frustum_CullAABBBatchScalar(frustum, batch, visibleMask, insideMask);
+#endif
+}
+
+const char* Frustum_BatchPathName(void) {
+#if defined(FRUSTUM_BATCH_AVX)
+    return "AVX";
+#elif defined(FRUSTUM_BATCH_SSE)
+    return "SSE";
+#else
+    return "escalar";
+#endif
+}
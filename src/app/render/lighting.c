@@ -21,6 +21,10 @@ static Vector3 Vec3_Normalize(Vector3 v) {
     return (Vector3){0.0f, 0.0f, 0.0f};
 }
 
+static bool Color_Equals(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
 void Lighting_Init(LightingSystem* lighting) {
     if (!lighting) return;
     
@@ -34,6 +38,7 @@ void Lighting_Init(LightingSystem* lighting) {
     lighting->sunLight.ambientIntensity = 0.3f;                   // 30% de ambiente
     lighting->sunLight.enabled = true;
     
+    lighting->version = 1;
     lighting->initialized = true;
 }
 
@@ -47,19 +52,25 @@ void Lighting_SetDirectionalLight(LightingSystem* lighting,
                                    Color ambientColor, float intensity, float ambientIntensity) {
     if (!lighting || !lighting->initialized) return;
     
-    lighting->sunLight.direction = Vec3_Normalize(direction);
+    DirectionalLight* sun = &lighting->sunLight;
+    direction = Vec3_Normalize(direction);
+    if (direction.x == sun->direction.x && direction.y == sun->direction.y && direction.z == sun->direction.z &&
+        Color_Equals(lightColor, sun->lightColor) &&
+        Color_Equals(ambientColor, sun->ambientColor) &&
+        intensity == sun->intensity && ambientIntensity == sun->ambientIntensity) {
+        return; // Mesma luz: nada para reassar
+    }
+    
+    lighting->sunLight.direction = direction;
     lighting->sunLight.lightColor = lightColor;
     lighting->sunLight.ambientColor = ambientColor;
     lighting->sunLight.intensity = intensity;
     lighting->sunLight.ambientIntensity = ambientIntensity;
+    lighting->version++;
 }
 
-Color Lighting_ApplyDirectionalLight(LightingSystem* lighting,
-                                     Vector3 normal, Color baseColor) {
-    if (!lighting || !lighting->initialized || !lighting->sunLight.enabled) {
-        return baseColor;
-    }
-
+// Fator escalar da luz para uma normal (1.0 = cor cheia)
+static float Lighting_ComputeFactor(const LightingSystem* lighting, Vector3 normal) {
     Vector3 faceNormal = Vec3_Normalize(normal);
     /* Wrap: ndl = dot(n,l)*0.5+0.5, clamp; factor = 0.6+0.4*ndl; color *= factor (uma vez). */
     float ndl = Vec3_Dot(faceNormal, lighting->sunLight.direction) * 0.5f + 0.5f;
@@ -73,7 +84,16 @@ Color Lighting_ApplyDirectionalLight(LightingSystem* lighting,
     if (hemi < 0.0f) hemi = 0.0f;
     if (hemi > 1.0f) hemi = 1.0f;
     float hemiFactor = 0.5f + 0.5f * hemi;
-    factor *= hemiFactor;
+    return factor * hemiFactor;
+}
+
+Color Lighting_ApplyDirectionalLight(LightingSystem* lighting,
+                                     Vector3 normal, Color baseColor) {
+    if (!lighting || !lighting->initialized || !lighting->sunLight.enabled) {
+        return baseColor;
+    }
+
+    float factor = Lighting_ComputeFactor(lighting, normal);
 
     float r = (float)baseColor.r * factor;
     float g = (float)baseColor.g * factor;
@@ -93,6 +113,21 @@ Color Lighting_ApplyDirectionalLight(LightingSystem* lighting,
     return result;
 }
 
+uint32_t Lighting_GetFaceLight(LightingSystem* lighting, uint8_t faceLight[LIGHTING_FACE_COUNT]) {
+    static const Vector3 normals[LIGHTING_FACE_COUNT] = {
+        {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f}
+    };
+    bool lit = lighting && lighting->initialized && lighting->sunLight.enabled;
+    for (int i = 0; i < LIGHTING_FACE_COUNT; i++) {
+        float factor = lit ? Lighting_ComputeFactor(lighting, normals[i]) : 1.0f;
+        if (factor > 1.0f) factor = 1.0f;
+        if (factor < 0.0f) factor = 0.0f;
+        faceLight[i] = (uint8_t)(factor * 255.0f + 0.5f);
+    }
+    return lighting ? lighting->version : 0;
+}
+
 Vector3 Lighting_GetLightDirection(LightingSystem* lighting) {
     if (!lighting || !lighting->initialized) {
         return (Vector3){0.0f, -1.0f, 0.0f}; // Direção padrão (de cima)
@@ -102,5 +137,7 @@ Vector3 Lighting_GetLightDirection(LightingSystem* lighting) {
 
 void Lighting_SetEnabled(LightingSystem* lighting, bool enabled) {
     if (!lighting || !lighting->initialized) return;
+    if (lighting->sunLight.enabled == enabled) return;
     lighting->sunLight.enabled = enabled;
+    lighting->version++;
 }
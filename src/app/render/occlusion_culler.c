@@ -0,0 +1,239 @@
+#include "app/render/occlusion_culler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Polígono do quad depois do recorte no near: até 5 vértices
+#define OCCLUSION_MAX_CLIPPED 8
+
+// Vértice na tela: posição em texels e 1/z de vista
+typedef struct {
+    float x, y, invZ;
+} ScreenVertex;
+
+bool OcclusionCuller_Init(OcclusionCuller* culler) {
+    if (!culler) return false;
+    memset(culler, 0, sizeof(*culler));
+
+    size_t total = 0;
+    int32_t w = OCCLUSION_WIDTH, h = OCCLUSION_HEIGHT;
+    for (int32_t i = 0; i < OCCLUSION_MIP_COUNT; i++) {
+        culler->widths[i] = w;
+        culler->heights[i] = h;
+        total += (size_t)w * (size_t)h;
+        w = (w > 1) ? w / 2 : 1;
+        h = (h > 1) ? h / 2 : 1;
+    }
+    float* data = (float*)calloc(total, sizeof(float));
+    if (!data) return false;
+    for (int32_t i = 0; i < OCCLUSION_MIP_COUNT; i++) {
+        culler->levels[i] = data;
+        data += (size_t)culler->widths[i] * (size_t)culler->heights[i];
+    }
+    return true;
+}
+
+void OcclusionCuller_Destroy(OcclusionCuller* culler) {
+    if (!culler) return;
+    free(culler->levels[0]);
+    memset(culler, 0, sizeof(*culler));
+}
+
+void OcclusionCuller_Begin(OcclusionCuller* culler, const OcclusionView* view) {
+    if (!culler || !culler->levels[0] || !view) return;
+    memset(culler->levels[0], 0, (size_t)OCCLUSION_WIDTH * OCCLUSION_HEIGHT * sizeof(float));
+
+    // Base ortonormal como no Frustum (up da câmera pode não ser perpendicular)
+    culler->position = view->position;
+    culler->forward = view->forward;
+    culler->right = Vec3_Normalize(Vec3_Cross(view->forward, view->up));
+    culler->up = Vec3_Cross(culler->right, view->forward);
+    float halfHeight = tanf(view->fovY * 0.5f);
+    culler->scaleY = 1.0f / halfHeight;
+    culler->scaleX = 1.0f / (halfHeight * view->aspect);
+    culler->nearPlane = (view->nearPlane > 0.01f) ? view->nearPlane : 0.01f;
+    culler->pyramidReady = false;
+
+    culler->occluderQuads = 0;
+    culler->trianglesRasterized = 0;
+    culler->boxesTested = 0;
+    culler->boxesOccluded = 0;
+}
+
+// Ponto no espaço de vista: x à direita, y para cima, z ao longo do forward
+static Vec3 ToView(const OcclusionCuller* culler, Vec3 point) {
+    Vec3 d = Vec3_Sub(point, culler->position);
+    return Vec3_Make(Vec3_Dot(d, culler->right), Vec3_Dot(d, culler->up), Vec3_Dot(d, culler->forward));
+}
+
+static ScreenVertex ToScreen(const OcclusionCuller* culler, Vec3 view) {
+    float invZ = 1.0f / view.z;
+    ScreenVertex v;
+    v.x = (1.0f + view.x * culler->scaleX * invZ) * 0.5f * OCCLUSION_WIDTH;
+    v.y = (1.0f - view.y * culler->scaleY * invZ) * 0.5f * OCCLUSION_HEIGHT;
+    v.invZ = invZ;
+    return v;
+}
+
+// Triângulo com amostragem no centro do texel; guarda o 1/z mais próximo
+static void RasterizeTriangle(OcclusionCuller* culler, ScreenVertex a, ScreenVertex b, ScreenVertex c) {
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (fabsf(area) < 1e-6f) return;
+    if (area < 0.0f) {      // Orientação fixa: as arestas ficam positivas por dentro
+        ScreenVertex t = b;
+        b = c;
+        c = t;
+        area = -area;
+    }
+
+    int32_t x0 = (int32_t)floorf(fminf(a.x, fminf(b.x, c.x)));
+    int32_t x1 = (int32_t)ceilf(fmaxf(a.x, fmaxf(b.x, c.x)));
+    int32_t y0 = (int32_t)floorf(fminf(a.y, fminf(b.y, c.y)));
+    int32_t y1 = (int32_t)ceilf(fmaxf(a.y, fmaxf(b.y, c.y)));
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > OCCLUSION_WIDTH - 1) x1 = OCCLUSION_WIDTH - 1;
+    if (y1 > OCCLUSION_HEIGHT - 1) y1 = OCCLUSION_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    // Funções de aresta e(x, y) = A x + B y + C, avançando por texel
+    float invArea = 1.0f / area;
+    float a0 = b.y - c.y, b0 = c.x - b.x, c0 = b.x * c.y - b.y * c.x;   // oposta a `a`
+    float a1 = c.y - a.y, b1 = a.x - c.x, c1 = c.x * a.y - c.y * a.x;   // oposta a `b`
+    float a2 = a.y - b.y, b2 = b.x - a.x, c2 = a.x * b.y - a.y * b.x;   // oposta a `c`
+    float* depth = culler->levels[0];
+
+    for (int32_t y = y0; y <= y1; y++) {
+        float py = (float)y + 0.5f;
+        float px = (float)x0 + 0.5f;
+        float e0 = a0 * px + b0 * py + c0;
+        float e1 = a1 * px + b1 * py + c1;
+        float e2 = a2 * px + b2 * py + c2;
+        float* row = depth + y * OCCLUSION_WIDTH;
+        for (int32_t x = x0; x <= x1; x++) {
+            if (e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f) {
+                float invZ = (e0 * a.invZ + e1 * b.invZ + e2 * c.invZ) * invArea;
+                if (invZ > row[x]) row[x] = invZ;
+            }
+            e0 += a0;
+            e1 += a1;
+            e2 += a2;
+        }
+    }
+    culler->trianglesRasterized++;
+}
+
+void OcclusionCuller_AddQuad(OcclusionCuller* culler, const Vec3 corners[4]) {
+    if (!culler || !culler->levels[0] || !corners) return;
+
+    // Recorta no near (Sutherland-Hodgman num plano só): o que cruza a câmera ainda oclui
+    Vec3 in[4];
+    for (int32_t i = 0; i < 4; i++) in[i] = ToView(culler, corners[i]);
+    Vec3 clipped[OCCLUSION_MAX_CLIPPED];
+    int32_t count = 0;
+    float nearPlane = culler->nearPlane;
+    for (int32_t i = 0; i < 4; i++) {
+        Vec3 cur = in[i];
+        Vec3 next = in[(i + 1) & 3];
+        bool curIn = cur.z >= nearPlane;
+        bool nextIn = next.z >= nearPlane;
+        if (curIn) clipped[count++] = cur;
+        if (curIn != nextIn) {
+            float t = (nearPlane - cur.z) / (next.z - cur.z);
+            clipped[count++] = Vec3_Add(cur, Vec3_Scale(Vec3_Sub(next, cur), t));
+        }
+    }
+    if (count < 3) return;
+
+    ScreenVertex screen[OCCLUSION_MAX_CLIPPED];
+    for (int32_t i = 0; i < count; i++) screen[i] = ToScreen(culler, clipped[i]);
+    for (int32_t i = 1; i + 1 < count; i++) {
+        RasterizeTriangle(culler, screen[0], screen[i], screen[i + 1]);
+    }
+    culler->occluderQuads++;
+    culler->pyramidReady = false;
+}
+
+void OcclusionCuller_BuildPyramid(OcclusionCuller* culler) {
+    if (!culler || !culler->levels[0]) return;
+    for (int32_t level = 1; level < OCCLUSION_MIP_COUNT; level++) {
+        const float* src = culler->levels[level - 1];
+        int32_t srcW = culler->widths[level - 1];
+        int32_t srcH = culler->heights[level - 1];
+        float* dst = culler->levels[level];
+        int32_t w = culler->widths[level];
+        int32_t h = culler->heights[level];
+        for (int32_t y = 0; y < h; y++) {
+            int32_t sy0 = y * 2;
+            int32_t sy1 = (sy0 + 1 < srcH) ? sy0 + 1 : sy0;
+            for (int32_t x = 0; x < w; x++) {
+                int32_t sx0 = x * 2;
+                int32_t sx1 = (sx0 + 1 < srcW) ? sx0 + 1 : sx0;
+                // Mínimo de 1/z = oclusor mais distante do bloco de texels
+                float m = fminf(fminf(src[sy0 * srcW + sx0], src[sy0 * srcW + sx1]),
+                                fminf(src[sy1 * srcW + sx0], src[sy1 * srcW + sx1]));
+                dst[y * w + x] = m;
+            }
+        }
+    }
+    culler->pyramidReady = true;
+}
+
+bool OcclusionCuller_IsAABBVisible(OcclusionCuller* culler, Vec3 min, Vec3 max) {
+    if (!culler || !culler->pyramidReady) return true;
+    culler->boxesTested++;
+
+    // Projeta os 8 cantos: retângulo na tela e profundidade mais próxima da caixa
+    float sx0 = 1e30f, sy0 = 1e30f, sx1 = -1e30f, sy1 = -1e30f;
+    float nearestZ = 1e30f;
+    for (int32_t i = 0; i < 8; i++) {
+        Vec3 corner = Vec3_Make((i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y, (i & 4) ? max.z : min.z);
+        Vec3 view = ToView(culler, corner);
+        if (view.z < culler->nearPlane) return true;   // Cruza o near: não dá para decidir
+        ScreenVertex s = ToScreen(culler, view);
+        sx0 = fminf(sx0, s.x);
+        sy0 = fminf(sy0, s.y);
+        sx1 = fmaxf(sx1, s.x);
+        sy1 = fmaxf(sy1, s.y);
+        nearestZ = fminf(nearestZ, view.z);
+    }
+
+    // Um texel de folga em cada lado: o oclusor só cobre texels pelo centro
+    int32_t x0 = (int32_t)floorf(sx0) - 1;
+    int32_t y0 = (int32_t)floorf(sy0) - 1;
+    int32_t x1 = (int32_t)floorf(sx1) + 1;
+    int32_t y1 = (int32_t)floorf(sy1) + 1;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > OCCLUSION_WIDTH - 1) x1 = OCCLUSION_WIDTH - 1;
+    if (y1 > OCCLUSION_HEIGHT - 1) y1 = OCCLUSION_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return true;
+
+    // Nível em que o retângulo cabe em 4x4 texels (2x2 perde demais com o alinhamento)
+    int32_t level = 0;
+    while (level < OCCLUSION_MIP_COUNT - 1 &&
+           ((x1 >> level) - (x0 >> level) > 3 || (y1 >> level) - (y0 >> level) > 3)) {
+        level++;
+    }
+    const float* depth = culler->levels[level];
+    int32_t w = culler->widths[level];
+    int32_t h = culler->heights[level];
+    int32_t lx0 = x0 >> level, lx1 = x1 >> level;
+    int32_t ly0 = y0 >> level, ly1 = y1 >> level;
+    if (lx1 > w - 1) lx1 = w - 1;
+    if (ly1 > h - 1) ly1 = h - 1;
+
+    float farthest = 1e30f;    // Menor 1/z coberto pelo retângulo
+    for (int32_t y = ly0; y <= ly1; y++) {
+        for (int32_t x = lx0; x <= lx1; x++) {
+            farthest = fminf(farthest, depth[y * w + x]);
+        }
+    }
+    if (farthest <= 0.0f) return true;   // Algum texel sem oclusor
+
+    if (nearestZ > 1.0f / farthest + OCCLUSION_DEPTH_BIAS) {
+        culler->boxesOccluded++;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,161 @@
+#include "app/render/render_material.h"
+#include <string.h>
+
+static size_t UniformSize(MaterialUniformType type) {
+    switch (type) {
+        case MATERIAL_UNIFORM_FLOAT: return sizeof(float);
+        case MATERIAL_UNIFORM_VEC2:  return 2 * sizeof(float);
+        case MATERIAL_UNIFORM_VEC3:  return 3 * sizeof(float);
+        case MATERIAL_UNIFORM_VEC4:  return 4 * sizeof(float);
+        case MATERIAL_UNIFORM_INT:   return sizeof(int);
+        case MATERIAL_UNIFORM_MATRIX: return sizeof(Matrix);
+    }
+    return 0;
+}
+
+static void Upload(RenderMaterial* material, int loc, MaterialUniformType type, const void* value) {
+    switch (type) {
+        case MATERIAL_UNIFORM_FLOAT: SetShaderValue(material->shader, loc, value, SHADER_UNIFORM_FLOAT); break;
+        case MATERIAL_UNIFORM_VEC2:  SetShaderValue(material->shader, loc, value, SHADER_UNIFORM_VEC2); break;
+        case MATERIAL_UNIFORM_VEC3:  SetShaderValue(material->shader, loc, value, SHADER_UNIFORM_VEC3); break;
+        case MATERIAL_UNIFORM_VEC4:  SetShaderValue(material->shader, loc, value, SHADER_UNIFORM_VEC4); break;
+        case MATERIAL_UNIFORM_INT:   SetShaderValue(material->shader, loc, value, SHADER_UNIFORM_INT); break;
+        case MATERIAL_UNIFORM_MATRIX: {
+            Matrix m;
+            memcpy(&m, value, sizeof(m));
+            SetShaderValueMatrix(material->shader, loc, m);
+            break;
+        }
+    }
+    material->uploads++;
+}
+
+// ——— Blocos ———
+
+void UniformBlock_Init(UniformBlock* block) {
+    if (!block) return;
+    memset(block, 0, sizeof(*block));
+    block->version = 1;     // Materiais começam em 0: o primeiro Apply envia tudo
+}
+
+int32_t UniformBlock_AddField(UniformBlock* block, const char* name, MaterialUniformType type) {
+    if (!block || !name || block->fieldCount >= UNIFORM_BLOCK_MAX_FIELDS) return -1;
+    UniformBlockField* field = &block->fields[block->fieldCount];
+    memset(field, 0, sizeof(*field));
+    field->name = name;
+    field->type = type;
+    field->version = block->version;
+    return block->fieldCount++;
+}
+
+void UniformBlock_Set(UniformBlock* block, int32_t field, const void* value) {
+    if (!block || !value || field < 0 || field >= block->fieldCount) return;
+    UniformBlockField* f = &block->fields[field];
+    size_t size = UniformSize(f->type);
+    if (memcmp(f->value, value, size) == 0) return;
+    memcpy(f->value, value, size);
+    f->version = ++block->version;
+}
+
+void UniformBlock_SetFloat(UniformBlock* block, int32_t field, float value) {
+    UniformBlock_Set(block, field, &value);
+}
+
+void UniformBlock_SetInt(UniformBlock* block, int32_t field, int value) {
+    UniformBlock_Set(block, field, &value);
+}
+
+void UniformBlock_SetColor(UniformBlock* block, int32_t field, Color color) {
+    float v[3] = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f };
+    UniformBlock_Set(block, field, v);
+}
+
+// ——— Materiais ———
+
+static void ResetTables(RenderMaterial* material, Shader shader, bool ownsShader) {
+    memset(material, 0, sizeof(*material));
+    material->shader = shader;
+    material->ownsShader = ownsShader;
+}
+
+bool RenderMaterial_Load(RenderMaterial* material, const char* vsPath, const char* fsPath) {
+    if (!material) return false;
+    ResetTables(material, LoadShader(vsPath, fsPath), true);
+    return material->shader.id != 0;
+}
+
+void RenderMaterial_InitFromShader(RenderMaterial* material, Shader shader) {
+    if (!material) return;
+    ResetTables(material, shader, false);
+}
+
+void RenderMaterial_Unload(RenderMaterial* material) {
+    if (!material) return;
+    if (material->ownsShader && material->shader.id != 0) UnloadShader(material->shader);
+    ResetTables(material, (Shader){0}, false);
+}
+
+int32_t RenderMaterial_AddUniform(RenderMaterial* material, const char* name, MaterialUniformType type) {
+    if (!RenderMaterial_IsReady(material) || !name || material->uniformCount >= MATERIAL_MAX_UNIFORMS) return -1;
+    int loc = GetShaderLocation(material->shader, name);
+    if (loc < 0) return -1;
+    RenderMaterialUniform* u = &material->uniforms[material->uniformCount];
+    memset(u, 0, sizeof(*u));
+    u->loc = loc;
+    u->type = type;
+    return material->uniformCount++;
+}
+
+void RenderMaterial_SetUniform(RenderMaterial* material, int32_t uniform, const void* value) {
+    if (!material || !value || uniform < 0 || uniform >= material->uniformCount) return;
+    RenderMaterialUniform* u = &material->uniforms[uniform];
+    size_t size = UniformSize(u->type);
+    if (u->cached && memcmp(u->value, value, size) == 0) {
+        material->skipped++;
+        return;
+    }
+    memcpy(u->value, value, size);
+    u->cached = true;
+    Upload(material, u->loc, u->type, value);
+}
+
+void RenderMaterial_SetColor(RenderMaterial* material, int32_t uniform, Color color) {
+    float v[3] = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f };
+    RenderMaterial_SetUniform(material, uniform, v);
+}
+
+bool RenderMaterial_BindBlock(RenderMaterial* material, const UniformBlock* block) {
+    if (!RenderMaterial_IsReady(material) || !block || material->blockCount >= MATERIAL_MAX_BLOCKS) return false;
+    RenderMaterialBlockBinding* binding = &material->blocks[material->blockCount++];
+    binding->block = block;
+    binding->syncedVersion = 0;
+    for (int32_t i = 0; i < UNIFORM_BLOCK_MAX_FIELDS; i++) {
+        binding->locs[i] = (i < block->fieldCount) ? GetShaderLocation(material->shader, block->fields[i].name) : -1;
+    }
+    return true;
+}
+
+void RenderMaterial_Apply(RenderMaterial* material) {
+    if (!RenderMaterial_IsReady(material)) return;
+    for (int32_t b = 0; b < material->blockCount; b++) {
+        RenderMaterialBlockBinding* binding = &material->blocks[b];
+        const UniformBlock* block = binding->block;
+        bool synced = (binding->syncedVersion == block->version);
+        for (int32_t i = 0; i < block->fieldCount; i++) {
+            const UniformBlockField* field = &block->fields[i];
+            if (binding->locs[i] < 0) continue;
+            if (synced || field->version <= binding->syncedVersion) {
+                material->skipped++;
+                continue;
+            }
+            Upload(material, binding->locs[i], field->type, field->value);
+        }
+        binding->syncedVersion = block->version;
+    }
+}
+
+void RenderMaterial_ResetStats(RenderMaterial* material) {
+    if (!material) return;
+    material->uploads = 0;
+    material->skipped = 0;
+}
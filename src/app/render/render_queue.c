@@ -0,0 +1,146 @@
+#include "app/render/render_queue.h"
+#include <string.h>
+#if defined(USE_RLGL)
+#include <rlgl.h>
+#endif
+
+#define KEY_PASS_SHIFT 60
+#define KEY_SHADER_SHIFT 52
+#define KEY_STATE_SHIFT 44
+#define KEY_DEPTH_SHIFT 20
+#define KEY_DEPTH_MAX 0xFFFFFFu
+#define KEY_SEQUENCE_MASK 0xFFFFFu
+
+void RenderQueue_Init(RenderQueue* queue) {
+    if (!queue) return;
+    memset(queue, 0, sizeof(*queue));
+    queue->shaderCount = 1; // Slot 0: shader padrão
+}
+
+uint8_t RenderQueue_RegisterShader(RenderQueue* queue, Shader shader) {
+    if (!queue || shader.id == 0) return 0;
+    for (int32_t i = 1; i < queue->shaderCount; i++) {
+        if (queue->shaders[i].id == shader.id) {
+            queue->shaders[i] = shader; // locs podem ter mudado
+            return (uint8_t)i;
+        }
+    }
+    if (queue->shaderCount >= RENDER_QUEUE_MAX_SHADERS) return 0;
+    queue->shaders[queue->shaderCount] = shader;
+    return (uint8_t)queue->shaderCount++;
+}
+
+void RenderQueue_Begin(RenderQueue* queue) {
+    if (!queue) return;
+    queue->count = 0;
+    queue->sequence = 0;
+}
+
+uint64_t RenderQueue_MakeKey(RenderPass pass, uint8_t shaderSlot, uint8_t state, float depth) {
+    if (depth < 0.0f) depth = 0.0f;
+    if (depth > RENDER_QUEUE_MAX_DEPTH) depth = RENDER_QUEUE_MAX_DEPTH;
+    uint32_t quantized = (uint32_t)(depth * ((float)KEY_DEPTH_MAX / RENDER_QUEUE_MAX_DEPTH));
+    if (quantized > KEY_DEPTH_MAX) quantized = KEY_DEPTH_MAX;
+    if (pass == RENDER_PASS_TRANSLUCENT) quantized = KEY_DEPTH_MAX - quantized; // Longe primeiro
+    return ((uint64_t)(pass & 0xF) << KEY_PASS_SHIFT) |
+           ((uint64_t)shaderSlot << KEY_SHADER_SHIFT) |
+           ((uint64_t)state << KEY_STATE_SHIFT) |
+           ((uint64_t)quantized << KEY_DEPTH_SHIFT);
+}
+
+bool RenderQueue_Push(RenderQueue* queue, uint64_t key, RenderCommandFn draw, void* userData) {
+    if (!queue || !draw || queue->count >= RENDER_QUEUE_MAX_COMMANDS) return false;
+    RenderCommand* cmd = &queue->commands[queue->count++];
+    cmd->key = (key & ~(uint64_t)KEY_SEQUENCE_MASK) | (queue->sequence++ & KEY_SEQUENCE_MASK);
+    cmd->draw = draw;
+    cmd->userData = userData;
+    return true;
+}
+
+// Aplica só os bits de estado que mudaram
+static void ApplyState(uint8_t from, uint8_t to) {
+#if defined(USE_RLGL)
+    uint8_t changed = from ^ to;
+    if (changed & RENDER_STATE_NO_CULL) {
+        if (to & RENDER_STATE_NO_CULL) rlDisableBackfaceCulling();
+        else rlEnableBackfaceCulling();
+    }
+    if (changed & RENDER_STATE_NO_DEPTH_WRITE) {
+        if (to & RENDER_STATE_NO_DEPTH_WRITE) rlDisableDepthMask();
+        else rlEnableDepthMask();
+    }
+    if (changed & RENDER_STATE_NO_DEPTH_TEST) {
+        if (to & RENDER_STATE_NO_DEPTH_TEST) rlDisableDepthTest();
+        else rlEnableDepthTest();
+    }
+    if (changed & RENDER_STATE_WIREFRAME) {
+        if (to & RENDER_STATE_WIREFRAME) rlEnableWireMode();
+        else rlDisableWireMode();
+    }
+#else
+    (void)from;
+    (void)to;
+#endif
+}
+
+// Sem comando executado desde a última descarga o batch está vazio (BeginMode3D já
+// descarregou): não conta a troca de grupo como draw call
+static void FlushBatch(RenderQueue* queue, bool* pending) {
+    if (!*pending) return;
+    *pending = false;
+#if defined(USE_RLGL)
+    rlDrawRenderBatchActive();
+#endif
+    queue->stats.flushes++;
+}
+
+void RenderQueue_Submit(RenderQueue* queue) {
+    if (!queue) return;
+    memset(&queue->stats, 0, sizeof(queue->stats));
+
+    // Insertion sort: poucas dezenas de comandos, quase sempre já em ordem
+    for (int32_t i = 1; i < queue->count; i++) {
+        RenderCommand cmd = queue->commands[i];
+        int32_t j = i - 1;
+        while (j >= 0 && queue->commands[j].key > cmd.key) {
+            queue->commands[j + 1] = queue->commands[j];
+            j--;
+        }
+        queue->commands[j + 1] = cmd;
+    }
+
+    uint8_t shader = 0;
+    uint8_t state = 0;
+    bool pending = false;
+    for (int32_t i = 0; i < queue->count; i++) {
+        const RenderCommand* cmd = &queue->commands[i];
+        uint8_t cmdShader = (uint8_t)(cmd->key >> KEY_SHADER_SHIFT);
+        uint8_t cmdState = (uint8_t)(cmd->key >> KEY_STATE_SHIFT);
+
+        // Fronteira de grupo: uma descarga, depois o que mudou (o batch pendente usa o estado antigo)
+        if (cmdShader != shader || cmdState != state) {
+            FlushBatch(queue, &pending);
+            if (cmdState != state) {
+                ApplyState(state, cmdState);
+                queue->stats.stateChanges++;
+                state = cmdState;
+            }
+            if (cmdShader != shader) {
+                if (cmdShader != 0 && cmdShader < queue->shaderCount) BeginShaderMode(queue->shaders[cmdShader]);
+                else EndShaderMode();
+                queue->stats.shaderChanges++;
+                shader = cmdShader;
+            }
+        }
+        queue->stats.drawCalls += cmd->draw(cmd->userData);
+        pending = true;
+        queue->stats.commands++;
+    }
+
+    // Volta ao padrão para o que vier depois (2D, HUD)
+    FlushBatch(queue, &pending);
+    if (shader != 0) EndShaderMode();
+    if (state != 0) ApplyState(state, 0);
+    queue->stats.drawCalls += queue->stats.flushes;
+    queue->count = 0;
+}
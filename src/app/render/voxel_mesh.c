@@ -4,132 +4,117 @@
 #include "core/world/chunk.h"
 #include "core/math/core_math.h"
 #include <raylib.h>
+#include <raymath.h>
+#if defined(USE_RLGL)
+#include <rlgl.h>
+#endif
 #include <math.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 
 #define INITIAL_VERTEX_CAPACITY 1024
 #define VERTEX_GROWTH_FACTOR 2
 
-// Verifica se um bloco existe e é sólido (não usado - culling desativado)
-__attribute__((unused)) static bool IsBlockSolid(VoxelWorld* world, int32_t x, int32_t y, int32_t z) {
-    Voxel v = VoxelWorld_GetBlock(world, x, y, z);
-    return v.type != BLOCK_AIR;
+// Adiciona vértice ao mesh (coordenadas locais ao chunk). Sem checagem: o build reserva
+// antes o limite de vértices (VoxelMesh_Reserve) e AddQuad confere uma vez por quad.
+static inline void AddVertex(VoxelMesh* mesh, int32_t x, int32_t y, int32_t z,
+                             FaceDirection face, uint8_t blockType, uint8_t light, uint8_t ao) {
+    VoxelVertex* vertex = &mesh->vertices[mesh->vertexCount++];
+    vertex->x = (uint8_t)x;
+    vertex->z = (uint8_t)z;
+    vertex->face = (uint8_t)face;
+    vertex->blockType = blockType;
+    vertex->y = (uint16_t)y;
+    vertex->light = light;
+    vertex->ao = ao;
 }
 
-// Adiciona vértice ao mesh
-static void AddVertex(VoxelMesh* mesh, Vector3 pos, Vector3 normal, Color color) {
-    if (!mesh || !mesh->initialized) return;
-    
-    // Expande array se necessário
-    if (mesh->vertexCount >= mesh->vertexCapacity) {
-        int32_t newCapacity = mesh->vertexCapacity * VERTEX_GROWTH_FACTOR;
-        if (newCapacity < INITIAL_VERTEX_CAPACITY) newCapacity = INITIAL_VERTEX_CAPACITY;
-        
-        VoxelVertex* newVertices = (VoxelVertex*)realloc(mesh->vertices, 
-                                                         newCapacity * sizeof(VoxelVertex));
-        if (!newVertices) return; // Falha silenciosa
-        
-        mesh->vertices = newVertices;
-        mesh->vertexCapacity = newCapacity;
-    }
-    
-    mesh->vertices[mesh->vertexCount].position = pos;
-    mesh->vertices[mesh->vertexCount].normal = normal;
-    mesh->vertices[mesh->vertexCount].color = color;
-    mesh->vertexCount++;
+// Escala de luz por nível de AO (0 = canto fechado por dois vizinhos, 3 = aberto)
+static const uint8_t g_aoLight[4] = {140, 179, 217, 255};
+
+static inline uint8_t BakeLight(uint8_t faceLight, uint8_t ao) {
+    return (uint8_t)((faceLight * g_aoLight[ao & 3] + 127) / 255);
 }
 
-// Adiciona uma face (2 triângulos) ao mesh
-static void AddFace(VoxelMesh* mesh, Vector3 blockPos, FaceDirection dir, Color color) {
-    float x = blockPos.x;
-    float y = blockPos.y;
-    float z = blockPos.z;
-    
-    Vector3 normal;
-    Vector3 v[4]; // 4 vértices da face
+// Canto (u, v) da face de cada vértice emitido por AddQuad, em índice de AO:
+// 0 = (0,0), 1 = (1,0), 2 = (1,1), 3 = (0,1) nos eixos u/v da máscara
+static const uint8_t g_quadCornerAO[6][4] = {
+    {0, 1, 2, 3}, // -X
+    {0, 3, 2, 1}, // +X
+    {0, 1, 2, 3}, // -Y
+    {0, 3, 2, 1}, // +Y
+    {0, 3, 2, 1}, // -Z
+    {0, 1, 2, 3}, // +Z
+};
+
+// Adiciona um retângulo de faces (4 vértices) ao mesh.
+// (x, y, z) = canto mínimo local do primeiro bloco; w/h = extensão em blocos ao longo
+// dos eixos da face (X: Z e Y; Y: X e Z; Z: X e Y). 1x1 = face de um único bloco.
+// ao: 2 bits por canto (índices de g_quadCornerAO); faceLight: luz da direção.
+static void AddQuad(VoxelMesh* mesh, int32_t x, int32_t y, int32_t z, FaceDirection dir,
+                    int32_t w, int32_t h, uint8_t blockType, uint8_t ao, uint8_t faceLight) {
+    if (mesh->vertexCount + 4 > mesh->vertexCapacity) return; // não acontece após o Reserve
+    int32_t v[4][3]; // 4 vértices da face
     
-    // Define vértices e normal baseado na direção da face
+    // Define vértices baseado na direção da face (a normal sai da própria face no shader)
     switch (dir) {
         case FACE_NEGATIVE_X: // Face esquerda (-X)
-            v[0] = (Vector3){x, y, z};
-            v[1] = (Vector3){x, y, z + 1.0f};
-            v[2] = (Vector3){x, y + 1.0f, z + 1.0f};
-            v[3] = (Vector3){x, y + 1.0f, z};
-            normal = (Vector3){-1.0f, 0.0f, 0.0f};
+            v[0][0] = x; v[0][1] = y;     v[0][2] = z;
+            v[1][0] = x; v[1][1] = y;     v[1][2] = z + w;
+            v[2][0] = x; v[2][1] = y + h; v[2][2] = z + w;
+            v[3][0] = x; v[3][1] = y + h; v[3][2] = z;
             break;
             
         case FACE_POSITIVE_X: // Face direita (+X)
-            v[0] = (Vector3){x + 1.0f, y, z};
-            v[1] = (Vector3){x + 1.0f, y + 1.0f, z};
-            v[2] = (Vector3){x + 1.0f, y + 1.0f, z + 1.0f};
-            v[3] = (Vector3){x + 1.0f, y, z + 1.0f};
-            normal = (Vector3){1.0f, 0.0f, 0.0f};
+            v[0][0] = x + 1; v[0][1] = y;     v[0][2] = z;
+            v[1][0] = x + 1; v[1][1] = y + h; v[1][2] = z;
+            v[2][0] = x + 1; v[2][1] = y + h; v[2][2] = z + w;
+            v[3][0] = x + 1; v[3][1] = y;     v[3][2] = z + w;
             break;
             
         case FACE_NEGATIVE_Y: // Face inferior (-Y) - CHÃO
-            v[0] = (Vector3){x, y, z};
-            v[1] = (Vector3){x + 1.0f, y, z};
-            v[2] = (Vector3){x + 1.0f, y, z + 1.0f};
-            v[3] = (Vector3){x, y, z + 1.0f};
-            normal = (Vector3){0.0f, -1.0f, 0.0f};
+            v[0][0] = x;     v[0][1] = y; v[0][2] = z;
+            v[1][0] = x + w; v[1][1] = y; v[1][2] = z;
+            v[2][0] = x + w; v[2][1] = y; v[2][2] = z + h;
+            v[3][0] = x;     v[3][1] = y; v[3][2] = z + h;
             break;
             
         case FACE_POSITIVE_Y: // Face superior (+Y) - TETO
-            v[0] = (Vector3){x, y + 1.0f, z};
-            v[1] = (Vector3){x, y + 1.0f, z + 1.0f};
-            v[2] = (Vector3){x + 1.0f, y + 1.0f, z + 1.0f};
-            v[3] = (Vector3){x + 1.0f, y + 1.0f, z};
-            normal = (Vector3){0.0f, 1.0f, 0.0f};
+            v[0][0] = x;     v[0][1] = y + 1; v[0][2] = z;
+            v[1][0] = x;     v[1][1] = y + 1; v[1][2] = z + h;
+            v[2][0] = x + w; v[2][1] = y + 1; v[2][2] = z + h;
+            v[3][0] = x + w; v[3][1] = y + 1; v[3][2] = z;
             break;
             
         case FACE_NEGATIVE_Z: // Face traseira (-Z)
-            v[0] = (Vector3){x, y, z};
-            v[1] = (Vector3){x, y + 1.0f, z};
-            v[2] = (Vector3){x + 1.0f, y + 1.0f, z};
-            v[3] = (Vector3){x + 1.0f, y, z};
-            normal = (Vector3){0.0f, 0.0f, -1.0f};
+            v[0][0] = x;     v[0][1] = y;     v[0][2] = z;
+            v[1][0] = x;     v[1][1] = y + h; v[1][2] = z;
+            v[2][0] = x + w; v[2][1] = y + h; v[2][2] = z;
+            v[3][0] = x + w; v[3][1] = y;     v[3][2] = z;
             break;
             
         case FACE_POSITIVE_Z: // Face frontal (+Z)
-            v[0] = (Vector3){x, y, z + 1.0f};
-            v[1] = (Vector3){x + 1.0f, y, z + 1.0f};
-            v[2] = (Vector3){x + 1.0f, y + 1.0f, z + 1.0f};
-            v[3] = (Vector3){x, y + 1.0f, z + 1.0f};
-            normal = (Vector3){0.0f, 0.0f, 1.0f};
+        default:
+            v[0][0] = x;     v[0][1] = y;     v[0][2] = z + 1;
+            v[1][0] = x + w; v[1][1] = y;     v[1][2] = z + 1;
+            v[2][0] = x + w; v[2][1] = y + h; v[2][2] = z + 1;
+            v[3][0] = x;     v[3][1] = y + h; v[3][2] = z + 1;
             break;
     }
     
-    // Divide face em 2 triângulos: (0,1,2) e (0,2,3)
-    AddVertex(mesh, v[0], normal, color);
-    AddVertex(mesh, v[1], normal, color);
-    AddVertex(mesh, v[2], normal, color);
-    
-    AddVertex(mesh, v[0], normal, color);
-    AddVertex(mesh, v[2], normal, color);
-    AddVertex(mesh, v[3], normal, color);
-}
-
-// Verifica se uma face deve ser renderizada (back-face culling) (não usado - culling desativado)
-__attribute__((unused)) static bool ShouldRenderFace(Vector3 faceNormal, Vector3 cameraPos, Vector3 blockCenter) {
-    // Vetor do centro do bloco para a câmera (direção da câmera em relação ao bloco)
-    Vector3 toCamera = (Vector3){
-        cameraPos.x - blockCenter.x,
-        cameraPos.y - blockCenter.y,
-        cameraPos.z - blockCenter.z
-    };
-    
-    // Normaliza
-    float len = sqrtf(toCamera.x * toCamera.x + toCamera.y * toCamera.y + toCamera.z * toCamera.z);
-    if (len < 0.0001f) return true; // Muito próximo, renderiza
-    
-    toCamera.x /= len;
-    toCamera.y /= len;
-    toCamera.z /= len;
+    uint8_t cornerAO[4];
+    for (int32_t i = 0; i < 4; i++) cornerAO[i] = (uint8_t)((ao >> (g_quadCornerAO[dir][i] * 2)) & 3);
     
-    // Produto escalar: se positivo, normal da face aponta na direção da câmera (face visível)
-    float dot = faceNormal.x * toCamera.x + faceNormal.y * toCamera.y + faceNormal.z * toCamera.z;
-    return dot > 0.0f;
+    // 4 cantos; os triângulos (0,1,2) e (0,2,3) vêm do índice compartilhado. Se a diagonal
+    // 0-2 liga os cantos mais escuros, começa do 1 (diagonal 1-3): a AO não vaza em faixa.
+    int32_t first = (cornerAO[0] + cornerAO[2] < cornerAO[1] + cornerAO[3]) ? 1 : 0;
+    for (int32_t k = 0; k < 4; k++) {
+        int32_t i = (first + k) & 3;
+        AddVertex(mesh, v[i][0], v[i][1], v[i][2], dir, blockType,
+                  BakeLight(faceLight, cornerAO[i]), cornerAO[i]);
+    }
+    mesh->chunkStats.quadCount++;
 }
 
 void VoxelMesh_Init(VoxelMesh* mesh) {
@@ -140,149 +125,970 @@ void VoxelMesh_Init(VoxelMesh* mesh) {
     mesh->initialized = (mesh->vertices != NULL);
 }
 
+bool VoxelMesh_Reserve(VoxelMesh* mesh, int32_t vertexCount) {
+    if (!mesh || !mesh->initialized) return false;
+    if (vertexCount <= mesh->vertexCapacity) return true;
+    
+    int32_t newCapacity = (mesh->vertexCapacity > INITIAL_VERTEX_CAPACITY) ? mesh->vertexCapacity : INITIAL_VERTEX_CAPACITY;
+    while (newCapacity < vertexCount) newCapacity *= VERTEX_GROWTH_FACTOR;
+    VoxelVertex* newVertices = (VoxelVertex*)realloc(mesh->vertices, (size_t)newCapacity * sizeof(VoxelVertex));
+    if (!newVertices) return false; // Mesh atual continua válido
+    mesh->vertices = newVertices;
+    mesh->vertexCapacity = newCapacity;
+    return true;
+}
+
 void VoxelMesh_Clear(VoxelMesh* mesh) {
     if (!mesh) return;
     mesh->vertexCount = 0;
+    mesh->opaqueVertexCount = 0;
+    mesh->occluderCount = 0;
+    mesh->translucentSorted = false;
 }
 
 void VoxelMesh_Destroy(VoxelMesh* mesh) {
     if (!mesh) return;
+#if defined(USE_RLGL)
+    if (mesh->vboId) rlUnloadVertexBuffer(mesh->vboId);
+    if (mesh->vaoId) rlUnloadVertexArray(mesh->vaoId);
+#endif
+    mesh->vboId = 0;
+    mesh->vaoId = 0;
+    mesh->gpuVertexCapacity = 0;
+    mesh->gpuVertexCount = 0;
     if (mesh->vertices) {
         free(mesh->vertices);
         mesh->vertices = NULL;
     }
     mesh->vertexCount = 0;
+    mesh->opaqueVertexCount = 0;
     mesh->vertexCapacity = 0;
     mesh->initialized = false;
 }
 
-void VoxelMesh_GenerateChunk(VoxelMesh* mesh, VoxelWorld* world, 
-                             int32_t chunkX, int32_t chunkZ,
-                             float playerX, float playerY, float playerZ) {
-    (void)playerX; (void)playerY; (void)playerZ; // Parâmetros não usados (culling desativado)
-    if (!mesh || !mesh->initialized || !world) return;
+// ============================================================================
+// GREEDY MESHING
+// Para cada direção e fatia: máscara 2D com o tipo dos blocos cuja face está
+// exposta (vizinho é ar) e depois fusão de faces vizinhas do mesmo tipo em
+// retângulos máximos. Chão plano de 16x16 vira poucos quads em vez de 256 cubos.
+// A AO dos 4 cantos entra na chave da máscara: só fundem faces com a mesma oclusão,
+// então o retângulo carrega a AO exata nos cantos.
+// ============================================================================
+
+// Linha de ocupação: bits 1..16 = x 0..15 do chunk, bits 0 e 17 = vizinhos -X/+X
+#define MESH_INNER_BITS 0x1FFFEu
+
+// Tipos com alpha < 255 na paleta (bit por tipo): vão para o sub-mesh translúcido
+static uint32_t TranslucentTypeMask(void) {
+    uint32_t mask = 0;
+    for (int32_t t = BLOCK_AIR + 1; t < VOXEL_MESH_PALETTE_SIZE; t++) {
+        if (VoxelRenderer_GetBlockColor((uint8_t)t).a < 255) mask |= 1u << t;
+    }
+    return mask;
+}
+
+// Camada do buffer com acolchoamento (py = y - yBase, ver VoxelMeshScratch)
+static inline int32_t Padded_Index(int32_t py, int32_t pz, int32_t px) {
+    return (py * VOXEL_MESH_PADDED_DIM + pz) * VOXEL_MESH_PADDED_DIM + px;
+}
+
+// Monta o buffer denso 18x18 x (faixa ocupada + 2) e as linhas de ocupação.
+// Só cópia de arrays: o chunk pelas seções, as bordas pelas tiras do snapshot.
+static void BuildPaddedInput(VoxelMeshScratch* scratch, const VoxelMeshSnapshot* snap, int32_t yMin, int32_t yMax) {
+    const int32_t layers = yMax - yMin + 3;
+    scratch->yBase = yMin - 1;
+    scratch->layers = layers;
+    memset(scratch->types, 0, (size_t)layers * VOXEL_MESH_PADDED_DIM * VOXEL_MESH_PADDED_DIM);
+    
+    for (int32_t py = 0; py < layers; py++) {
+        int32_t y = scratch->yBase + py;
+        if (y < 0 || y >= CHUNK_SIZE_Y) continue; // ar (o chão do mundo vai direto na ocupação)
+        
+        // Interior: uma linha X contígua por (y, z) na seção
+        const Voxel* section = Chunk_GetSectionVoxels(snap->chunk, y / CHUNK_SECTION_HEIGHT);
+        const Voxel* layer = section + (y % CHUNK_SECTION_HEIGHT) * (CHUNK_SIZE_Z * CHUNK_SIZE_X);
+        for (int32_t z = 0; z < CHUNK_SIZE_Z; z++) {
+            uint8_t* row = &scratch->types[Padded_Index(py, z + 1, 1)];
+            const Voxel* src = layer + z * CHUNK_SIZE_X;
+            for (int32_t x = 0; x < CHUNK_SIZE_X; x++) row[x] = (uint8_t)src[x].type;
+        }
+        
+        // Bordas dos 8 vizinhos
+        for (int32_t i = 0; i < CHUNK_SIZE_X; i++) {
+            scratch->types[Padded_Index(py, i + 1, 0)] = snap->sideTypes[CHUNK_SIDE_NEG_X][y][i];
+            scratch->types[Padded_Index(py, i + 1, VOXEL_MESH_PADDED_DIM - 1)] = snap->sideTypes[CHUNK_SIDE_POS_X][y][i];
+            scratch->types[Padded_Index(py, 0, i + 1)] = snap->sideTypes[CHUNK_SIDE_NEG_Z][y][i];
+            scratch->types[Padded_Index(py, VOXEL_MESH_PADDED_DIM - 1, i + 1)] = snap->sideTypes[CHUNK_SIDE_POS_Z][y][i];
+        }
+        scratch->types[Padded_Index(py, 0, 0)] = snap->cornerTypes[0][y];
+        scratch->types[Padded_Index(py, 0, VOXEL_MESH_PADDED_DIM - 1)] = snap->cornerTypes[1][y];
+        scratch->types[Padded_Index(py, VOXEL_MESH_PADDED_DIM - 1, 0)] = snap->cornerTypes[2][y];
+        scratch->types[Padded_Index(py, VOXEL_MESH_PADDED_DIM - 1, VOXEL_MESH_PADDED_DIM - 1)] = snap->cornerTypes[3][y];
+    }
     
-    VoxelMesh_Clear(mesh);
+    const uint32_t translucentTypes = TranslucentTypeMask();
+    uint32_t anyTranslucent = 0, ownTranslucent = 0;
+    for (int32_t py = 0; py < layers; py++) {
+        int32_t y = scratch->yBase + py;
+        for (int32_t pz = 0; pz < VOXEL_MESH_PADDED_DIM; pz++) {
+            uint32_t bits = 0, translucent = 0;
+            if (y < 0) {
+                bits = (1u << VOXEL_MESH_PADDED_DIM) - 1u; // Nada é visto por baixo do chão do mundo
+            } else {
+                const uint8_t* row = &scratch->types[Padded_Index(py, pz, 0)];
+                for (int32_t px = 0; px < VOXEL_MESH_PADDED_DIM; px++) {
+                    bits |= (uint32_t)(row[px] != BLOCK_AIR) << px;
+                    translucent |= (uint32_t)(row[px] < 32 && ((translucentTypes >> row[px]) & 1u)) << px;
+                }
+            }
+            scratch->occupancy[py * VOXEL_MESH_PADDED_DIM + pz] = bits;
+            scratch->translucent[py * VOXEL_MESH_PADDED_DIM + pz] = translucent;
+            anyTranslucent |= translucent;
+            if (pz >= 1 && pz <= CHUNK_SIZE_Z) ownTranslucent |= translucent;
+        }
+    }
+    scratch->anyTranslucent = anyTranslucent != 0;
+    scratch->ownTranslucent = (ownTranslucent & MESH_INNER_BITS) != 0;
+}
+
+// Linha vizinha na direção, alinhada bit a bit com a linha (py, pz)
+static inline uint32_t NeighborRow(const uint32_t* rows, FaceDirection dir, int32_t py, int32_t pz) {
+    switch (dir) {
+        case FACE_NEGATIVE_X: return rows[py * VOXEL_MESH_PADDED_DIM + pz] << 1;
+        case FACE_POSITIVE_X: return rows[py * VOXEL_MESH_PADDED_DIM + pz] >> 1;
+        case FACE_NEGATIVE_Y: return rows[(py - 1) * VOXEL_MESH_PADDED_DIM + pz];
+        case FACE_POSITIVE_Y: return rows[(py + 1) * VOXEL_MESH_PADDED_DIM + pz];
+        case FACE_NEGATIVE_Z: return rows[py * VOXEL_MESH_PADDED_DIM + pz - 1];
+        default:              return rows[py * VOXEL_MESH_PADDED_DIM + pz + 1];
+    }
+}
+
+// Bits das faces expostas na linha (py, pz). Opacas: bloco opaco aqui e vizinho que não
+// é opaco (ar ou translúcido). Translúcidas: bloco translúcido aqui e ar no vizinho.
+static inline uint32_t VisibleFaceBits(const VoxelMeshScratch* scratch, FaceDirection dir,
+                                       int32_t py, int32_t pz, bool translucent) {
+    const int32_t row = py * VOXEL_MESH_PADDED_DIM + pz;
+    uint32_t neighbor = NeighborRow(scratch->occupancy, dir, py, pz);
+    if (translucent) return scratch->translucent[row] & ~neighbor & MESH_INNER_BITS;
+    if (!scratch->anyTranslucent) return scratch->occupancy[row] & ~neighbor & MESH_INNER_BITS;
+    uint32_t neighborOpaque = neighbor & ~NeighborRow(scratch->translucent, dir, py, pz);
+    return scratch->occupancy[row] & ~scratch->translucent[row] & ~neighborOpaque & MESH_INNER_BITS;
+}
+
+static inline uint32_t Padded_Solid(const VoxelMeshScratch* scratch, int32_t py, int32_t pz, int32_t px) {
+    return (scratch->occupancy[py * VOXEL_MESH_PADDED_DIM + pz] >> px) & 1u;
+}
+
+// Normal e eixos u/v da máscara (x, y, z) por direção
+static const int8_t g_faceAxes[6][3][3] = {
+    {{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}}, // -X: u = Z, v = Y
+    {{ 1, 0, 0}, {0, 0, 1}, {0, 1, 0}}, // +X
+    {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}, // -Y: u = X, v = Z
+    {{0,  1, 0}, {1, 0, 0}, {0, 0, 1}}, // +Y
+    {{0, 0, -1}, {1, 0, 0}, {0, 1, 0}}, // -Z: u = X, v = Y
+    {{0, 0,  1}, {1, 0, 0}, {0, 1, 0}}, // +Z
+};
+
+// AO dos 4 cantos da face do bloco local (x, y, z), 2 bits cada (0 = (0,0), 1 = (1,0),
+// 2 = (1,1), 3 = (0,1)). Lê a camada de ar na frente da face: dois lados + diagonal.
+// O acolchoamento cobre todos os vizinhos (bordas, cantos, camadas acima e abaixo).
+static uint8_t FaceAO(const VoxelMeshScratch* scratch, FaceDirection dir, int32_t x, int32_t y, int32_t z) {
+    const int8_t (*axes)[3] = g_faceAxes[dir];
+    int32_t px = x + 1 + axes[0][0];
+    int32_t py = y - scratch->yBase + axes[0][1];
+    int32_t pz = z + 1 + axes[0][2];
+    static const int8_t corners[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
     
-    Chunk* chunk = VoxelWorld_GetChunk(world, chunkX, chunkZ);
-    if (!chunk || chunk->state != CHUNK_STATE_READY) return;
+    uint8_t ao = 0;
+    for (int32_t c = 0; c < 4; c++) {
+        int32_t su = corners[c][0], sv = corners[c][1];
+        uint32_t side1 = Padded_Solid(scratch, py + su * axes[1][1], pz + su * axes[1][2], px + su * axes[1][0]);
+        uint32_t side2 = Padded_Solid(scratch, py + sv * axes[2][1], pz + sv * axes[2][2], px + sv * axes[2][0]);
+        uint32_t corner = Padded_Solid(scratch, py + su * axes[1][1] + sv * axes[2][1],
+                                       pz + su * axes[1][2] + sv * axes[2][2],
+                                       px + su * axes[1][0] + sv * axes[2][0]);
+        uint32_t level = (side1 && side2) ? 0u : 3u - (side1 + side2 + corner);
+        ao |= (uint8_t)(level << (c * 2));
+    }
+    return ao;
+}
+
+// Converte (fatia, u, v) da máscara para coordenadas locais conforme a direção
+static inline void MaskToLocal(FaceDirection dir, int32_t slice, int32_t u, int32_t v, int32_t yMin,
+                               int32_t* x, int32_t* y, int32_t* z) {
+    switch (dir) {
+        case FACE_NEGATIVE_X:
+        case FACE_POSITIVE_X:  *x = slice; *z = u; *y = yMin + v; break; // u = Z, v = Y
+        case FACE_NEGATIVE_Y:
+        case FACE_POSITIVE_Y:  *y = slice; *x = u; *z = v; break;        // u = X, v = Z
+        default:               *z = slice; *x = u; *y = yMin + v; break; // u = X, v = Y
+    }
+}
+
+static void GreedyMeshDirection(VoxelMesh* mesh, VoxelMeshScratch* scratch,
+                                FaceDirection dir, int32_t yMin, int32_t yMax, uint8_t faceLight,
+                                bool translucent) {
+    const int32_t height = yMax - yMin + 1;
     
-    // DISTANCE CULLING DESATIVADO
-    // const float MAX_RENDER_DISTANCE = 30.0f;
-    // const float MAX_DISTANCE_SQ = MAX_RENDER_DISTANCE * MAX_RENDER_DISTANCE;
+    int32_t sliceStart, sliceEnd, sizeU, sizeV;
+    if (dir == FACE_NEGATIVE_Y || dir == FACE_POSITIVE_Y) {
+        sliceStart = yMin; sliceEnd = yMax; sizeU = CHUNK_SIZE_X; sizeV = CHUNK_SIZE_Z;
+    } else if (dir == FACE_NEGATIVE_X || dir == FACE_POSITIVE_X) {
+        sliceStart = 0; sliceEnd = CHUNK_SIZE_X - 1; sizeU = CHUNK_SIZE_Z; sizeV = height;
+    } else {
+        sliceStart = 0; sliceEnd = CHUNK_SIZE_Z - 1; sizeU = CHUNK_SIZE_X; sizeV = height;
+    }
     
-    // BACK-FACE CULLING DESATIVADO
-    // Vector3 cameraPos = {playerX, playerY + 1.6f, playerZ};
+    // Faces expostas de todas as linhas, uma vez por direção
+    uint32_t* visible = scratch->visible;
+    for (int32_t y = yMin; y <= yMax; y++) {
+        int32_t py = y - scratch->yBase;
+        for (int32_t z = 0; z < CHUNK_SIZE_Z; z++) {
+            uint32_t bits = VisibleFaceBits(scratch, dir, py, z + 1, translucent);
+            visible[(y - yMin) * CHUNK_SIZE_Z + z] = bits;
+        }
+    }
     
-    // Itera sobre todos os blocos do chunk
-    for (int32_t localY = 0; localY < CHUNK_SIZE_Y; localY++) {
-        for (int32_t localZ = 0; localZ < CHUNK_SIZE_Z; localZ++) {
-            for (int32_t localX = 0; localX < CHUNK_SIZE_X; localX++) {
-                Voxel voxel = Chunk_GetBlock(chunk, localX, localY, localZ);
-                if (voxel.type == BLOCK_AIR) continue;
-                
-                // Converte para coordenadas globais
-                int32_t globalX, globalY, globalZ;
-                Chunk_LocalToGlobal(chunkX, chunkZ, localX, localY, localZ,
-                                   &globalX, &globalY, &globalZ);
-                
-                // DISTANCE CULLING DESATIVADO - renderiza todos os blocos
-                // float dx = (float)globalX + 0.5f - playerX;
-                // float dy = (float)globalY + 0.5f - playerY;
-                // float dz = (float)globalZ + 0.5f - playerZ;
-                // float distSq = dx * dx + dy * dy + dz * dz;
-                // if (distSq > MAX_DISTANCE_SQ) continue;
-                
-                Vector3 blockPos = {(float)globalX, (float)globalY, (float)globalZ};
-                // BACK-FACE CULLING DESATIVADO
-                // Vector3 blockCenter = {(float)globalX + 0.5f, (float)globalY + 0.5f, (float)globalZ + 0.5f};
-                
-                BlockColor blockColor = VoxelRenderer_GetBlockColor(voxel.type);
-                Color color = {blockColor.r, blockColor.g, blockColor.b, blockColor.a};
-                
-                // OCCLUSION CULLING E BACK-FACE CULLING DESATIVADOS
-                // Renderiza todas as faces de todos os blocos
-                AddFace(mesh, blockPos, FACE_NEGATIVE_X, color);
-                AddFace(mesh, blockPos, FACE_POSITIVE_X, color);
-                AddFace(mesh, blockPos, FACE_NEGATIVE_Y, color);
-                AddFace(mesh, blockPos, FACE_POSITIVE_Y, color);
-                AddFace(mesh, blockPos, FACE_NEGATIVE_Z, color);
-                AddFace(mesh, blockPos, FACE_POSITIVE_Z, color);
+    uint16_t* mask = scratch->mask;
+    for (int32_t slice = sliceStart; slice <= sliceEnd; slice++) {
+        // 1) Máscara: tipo do bloco | AO << 8 se a face está exposta, 0 se não
+        bool any = false;
+        for (int32_t v = 0; v < sizeV; v++) {
+            for (int32_t u = 0; u < sizeU; u++) {
+                int32_t x, y, z;
+                MaskToLocal(dir, slice, u, v, yMin, &x, &y, &z);
+                uint16_t key = 0;
+                if (visible[(y - yMin) * CHUNK_SIZE_Z + z] & (1u << (x + 1))) {
+                    key = (uint16_t)(scratch->types[Padded_Index(y - scratch->yBase, z + 1, x + 1)] |
+                                     (FaceAO(scratch, dir, x, y, z) << 8));
+                    any = true;
+                }
+                mask[v * sizeU + u] = key;
+            }
+        }
+        if (!any) continue;
+        
+        // 2) Fusão gulosa: cresce em u, depois em v enquanto a linha inteira bate
+        for (int32_t v = 0; v < sizeV; v++) {
+            for (int32_t u = 0; u < sizeU; ) {
+                uint16_t key = mask[v * sizeU + u];
+                if (key == 0) {
+                    u++;
+                    continue;
+                }
                 
-                /* CÓDIGO ORIGINAL COM CULLING (DESATIVADO)
-                // Verifica faces adjacentes (occlusion culling)
-                // Só renderiza faces que não têm bloco sólido adjacente
+                int32_t w = 1;
+                while (u + w < sizeU && mask[v * sizeU + u + w] == key) w++;
                 
-                // Face -X (esquerda)
-                if (!IsBlockSolid(world, globalX - 1, globalY, globalZ)) {
-                    Vector3 normal = {-1.0f, 0.0f, 0.0f};
-                    if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                        AddFace(mesh, blockPos, FACE_NEGATIVE_X, color);
+                int32_t h = 1;
+                for (; v + h < sizeV; h++) {
+                    bool rowMatches = true;
+                    for (int32_t k = 0; k < w; k++) {
+                        if (mask[(v + h) * sizeU + u + k] != key) {
+                            rowMatches = false;
+                            break;
+                        }
                     }
+                    if (!rowMatches) break;
                 }
                 
-                // Face +X (direita)
-                if (!IsBlockSolid(world, globalX + 1, globalY, globalZ)) {
-                    Vector3 normal = {1.0f, 0.0f, 0.0f};
-                    if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                        AddFace(mesh, blockPos, FACE_POSITIVE_X, color);
-                    }
+                for (int32_t dv = 0; dv < h; dv++) {
+                    memset(&mask[(v + dv) * sizeU + u], 0, (size_t)w * sizeof(uint16_t));
                 }
                 
-                // Face -Y (chão) - sempre renderiza se não tiver bloco abaixo
-                if (!IsBlockSolid(world, globalX, globalY - 1, globalZ)) {
-                    Vector3 normal = {0.0f, -1.0f, 0.0f};
-                    if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                        AddFace(mesh, blockPos, FACE_NEGATIVE_Y, color);
+                int32_t x, y, z;
+                MaskToLocal(dir, slice, u, v, yMin, &x, &y, &z);
+                AddQuad(mesh, x, y, z, dir, w, h, (uint8_t)(key & 0xFF), (uint8_t)(key >> 8), faceLight);
+                
+                u += w;
+            }
+        }
+    }
+}
+
+// Vizinhos na ordem CHUNK_SIDE_* e depois os cantos (-X-Z, +X-Z, -X+Z, +X+Z)
+static const int32_t g_meshNeighborOffsets[VOXEL_MESH_NEIGHBOR_COUNT][2] = {
+    {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {1, -1}, {-1, 1}, {1, 1}
+};
+
+// Tipos de uma coluna do vizinho (x, z locais dele) para cada y; stride entre ys em `out`
+static void CaptureColumn(uint8_t* out, int32_t stride, const Chunk* neighbor, int32_t x, int32_t z) {
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        if (Chunk_IsSectionEmpty(neighbor, s)) continue; // já zerado (ar)
+        const Voxel* voxels = Chunk_GetSectionVoxels(neighbor, s) + z * CHUNK_SIZE_X + x;
+        uint8_t* dst = out + (size_t)s * CHUNK_SECTION_HEIGHT * stride;
+        for (int32_t ly = 0; ly < CHUNK_SECTION_HEIGHT; ly++) {
+            dst[ly * stride] = (uint8_t)voxels[ly * CHUNK_SIZE_Z * CHUNK_SIZE_X].type;
+        }
+    }
+}
+
+bool VoxelMeshSnapshot_Capture(VoxelMeshSnapshot* snap, VoxelWorld* world, int32_t chunkX, int32_t chunkZ, int32_t lod) {
+    if (!snap || !world) return false;
+    memset(snap->faceLight, 255, sizeof(snap->faceLight));
+    if (lod < 0) lod = 0;
+    if (lod >= VOXEL_MESH_LOD_COUNT) lod = VOXEL_MESH_LOD_COUNT - 1;
+    snap->lod = (uint8_t)lod;
+    
+    Chunk* chunk = VoxelWorld_FindChunk(world, chunkX, chunkZ);
+    if (!chunk || !Chunk_IsReady(chunk)) return false;
+    
+    // Seções internadas são imutáveis: a cópia só soma referências (privadas são copiadas).
+    // Snapshot recapturado reaproveita o chunk e as seções privadas dele (sem alocar).
+    if (!snap->chunk) {
+        snap->chunk = Chunk_Create(chunkX, chunkZ, chunk->chunkSeed);
+        if (!snap->chunk) return false;
+    }
+    snap->chunk->chunkX = chunkX;
+    snap->chunk->chunkZ = chunkZ;
+    snap->chunk->chunkSeed = chunk->chunkSeed;
+    Chunk_CopyBlocks(snap->chunk, chunk);
+    snap->chunk->state = CHUNK_STATE_READY;
+    if (lod > 0) return true; // Heightfield não lê vizinhos
+    
+    // Bordas: só a coluna/tira voltada para o chunk (ausente ou gerando = ar)
+    memset(snap->sideTypes, 0, sizeof(snap->sideTypes));
+    memset(snap->cornerTypes, 0, sizeof(snap->cornerTypes));
+    for (int32_t n = 0; n < VOXEL_MESH_NEIGHBOR_COUNT; n++) {
+        const Chunk* neighbor = VoxelWorld_FindChunk(world, chunkX + g_meshNeighborOffsets[n][0],
+                                                     chunkZ + g_meshNeighborOffsets[n][1]);
+        if (!neighbor || !Chunk_IsReady(neighbor)) continue;
+        
+        // Coordenada local do vizinho encostada no chunk
+        int32_t nx = (g_meshNeighborOffsets[n][0] < 0) ? CHUNK_SIZE_X - 1 : 0;
+        int32_t nz = (g_meshNeighborOffsets[n][1] < 0) ? CHUNK_SIZE_Z - 1 : 0;
+        if (n >= 4) {
+            CaptureColumn(snap->cornerTypes[n - 4], 1, neighbor, nx, nz);
+        } else if (n == CHUNK_SIDE_NEG_X || n == CHUNK_SIDE_POS_X) {
+            for (int32_t z = 0; z < CHUNK_SIZE_Z; z++) {
+                CaptureColumn(&snap->sideTypes[n][0][z], CHUNK_SIZE_X, neighbor, nx, z);
+            }
+        } else {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; x++) {
+                CaptureColumn(&snap->sideTypes[n][0][x], CHUNK_SIZE_X, neighbor, x, nz);
+            }
+        }
+    }
+    return true;
+}
+
+void VoxelMeshSnapshot_Release(VoxelMeshSnapshot* snap) {
+    if (!snap || !snap->chunk) return;
+    Chunk_Destroy(snap->chunk); // Nunca esteve em tabela nem foi visto por outros leitores
+    snap->chunk = NULL;
+}
+
+// ============================================================================
+// LOD: HEIGHTFIELD
+// Cada célula de cell x cell colunas vira um topo na altura da coluna mais alta
+// (a silhueta não encolhe com a distância), paredes onde células vizinhas têm
+// alturas diferentes e saias até o chão nas bordas do chunk. As saias cobrem a
+// fresta para qualquer vizinho (outro LOD, voxels completos ou ausente) sem
+// ler os dados dele.
+// ============================================================================
+
+#define LOD_AO_OPEN 0xFF // 4 cantos abertos: heightfield não tem AO
+
+// Topo de cada coluna: altura da superfície (y do bloco mais alto + 1, 0 = vazia) e tipo
+static void ComputeColumnTops(const Chunk* chunk, uint16_t* heights, uint8_t* types) {
+    memset(heights, 0, CHUNK_SIZE_X * CHUNK_SIZE_Z * sizeof(uint16_t));
+    memset(types, 0, CHUNK_SIZE_X * CHUNK_SIZE_Z);
+    int32_t remaining = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+    for (int32_t s = CHUNK_SECTION_COUNT - 1; s >= 0 && remaining > 0; s--) {
+        if (Chunk_IsSectionEmpty(chunk, s)) continue;
+        const Voxel* voxels = Chunk_GetSectionVoxels(chunk, s);
+        for (int32_t i = 0; i < CHUNK_SIZE_X * CHUNK_SIZE_Z; i++) {
+            if (heights[i] != 0) continue;
+            for (int32_t ly = CHUNK_SECTION_HEIGHT - 1; ly >= 0; ly--) {
+                BlockType type = voxels[ly * CHUNK_SIZE_Z * CHUNK_SIZE_X + i].type;
+                if (type == BLOCK_AIR) continue;
+                heights[i] = (uint16_t)(s * CHUNK_SECTION_HEIGHT + ly + 1);
+                types[i] = (uint8_t)type;
+                remaining--;
+                break;
+            }
+        }
+    }
+}
+
+static bool BuildHeightfieldLod(VoxelMesh* mesh, const VoxelMeshSnapshot* snap) {
+    const int32_t cell = 1 << snap->lod;
+    const int32_t cells = CHUNK_SIZE_X / cell;
+    // Limite: um topo e 4 paredes por célula (a fusão só reduz)
+    if (!VoxelMesh_Reserve(mesh, cells * cells * 5 * 4)) return false;
+    uint16_t columnHeights[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+    uint8_t columnTypes[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+    ComputeColumnTops(snap->chunk, columnHeights, columnTypes);
+    
+    // Célula = coluna mais alta do bloco cell x cell
+    uint16_t heights[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+    uint8_t types[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+    for (int32_t cz = 0; cz < cells; cz++) {
+        for (int32_t cx = 0; cx < cells; cx++) {
+            uint16_t best = 0;
+            uint8_t bestType = 0;
+            for (int32_t z = cz * cell; z < (cz + 1) * cell; z++) {
+                for (int32_t x = cx * cell; x < (cx + 1) * cell; x++) {
+                    int32_t i = z * CHUNK_SIZE_X + x;
+                    if (columnHeights[i] > best) {
+                        best = columnHeights[i];
+                        bestType = columnTypes[i];
                     }
                 }
-                
-                // Face +Y (teto) - só renderiza se não tiver bloco acima E se a câmera estiver abaixo
-                if (!IsBlockSolid(world, globalX, globalY + 1, globalZ)) {
-                    // Só renderiza teto se a câmera estiver abaixo do bloco
-                    if (cameraPos.y < blockCenter.y) {
-                        Vector3 normal = {0.0f, 1.0f, 0.0f};
-                        if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                            AddFace(mesh, blockPos, FACE_POSITIVE_Y, color);
-                        }
+            }
+            heights[cz * cells + cx] = best;
+            types[cz * cells + cx] = bestType;
+        }
+    }
+    
+    const uint8_t* light = snap->faceLight;
+    
+    // Topos: greedy 2D nas células de mesma altura e tipo
+    uint32_t keys[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+    for (int32_t i = 0; i < cells * cells; i++) {
+        keys[i] = heights[i] ? ((uint32_t)heights[i] << 8) | types[i] : 0u;
+        if (heights[i]) mesh->chunkStats.visibleFaces++;
+    }
+    for (int32_t cz = 0; cz < cells; cz++) {
+        for (int32_t cx = 0; cx < cells; ) {
+            uint32_t key = keys[cz * cells + cx];
+            if (key == 0) {
+                cx++;
+                continue;
+            }
+            int32_t w = 1;
+            while (cx + w < cells && keys[cz * cells + cx + w] == key) w++;
+            int32_t h = 1;
+            for (; cz + h < cells; h++) {
+                bool rowMatches = true;
+                for (int32_t k = 0; k < w; k++) {
+                    if (keys[(cz + h) * cells + cx + k] != key) {
+                        rowMatches = false;
+                        break;
                     }
                 }
+                if (!rowMatches) break;
+            }
+            for (int32_t dz = 0; dz < h; dz++) {
+                for (int32_t k = 0; k < w; k++) keys[(cz + dz) * cells + cx + k] = 0;
+            }
+            AddQuad(mesh, cx * cell, (int32_t)(key >> 8) - 1, cz * cell, FACE_POSITIVE_Y,
+                    w * cell, h * cell, (uint8_t)(key & 0xFF), LOD_AO_OPEN, light[FACE_POSITIVE_Y]);
+            cx += w;
+        }
+    }
+    
+    // Paredes: para cada direção lateral e cada linha de células, a face voltada para a
+    // vizinha mais baixa (ou saia até o chão na borda do chunk), fundida em faixas ao longo da linha
+    static const FaceDirection sides[4] = {FACE_NEGATIVE_X, FACE_POSITIVE_X, FACE_NEGATIVE_Z, FACE_POSITIVE_Z};
+    for (int32_t d = 0; d < 4; d++) {
+        FaceDirection dir = sides[d];
+        bool alongZ = (dir == FACE_NEGATIVE_X || dir == FACE_POSITIVE_X); // a faixa corre em Z
+        int32_t step = (dir == FACE_NEGATIVE_X || dir == FACE_NEGATIVE_Z) ? -1 : 1;
+        
+        for (int32_t line = 0; line < cells; line++) {
+            int32_t neighborLine = line + step;
+            for (int32_t a = 0; a < cells; ) {
+                int32_t i = alongZ ? a * cells + line : line * cells + a;
+                int32_t top = heights[i];
+                int32_t bottom = 0;
+                if (neighborLine >= 0 && neighborLine < cells) {
+                    bottom = heights[alongZ ? a * cells + neighborLine : neighborLine * cells + a];
+                }
+                if (top <= bottom) {
+                    a++;
+                    continue;
+                }
                 
-                // Face -Z (traseira)
-                if (!IsBlockSolid(world, globalX, globalY, globalZ - 1)) {
-                    Vector3 normal = {0.0f, 0.0f, -1.0f};
-                    if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                        AddFace(mesh, blockPos, FACE_NEGATIVE_Z, color);
+                int32_t run = 1;
+                while (a + run < cells) {
+                    int32_t j = alongZ ? (a + run) * cells + line : line * cells + a + run;
+                    int32_t nextBottom = 0;
+                    if (neighborLine >= 0 && neighborLine < cells) {
+                        nextBottom = heights[alongZ ? (a + run) * cells + neighborLine : neighborLine * cells + a + run];
                     }
+                    if (heights[j] != top || nextBottom != bottom || types[j] != types[i]) break;
+                    run++;
                 }
                 
-                // Face +Z (frontal)
-                if (!IsBlockSolid(world, globalX, globalY, globalZ + 1)) {
-                    Vector3 normal = {0.0f, 0.0f, 1.0f};
-                    if (ShouldRenderFace(normal, cameraPos, blockCenter)) {
-                        AddFace(mesh, blockPos, FACE_POSITIVE_Z, color);
-                    }
+                int32_t fixed = line * cell + ((step > 0) ? cell - 1 : 0); // AddQuad soma 1 nas faces +
+                int32_t x = alongZ ? fixed : a * cell;
+                int32_t z = alongZ ? a * cell : fixed;
+                AddQuad(mesh, x, bottom, z, dir, run * cell, top - bottom, types[i], LOD_AO_OPEN, light[dir]);
+                a += run;
+            }
+        }
+    }
+    return true;
+}
+
+// Guarda as maiores faces opacas (área >= VOXEL_MESH_OCCLUDER_MIN_AREA) como oclusores
+static void CollectOccluders(VoxelMesh* mesh) {
+    int32_t areas[VOXEL_MESH_MAX_OCCLUDERS];
+    mesh->occluderCount = 0;
+    for (int32_t q = 0; q + 4 <= mesh->opaqueVertexCount; q += 4) {
+        const VoxelVertex* v = &mesh->vertices[q];
+        VoxelOccluderQuad quad = {v[0].x, v[0].z, v[0].x, v[0].z, v[0].y, v[0].y};
+        for (int32_t k = 1; k < 4; k++) {
+            if (v[k].x < quad.minX) quad.minX = v[k].x;
+            if (v[k].x > quad.maxX) quad.maxX = v[k].x;
+            if (v[k].z < quad.minZ) quad.minZ = v[k].z;
+            if (v[k].z > quad.maxZ) quad.maxZ = v[k].z;
+            if (v[k].y < quad.minY) quad.minY = v[k].y;
+            if (v[k].y > quad.maxY) quad.maxY = v[k].y;
+        }
+        int32_t dx = quad.maxX - quad.minX, dy = quad.maxY - quad.minY, dz = quad.maxZ - quad.minZ;
+        int32_t area = (dx == 0) ? dy * dz : (dy == 0) ? dx * dz : dx * dy;
+        if (area < VOXEL_MESH_OCCLUDER_MIN_AREA) continue;
+        
+        int32_t slot = mesh->occluderCount;
+        if (slot == VOXEL_MESH_MAX_OCCLUDERS) {   // Cheio: troca a menor, se for maior
+            slot = 0;
+            for (int32_t i = 1; i < VOXEL_MESH_MAX_OCCLUDERS; i++) {
+                if (areas[i] < areas[slot]) slot = i;
+            }
+            if (areas[slot] >= area) continue;
+        } else {
+            mesh->occluderCount++;
+        }
+        mesh->occluders[slot] = quad;
+        areas[slot] = area;
+    }
+}
+
+bool VoxelMesh_BuildFromSnapshot(VoxelMesh* mesh, const VoxelMeshSnapshot* snap, VoxelMeshScratch* scratch) {
+    if (!mesh || !mesh->initialized || !snap || !snap->chunk || !scratch) return false;
+    const Chunk* chunk = snap->chunk;
+    
+    memset(&mesh->chunkStats, 0, sizeof(mesh->chunkStats));
+    mesh->vertexCount = 0;
+    mesh->opaqueVertexCount = 0;
+    mesh->occluderCount = 0;
+    mesh->translucentSorted = false;
+    mesh->originX = chunk->chunkX * CHUNK_SIZE_X;
+    mesh->originZ = chunk->chunkZ * CHUNK_SIZE_Z;
+    
+    // Faixa Y ocupada: só seções com algum bloco (evita varrer as 256 camadas)
+    int32_t yMin = -1, yMax = -1;
+    mesh->sectionMask = 0;
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        if (Chunk_IsSectionEmpty(chunk, s)) continue;
+        if (yMin < 0) yMin = s * CHUNK_SECTION_HEIGHT;
+        yMax = (s + 1) * CHUNK_SECTION_HEIGHT - 1;
+        mesh->sectionMask |= (uint16_t)(1u << s);
+    }
+    mesh->minY = (yMin < 0) ? 0 : yMin;
+    mesh->maxY = yMax + 1;
+    
+    if (snap->lod > 0) {
+        mesh->minY = 0;                               // Saias descem até o chão
+        if (yMax >= 0) mesh->sectionMask = (uint16_t)((1u << (yMax / CHUNK_SECTION_HEIGHT + 1)) - 1u);
+        bool built = BuildHeightfieldLod(mesh, snap); // visibleFaces = células com topo; sem sólidos
+        mesh->opaqueVertexCount = mesh->vertexCount;  // Longe demais para o passe ordenado
+        mesh->chunkStats.vertexCount = mesh->vertexCount;
+        return built;
+    }
+    
+    if (yMin < 0) return true;
+    
+    // Passe 1 (contagem): sólidos e faces expostas só com as linhas de bits. Cada quad
+    // cobre ao menos uma face, então 4 vértices por face é o teto: uma reserva por build,
+    // nenhum crescimento durante o preenchimento.
+    BuildPaddedInput(scratch, snap, yMin, yMax);
+    for (int32_t y = yMin; y <= yMax; y++) {
+        int32_t py = y - scratch->yBase;
+        for (int32_t pz = 1; pz <= CHUNK_SIZE_Z; pz++) {
+            uint32_t bits = scratch->occupancy[py * VOXEL_MESH_PADDED_DIM + pz];
+            mesh->chunkStats.solidBlocks += __builtin_popcount(bits & MESH_INNER_BITS);
+            for (int32_t dir = FACE_NEGATIVE_X; dir <= FACE_POSITIVE_Z; dir++) {
+                mesh->chunkStats.visibleFaces += __builtin_popcount(VisibleFaceBits(scratch, (FaceDirection)dir, py, pz, false));
+                if (scratch->ownTranslucent) {
+                    mesh->chunkStats.visibleFaces += __builtin_popcount(VisibleFaceBits(scratch, (FaceDirection)dir, py, pz, true));
                 }
-                */
             }
         }
     }
+    mesh->chunkStats.naiveVertexCount = mesh->chunkStats.solidBlocks * 36;
+    if (!VoxelMesh_Reserve(mesh, mesh->chunkStats.visibleFaces * 4)) return false;
+    
+    // Passe 2 (preenchimento): opacos e depois translúcidos, em faixas contíguas
+    for (int32_t dir = FACE_NEGATIVE_X; dir <= FACE_POSITIVE_Z; dir++) {
+        GreedyMeshDirection(mesh, scratch, (FaceDirection)dir, yMin, yMax, snap->faceLight[dir], false);
+    }
+    mesh->opaqueVertexCount = mesh->vertexCount;
+    CollectOccluders(mesh);
+    for (int32_t dir = FACE_NEGATIVE_X; scratch->ownTranslucent && dir <= FACE_POSITIVE_Z; dir++) {
+        GreedyMeshDirection(mesh, scratch, (FaceDirection)dir, yMin, yMax, snap->faceLight[dir], true);
+    }
+    
+    mesh->chunkStats.translucentQuads = (mesh->vertexCount - mesh->opaqueVertexCount) / 4;
+    mesh->chunkStats.vertexCount = mesh->vertexCount;
+    return true;
+}
+
+void VoxelMesh_GenerateChunk(VoxelMesh* mesh, VoxelWorld* world, 
+                             int32_t chunkX, int32_t chunkZ,
+                             float playerX, float playerY, float playerZ) {
+    (void)playerX; (void)playerY; (void)playerZ; // Culling por câmera fica para o renderer
+    VoxelMesh_GenerateChunkLod(mesh, world, chunkX, chunkZ, 0);
 }
 
-void VoxelMesh_Render(VoxelMesh* mesh, Camera3D* camera) {
-    if (!mesh || !mesh->initialized || !camera || mesh->vertexCount == 0) return;
+void VoxelMesh_GenerateChunkLod(VoxelMesh* mesh, VoxelWorld* world, int32_t chunkX, int32_t chunkZ, int32_t lod) {
+    if (!mesh || !mesh->initialized || !world) return;
     
-    // Renderiza usando DrawTriangle3D para cada triângulo
-    // DrawTriangle3D renderiza faces sólidas (não wireframe)
-    for (int32_t i = 0; i < mesh->vertexCount; i += 3) {
-        if (i + 2 >= mesh->vertexCount) break;
-        
-        Vector3 v1 = mesh->vertices[i].position;
-        Vector3 v2 = mesh->vertices[i + 1].position;
-        Vector3 v3 = mesh->vertices[i + 2].position;
-        Color color = mesh->vertices[i].color;
+    memset(&mesh->chunkStats, 0, sizeof(mesh->chunkStats));
+    mesh->vertexCount = 0;
+    mesh->opaqueVertexCount = 0;
+    mesh->occluderCount = 0;
+    
+    VoxelMeshSnapshot* snap = (VoxelMeshSnapshot*)calloc(1, sizeof(VoxelMeshSnapshot));
+    VoxelMeshScratch* scratch = (VoxelMeshScratch*)malloc(sizeof(VoxelMeshScratch));
+    if (snap && scratch && VoxelMeshSnapshot_Capture(snap, world, chunkX, chunkZ, lod)) {
+        VoxelMesh_BuildFromSnapshot(mesh, snap, scratch);
+    }
+    VoxelMeshSnapshot_Release(snap);
+    free(scratch);
+    free(snap);
+}
+
+void VoxelMesh_Relight(VoxelMesh* mesh, const uint8_t faceLight[6]) {
+    if (!mesh || !mesh->initialized || !faceLight) return;
+    for (int32_t i = 0; i < mesh->vertexCount; i++) {
+        VoxelVertex* vertex = &mesh->vertices[i];
+        vertex->light = BakeLight(faceLight[vertex->face % 6], vertex->ao);
+    }
+}
+
+void VoxelMesh_SwapVertices(VoxelMesh* a, VoxelMesh* b) {
+    if (!a || !b) return;
+    VoxelMesh tmp = *a;
+    a->vertices = b->vertices;
+    a->vertexCount = b->vertexCount;
+    a->opaqueVertexCount = b->opaqueVertexCount;
+    a->vertexCapacity = b->vertexCapacity;
+    a->initialized = b->initialized;
+    a->originX = b->originX;
+    a->originZ = b->originZ;
+    a->minY = b->minY;
+    a->maxY = b->maxY;
+    a->sectionMask = b->sectionMask;
+    memcpy(a->occluders, b->occluders, sizeof(a->occluders));
+    a->occluderCount = b->occluderCount;
+    a->chunkStats = b->chunkStats;
+    b->vertices = tmp.vertices;
+    b->vertexCount = tmp.vertexCount;
+    b->opaqueVertexCount = tmp.opaqueVertexCount;
+    b->vertexCapacity = tmp.vertexCapacity;
+    b->initialized = tmp.initialized;
+    b->originX = tmp.originX;
+    b->originZ = tmp.originZ;
+    b->minY = tmp.minY;
+    b->maxY = tmp.maxY;
+    b->sectionMask = tmp.sectionMask;
+    memcpy(b->occluders, tmp.occluders, sizeof(b->occluders));
+    b->occluderCount = tmp.occluderCount;
+    b->chunkStats = tmp.chunkStats;
+    a->translucentSorted = false; // Quads novos: ordena de novo no próximo passe translúcido
+    b->translucentSorted = false;
+}
+
+// ============================================================================
+// GPU
+// ============================================================================
+
+#define VOXEL_GL_UNSIGNED_SHORT 0x1403 // GL_UNSIGNED_SHORT (rlgl só define BYTE/FLOAT)
+
+// Locations fixas em voxel_packed.vs (layout(location = N))
+#define VOXEL_ATTRIB_PACKED 0   // x, z, face, blockType (4 x u8)
+#define VOXEL_ATTRIB_HEIGHT 1   // y (u16)
+#define VOXEL_ATTRIB_LIGHT  2   // light (u8)
+
+#if defined(USE_RLGL)
+// Índices de quad (0,1,2, 0,2,3 + 4q) para VOXEL_MESH_QUADS_PER_DRAW quads, compartilhados
+// por todos os VAOs de chunk. Criado no primeiro upload.
+static unsigned int g_quadIndexBufferId = 0;
+
+static bool EnsureQuadIndexBuffer(void) {
+    if (g_quadIndexBufferId != 0) return true;
+    
+    unsigned short* indices = (unsigned short*)malloc(VOXEL_MESH_QUADS_PER_DRAW * 6 * sizeof(unsigned short));
+    if (!indices) return false;
+    for (int32_t q = 0; q < VOXEL_MESH_QUADS_PER_DRAW; q++) {
+        unsigned short base = (unsigned short)(q * 4);
+        unsigned short* quad = &indices[q * 6];
+        quad[0] = base;     quad[1] = base + 1; quad[2] = base + 2;
+        quad[3] = base;     quad[4] = base + 2; quad[5] = base + 3;
+    }
+    g_quadIndexBufferId = rlLoadVertexBufferElement(indices, VOXEL_MESH_QUADS_PER_DRAW * 6 * (int)sizeof(unsigned short), false);
+    free(indices);
+    return g_quadIndexBufferId != 0;
+}
+
+// Aponta os atributos do VAO/VBO ativos para os vértices a partir de baseVertex
+// (índices são u16: meshes maiores que um lote desenham em partes)
+static void SetVertexAttributes(int32_t baseVertex) {
+    const int stride = (int)sizeof(VoxelVertex);
+    const int base = baseVertex * stride;
+    rlSetVertexAttribute(VOXEL_ATTRIB_PACKED, 4, RL_UNSIGNED_BYTE, false, stride, base + (int)offsetof(VoxelVertex, x));
+    rlEnableVertexAttribute(VOXEL_ATTRIB_PACKED);
+    rlSetVertexAttribute(VOXEL_ATTRIB_HEIGHT, 1, VOXEL_GL_UNSIGNED_SHORT, false, stride, base + (int)offsetof(VoxelVertex, y));
+    rlEnableVertexAttribute(VOXEL_ATTRIB_HEIGHT);
+    rlSetVertexAttribute(VOXEL_ATTRIB_LIGHT, 1, RL_UNSIGNED_BYTE, false, stride, base + (int)offsetof(VoxelVertex, light));
+    rlEnableVertexAttribute(VOXEL_ATTRIB_LIGHT);
+}
+#endif
+
+// Área de ordenação dos quads translúcidos (thread de render; cresce até o maior chunk visto)
+typedef struct {
+    float distance;     // Distância² da câmera ao centro do quad
+    int32_t quad;       // Índice do quad na faixa translúcida
+} TranslucentSortKey;
+
+static TranslucentSortKey* g_sortKeys = NULL;
+static VoxelVertex* g_sortVertices = NULL;
+static int32_t g_sortCapacity = 0; // Quads
+
+void VoxelMesh_UnloadShared(void) {
+#if defined(USE_RLGL)
+    if (g_quadIndexBufferId != 0) rlUnloadVertexBuffer(g_quadIndexBufferId);
+    g_quadIndexBufferId = 0;
+#endif
+    free(g_sortKeys);
+    free(g_sortVertices);
+    g_sortKeys = NULL;
+    g_sortVertices = NULL;
+    g_sortCapacity = 0;
+}
+
+void VoxelMesh_Upload(VoxelMesh* mesh) {
+    if (!mesh || !mesh->initialized) return;
+#if defined(USE_RLGL)
+    int32_t bytes = mesh->vertexCount * (int32_t)sizeof(VoxelVertex);
+    mesh->gpuVertexCount = mesh->vertexCount;
+    if (mesh->vertexCount == 0) return; // VBO antigo fica para o próximo upload
+    
+    if (mesh->vaoId == 0) {
+        if (EnsureQuadIndexBuffer()) mesh->vaoId = rlLoadVertexArray();
+        if (mesh->vaoId == 0) {
+            mesh->gpuVertexCount = 0; // Sem VAO (GL antigo): fica no DrawTriangle3D
+            return;
+        }
+        rlEnableVertexArray(mesh->vaoId);
+        rlEnableVertexBufferElement(g_quadIndexBufferId); // fica gravado no VAO
+    } else {
+        rlEnableVertexArray(mesh->vaoId);
+    }
+    
+    if (mesh->vboId != 0 && mesh->vertexCount <= mesh->gpuVertexCapacity) {
+        rlUpdateVertexBuffer(mesh->vboId, mesh->vertices, bytes, 0);
+    } else {
+        if (mesh->vboId != 0) rlUnloadVertexBuffer(mesh->vboId);
+        // Mesma folga do array da CPU: edições pequenas não realocam o VBO
+        mesh->vboId = rlLoadVertexBuffer(mesh->vertices, mesh->vertexCapacity * (int32_t)sizeof(VoxelVertex), true);
+        mesh->gpuVertexCapacity = mesh->vertexCapacity;
+        rlUpdateVertexBuffer(mesh->vboId, mesh->vertices, bytes, 0);
+        SetVertexAttributes(0);
+    }
+    rlDisableVertexArray();
+#endif
+}
+
+// Mais longe primeiro
+static int CompareSortKeys(const void* a, const void* b) {
+    float da = ((const TranslucentSortKey*)a)->distance;
+    float db = ((const TranslucentSortKey*)b)->distance;
+    return (da < db) - (da > db);
+}
+
+bool VoxelMesh_SortTranslucent(VoxelMesh* mesh, Vector3 cameraPosition) {
+    if (!mesh || !mesh->initialized) return false;
+    int32_t quadCount = (mesh->vertexCount - mesh->opaqueVertexCount) / 4;
+    if (quadCount < 2) return false; // Nada a ordenar
+    if (mesh->translucentSorted) {
+        float dx = cameraPosition.x - mesh->sortCamera.x;
+        float dy = cameraPosition.y - mesh->sortCamera.y;
+        float dz = cameraPosition.z - mesh->sortCamera.z;
+        if (dx * dx + dy * dy + dz * dz < VOXEL_MESH_SORT_THRESHOLD * VOXEL_MESH_SORT_THRESHOLD) return false;
+    }
+    
+    if (quadCount > g_sortCapacity) {
+        TranslucentSortKey* keys = (TranslucentSortKey*)realloc(g_sortKeys, (size_t)quadCount * sizeof(TranslucentSortKey));
+        if (keys) g_sortKeys = keys;
+        VoxelVertex* vertices = (VoxelVertex*)realloc(g_sortVertices, (size_t)quadCount * 4 * sizeof(VoxelVertex));
+        if (vertices) g_sortVertices = vertices;
+        if (!keys || !vertices) return false; // Fica na ordem anterior
+        g_sortCapacity = quadCount;
+    }
+    
+    // Centro do quad = média dos 4 cantos (coordenadas locais x4 para ficar em inteiros)
+    VoxelVertex* quads = &mesh->vertices[mesh->opaqueVertexCount];
+    float camX = (cameraPosition.x - (float)mesh->originX) * 4.0f;
+    float camY = cameraPosition.y * 4.0f;
+    float camZ = (cameraPosition.z - (float)mesh->originZ) * 4.0f;
+    for (int32_t q = 0; q < quadCount; q++) {
+        const VoxelVertex* v = &quads[q * 4];
+        float dx = (float)(v[0].x + v[1].x + v[2].x + v[3].x) - camX;
+        float dy = (float)(v[0].y + v[1].y + v[2].y + v[3].y) - camY;
+        float dz = (float)(v[0].z + v[1].z + v[2].z + v[3].z) - camZ;
+        g_sortKeys[q].distance = dx * dx + dy * dy + dz * dz;
+        g_sortKeys[q].quad = q;
+    }
+    qsort(g_sortKeys, (size_t)quadCount, sizeof(TranslucentSortKey), CompareSortKeys);
+    for (int32_t i = 0; i < quadCount; i++) {
+        memcpy(&g_sortVertices[i * 4], &quads[g_sortKeys[i].quad * 4], 4 * sizeof(VoxelVertex));
+    }
+    memcpy(quads, g_sortVertices, (size_t)quadCount * 4 * sizeof(VoxelVertex));
+    mesh->translucentSorted = true;
+    mesh->sortCamera = cameraPosition;
+    
+#if defined(USE_RLGL)
+    // Só a faixa translúcida; mesh ainda não enviado leva a ordem nova no próximo upload
+    if (mesh->vboId != 0 && mesh->gpuVertexCount == mesh->vertexCount) {
+        rlUpdateVertexBuffer(mesh->vboId, quads, quadCount * 4 * (int32_t)sizeof(VoxelVertex),
+                             mesh->opaqueVertexCount * (int32_t)sizeof(VoxelVertex));
+    }
+#endif
+    return true;
+}
+
+void VoxelMesh_InitShader(VoxelMeshShader* shader, unsigned int shaderId) {
+    if (!shader) return;
+    memset(shader, 0, sizeof(*shader));
+    shader->shaderId = shaderId;
+#if defined(USE_RLGL)
+    if (shaderId == 0) return;
+    shader->locMvp = rlGetLocationUniform(shaderId, "mvp");
+    shader->locMatView = rlGetLocationUniform(shaderId, "matView");
+    shader->locChunkOrigin = rlGetLocationUniform(shaderId, "chunkOrigin");
+    shader->locBlockColors = rlGetLocationUniform(shaderId, "blockColors");
+    shader->locColDiffuse = rlGetLocationUniform(shaderId, "colDiffuse");
+    shader->locTexture0 = rlGetLocationUniform(shaderId, "texture0");
+    shader->locFaceOffset = rlGetLocationUniform(shaderId, "faceOffset");
+    if (shader->locMvp < 0 || shader->locChunkOrigin < 0 || shader->locBlockColors < 0) {
+        shader->shaderId = 0; // Shader não é o voxel_packed.vs
+    }
+#endif
+}
+
+bool VoxelMesh_BeginShader(const VoxelMeshShader* shader) {
+#if defined(USE_RLGL)
+    if (!shader || shader->shaderId == 0) return false;
+    
+    rlDrawRenderBatchActive(); // o batch usa outro shader/VAO
+    rlEnableShader(shader->shaderId);
+    
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matMvp = MatrixMultiply(matView, rlGetMatrixProjection());
+    rlSetUniformMatrix(shader->locMvp, matMvp);
+    if (shader->locMatView >= 0) rlSetUniformMatrix(shader->locMatView, matView);
+    
+    // Paleta: blockType -> cor (mesma tabela do VoxelRenderer)
+    float colors[VOXEL_MESH_PALETTE_SIZE * 4];
+    for (int32_t i = 0; i < VOXEL_MESH_PALETTE_SIZE; i++) {
+        BlockColor c = VoxelRenderer_GetBlockColor((uint8_t)i);
+        colors[i * 4 + 0] = c.r / 255.0f;
+        colors[i * 4 + 1] = c.g / 255.0f;
+        colors[i * 4 + 2] = c.b / 255.0f;
+        colors[i * 4 + 3] = c.a / 255.0f;
+    }
+    rlSetUniform(shader->locBlockColors, colors, RL_SHADER_UNIFORM_VEC4, VOXEL_MESH_PALETTE_SIZE);
+    
+    // fog_forward.fs multiplica pela textura e colDiffuse: textura branca padrão
+    VoxelMesh_SetShaderTint(shader, WHITE, 0.0f);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(rlGetTextureIdDefault());
+    if (shader->locTexture0 >= 0) rlSetUniformSampler(shader->locTexture0, 0);
+    return true;
+#else
+    (void)shader;
+    return false;
+#endif
+}
+
+void VoxelMesh_SetShaderTint(const VoxelMeshShader* shader, Color tint, float faceOffset) {
+#if defined(USE_RLGL)
+    if (!shader || shader->shaderId == 0) return;
+    if (shader->locColDiffuse >= 0) {
+        float color[4] = {tint.r / 255.0f, tint.g / 255.0f, tint.b / 255.0f, tint.a / 255.0f};
+        rlSetUniform(shader->locColDiffuse, color, RL_SHADER_UNIFORM_VEC4, 1);
+    }
+    if (shader->locFaceOffset >= 0) rlSetUniform(shader->locFaceOffset, &faceOffset, RL_SHADER_UNIFORM_FLOAT, 1);
+#else
+    (void)shader; (void)tint; (void)faceOffset;
+#endif
+}
+
+void VoxelMesh_EndShader(const VoxelMeshShader* shader) {
+#if defined(USE_RLGL)
+    if (!shader || shader->shaderId == 0) return;
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+#else
+    (void)shader;
+#endif
+}
+
+// Desenha os quads [firstQuad, firstQuad + quadCount): draws indexados do VAO se houver
+// shader ativo e upload feito; senão decodifica e usa DrawTriangle3D
+static void DrawQuadRange(VoxelMesh* mesh, const VoxelMeshShader* shader, int32_t firstQuad, int32_t quadCount) {
+    if (quadCount <= 0) return;
+    
+#if defined(USE_RLGL)
+    if (shader && shader->shaderId != 0 && mesh->vaoId != 0 && mesh->gpuVertexCount > 0) {
+        float origin[3] = {(float)mesh->originX, 0.0f, (float)mesh->originZ};
+        rlSetUniform(shader->locChunkOrigin, origin, RL_SHADER_UNIFORM_VEC3, 1);
+        rlEnableVertexArray(mesh->vaoId);
+        if (firstQuad + quadCount <= VOXEL_MESH_QUADS_PER_DRAW) {
+            rlDrawVertexArrayElements(firstQuad * 6, quadCount * 6, 0); // um draw indexado
+            return;
+        }
         
-        // DrawTriangle3D renderiza triângulos sólidos com cor
-        DrawTriangle3D(v1, v2, v3, color);
+        // Além do buffer de índices (u16): lotes deslocando a base dos atributos
+        rlEnableVertexBuffer(mesh->vboId);
+        for (int32_t first = firstQuad; first < firstQuad + quadCount; first += VOXEL_MESH_QUADS_PER_DRAW) {
+            int32_t count = firstQuad + quadCount - first;
+            if (count > VOXEL_MESH_QUADS_PER_DRAW) count = VOXEL_MESH_QUADS_PER_DRAW;
+            SetVertexAttributes(first * 4);
+            rlDrawVertexArrayElements(0, count * 6, 0);
+        }
+        SetVertexAttributes(0);
+        rlDisableVertexBuffer();
+        return;
+    }
+#else
+    (void)shader;
+#endif
+    
+    // Fallback: decodifica e renderiza cada quad com dois DrawTriangle3D
+    for (int32_t q = firstQuad; q < firstQuad + quadCount; q++) {
+        Vector3 v[4];
+        for (int32_t k = 0; k < 4; k++) {
+            const VoxelVertex* vertex = &mesh->vertices[q * 4 + k];
+            v[k] = (Vector3){(float)(mesh->originX + vertex->x), (float)vertex->y,
+                             (float)(mesh->originZ + vertex->z)};
+        }
+        const VoxelVertex* first = &mesh->vertices[q * 4];
+        BlockColor c = VoxelRenderer_GetBlockColor(first->blockType);
+        Color color = {(unsigned char)(c.r * first->light / 255), (unsigned char)(c.g * first->light / 255),
+                       (unsigned char)(c.b * first->light / 255), c.a};
+        DrawTriangle3D(v[0], v[1], v[2], color);
+        DrawTriangle3D(v[0], v[2], v[3], color);
     }
 }
+
+void VoxelMesh_Render(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera) {
+    if (!mesh || !mesh->initialized || !camera) return;
+    DrawQuadRange(mesh, shader, 0, mesh->opaqueVertexCount / 4);
+}
+
+void VoxelMesh_RenderAll(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera) {
+    if (!mesh || !mesh->initialized || !camera) return;
+    DrawQuadRange(mesh, shader, 0, mesh->vertexCount / 4);
+}
+
+void VoxelMesh_RenderTranslucent(VoxelMesh* mesh, const VoxelMeshShader* shader, Camera3D* camera) {
+    if (!mesh || !mesh->initialized || !camera) return;
+    int32_t firstQuad = mesh->opaqueVertexCount / 4;
+    DrawQuadRange(mesh, shader, firstQuad, mesh->vertexCount / 4 - firstQuad);
+}
@@ -0,0 +1,207 @@
+#include "app/render/voxel_mesh_jobs.h"
+#include "core/thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define VOXEL_MESH_MAX_WORKERS 4
+
+typedef struct MeshWorker {
+    struct VoxelMeshJobs* jobs;
+    Thread* thread;
+    VoxelMeshScratch* scratch;  // Entrada acolchoada, reaproveitada entre jobs
+} MeshWorker;
+
+struct VoxelMeshJobs {
+    Mutex* lock;
+    CondVar* wake;
+    MeshWorker workers[VOXEL_MESH_MAX_WORKERS];
+    int32_t workerCount;
+    bool quit;
+
+    // Protegido por `lock`
+    VoxelMeshJob* queueHead;    // FIFO de entrada
+    VoxelMeshJob* queueTail;
+    VoxelMeshJob* doneHead;     // FIFO de prontos
+    VoxelMeshJob* doneTail;
+    int32_t pendingCount;       // Na fila + construindo + prontos não recolhidos
+    
+    // Só na thread que submete (sem lock)
+    VoxelMeshJob* poolHead;     // Jobs ociosos para reuso
+    int32_t poolCount;
+};
+
+static void Jobs_Append(VoxelMeshJob** head, VoxelMeshJob** tail, VoxelMeshJob* job) {
+    job->next = NULL;
+    if (*tail) (*tail)->next = job;
+    else *head = job;
+    *tail = job;
+}
+
+static VoxelMeshJob* Jobs_PopFront(VoxelMeshJob** head, VoxelMeshJob** tail) {
+    VoxelMeshJob* job = *head;
+    if (!job) return NULL;
+    *head = job->next;
+    if (!*head) *tail = NULL;
+    job->next = NULL;
+    return job;
+}
+
+static void MeshWorker_Main(void* userData) {
+    MeshWorker* worker = (MeshWorker*)userData;
+    VoxelMeshJobs* jobs = worker->jobs;
+
+    Mutex_Lock(jobs->lock);
+    for (;;) {
+        VoxelMeshJob* job = Jobs_PopFront(&jobs->queueHead, &jobs->queueTail);
+        if (!job) {
+            if (jobs->quit) break;
+            CondVar_Wait(jobs->wake, jobs->lock);
+            continue;
+        }
+        Mutex_Unlock(jobs->lock);
+
+        job->built = VoxelMesh_BuildFromSnapshot(&job->mesh, &job->snapshot, worker->scratch);
+
+        Mutex_Lock(jobs->lock);
+        Jobs_Append(&jobs->doneHead, &jobs->doneTail, job);
+    }
+    Mutex_Unlock(jobs->lock);
+}
+
+VoxelMeshJobs* VoxelMeshJobs_Create(int32_t workerCount) {
+    if (workerCount <= 0) workerCount = Thread_GetCpuCount() - 1;
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > VOXEL_MESH_MAX_WORKERS) workerCount = VOXEL_MESH_MAX_WORKERS;
+
+    VoxelMeshJobs* jobs = (VoxelMeshJobs*)calloc(1, sizeof(VoxelMeshJobs));
+    if (!jobs) return NULL;
+
+    jobs->lock = Mutex_Create();
+    jobs->wake = CondVar_Create();
+    if (jobs->lock && jobs->wake) {
+        for (int32_t i = 0; i < workerCount; i++) {
+            MeshWorker* worker = &jobs->workers[i];
+            worker->jobs = jobs;
+            worker->scratch = (VoxelMeshScratch*)malloc(sizeof(VoxelMeshScratch));
+            if (worker->scratch) worker->thread = Thread_Create(MeshWorker_Main, worker);
+            if (!worker->thread) {
+                free(worker->scratch);
+                worker->scratch = NULL;
+                break;
+            }
+            jobs->workerCount++;
+        }
+    }
+    if (jobs->workerCount == 0) {
+        if (jobs->wake) CondVar_Destroy(jobs->wake);
+        if (jobs->lock) Mutex_Destroy(jobs->lock);
+        free(jobs);
+        return NULL;
+    }
+    return jobs;
+}
+
+void VoxelMeshJobs_Destroy(VoxelMeshJobs* jobs) {
+    if (!jobs) return;
+
+    Mutex_Lock(jobs->lock);
+    jobs->quit = true;
+    // Descarta o que nem começou: workers só terminam o job atual
+    VoxelMeshJob* queued = jobs->queueHead;
+    jobs->queueHead = jobs->queueTail = NULL;
+    CondVar_Broadcast(jobs->wake);
+    Mutex_Unlock(jobs->lock);
+
+    for (int32_t i = 0; i < jobs->workerCount; i++) {
+        Thread_Join(jobs->workers[i].thread);
+        free(jobs->workers[i].scratch);
+    }
+
+    while (queued) {
+        VoxelMeshJob* next = queued->next;
+        VoxelMeshJob_Destroy(queued);
+        queued = next;
+    }
+    VoxelMeshJob* done;
+    while ((done = Jobs_PopFront(&jobs->doneHead, &jobs->doneTail)) != NULL) {
+        VoxelMeshJob_Destroy(done);
+    }
+
+    while (jobs->poolHead) {
+        VoxelMeshJob* next = jobs->poolHead->next;
+        VoxelMeshJob_Destroy(jobs->poolHead);
+        jobs->poolHead = next;
+    }
+    
+    CondVar_Destroy(jobs->wake);
+    Mutex_Destroy(jobs->lock);
+    free(jobs);
+}
+
+VoxelMeshJob* VoxelMeshJob_Create(void) {
+    VoxelMeshJob* job = (VoxelMeshJob*)calloc(1, sizeof(VoxelMeshJob));
+    if (!job) return NULL;
+    VoxelMesh_Init(&job->mesh);
+    if (!job->mesh.initialized) {
+        free(job);
+        return NULL;
+    }
+    return job;
+}
+
+void VoxelMeshJob_Destroy(VoxelMeshJob* job) {
+    if (!job) return;
+    VoxelMeshSnapshot_Release(&job->snapshot);
+    VoxelMesh_Destroy(&job->mesh);
+    free(job);
+}
+
+VoxelMeshJob* VoxelMeshJobs_AcquireJob(VoxelMeshJobs* jobs) {
+    if (jobs && jobs->poolHead) {
+        VoxelMeshJob* job = jobs->poolHead;
+        jobs->poolHead = job->next;
+        jobs->poolCount--;
+        job->next = NULL;
+        return job;
+    }
+    return VoxelMeshJob_Create();
+}
+
+void VoxelMeshJobs_RecycleJob(VoxelMeshJobs* jobs, VoxelMeshJob* job) {
+    if (!job) return;
+    if (!jobs || jobs->poolCount >= VOXEL_MESH_JOB_POOL_MAX) {
+        VoxelMeshJob_Destroy(job);
+        return;
+    }
+    job->built = false;
+    job->mesh.vertexCount = 0;
+    job->next = jobs->poolHead;
+    jobs->poolHead = job;
+    jobs->poolCount++;
+}
+
+void VoxelMeshJobs_Submit(VoxelMeshJobs* jobs, VoxelMeshJob* job) {
+    if (!jobs || !job) return;
+    Mutex_Lock(jobs->lock);
+    Jobs_Append(&jobs->queueHead, &jobs->queueTail, job);
+    jobs->pendingCount++;
+    CondVar_Signal(jobs->wake);
+    Mutex_Unlock(jobs->lock);
+}
+
+VoxelMeshJob* VoxelMeshJobs_PollFinished(VoxelMeshJobs* jobs) {
+    if (!jobs) return NULL;
+    Mutex_Lock(jobs->lock);
+    VoxelMeshJob* job = Jobs_PopFront(&jobs->doneHead, &jobs->doneTail);
+    if (job) jobs->pendingCount--;
+    Mutex_Unlock(jobs->lock);
+    return job;
+}
+
+int32_t VoxelMeshJobs_GetPendingCount(VoxelMeshJobs* jobs) {
+    if (!jobs) return 0;
+    Mutex_Lock(jobs->lock);
+    int32_t count = jobs->pendingCount;
+    Mutex_Unlock(jobs->lock);
+    return count;
+}
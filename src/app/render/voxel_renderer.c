@@ -1,38 +1,336 @@
 #include "app/render/voxel_renderer.h"
 #include "app/render/voxel_mesh.h"
+#include "app/render/voxel_mesh_jobs.h"
 #include "core/world/voxel_world.h"
 #include "core/world/chunk.h"
 #include "core/math/core_math.h"
 #include <raylib.h>
+#if defined(USE_RLGL)
+#include <rlgl.h>
+#endif
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
-// Mesh estático para renderização (reutilizado entre chunks)
-static VoxelMesh g_chunkMesh = {0};
-static bool g_meshInitialized = false;
+// Mesh de um chunk + versões com que foi gerado
+struct VoxelChunkMesh {
+    bool used;
+    int32_t chunkX;
+    int32_t chunkZ;
+    uint32_t version;               // Chunk->version na geração
+    uint32_t neighborVersions[VOXEL_MESH_NEIGHBOR_COUNT]; // Borda voltada para cá de cada vizinho (0 = ausente)
+    uint32_t lightingVersion;       // Luz assada nos vértices
+    uint8_t lod;                    // Nível de detalhe do mesh atual
+    bool jobInFlight;               // Mesh novo sendo gerado (o atual continua desenhando)
+    bool drawn;                     // Passou no culling do último Render (wireframe reaproveita)
+    uint32_t jobSerial;             // Job esperado; resultados de jobs anteriores são descartados
+    VoxelMesh mesh;
+};
+
+// Chunk na fila do passe translúcido
+struct VoxelTranslucentDraw {
+    float distance;                 // Distância² da câmera ao centro do chunk
+    VoxelChunkMesh* entry;
+};
+
+// Chunk candidato a oclusor
+typedef struct {
+    float distance;                     // Distância² da câmera ao centro do chunk (XZ)
+    VoxelChunkMesh* entry;
+} VoxelOccluderChunk;
+
+// Culling em lote: colunas (um mesh cada) e seções ocupadas das colunas na borda
+struct VoxelCullScratch {
+    FrustumAABBBatch columns;
+    FrustumAABBBatch sections;
+    VoxelChunkMesh** columnEntries;     // Mesh de cada caixa de coluna
+    int32_t* sectionColumns;            // Coluna dona de cada caixa de seção
+    uint32_t* columnVisible;
+    uint32_t* columnInside;
+    uint32_t* sectionVisible;
+    VoxelOccluderChunk* occluderChunks; // Chunks com oclusores, ordenados por distância
+};
+
+// Mesma ordem de VOXEL_MESH_NEIGHBOR_COUNT: lados (CHUNK_SIDE_*) e cantos (-X-Z, +X-Z, -X+Z, +X+Z)
+static const int32_t g_neighborOffsets[VOXEL_MESH_NEIGHBOR_COUNT][2] = {
+    {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {1, -1}, {-1, 1}, {1, 1}
+};
+
+// Lado do vizinho n cuja versão cobre o que o mesher copia dele: o lado oposto para
+// os laterais; para os diagonais, o lado X que contém a coluna do canto.
+static const int32_t g_neighborFacingSide[VOXEL_MESH_NEIGHBOR_COUNT] = {
+    CHUNK_SIDE_POS_X, CHUNK_SIDE_NEG_X, CHUNK_SIDE_POS_Z, CHUNK_SIDE_NEG_Z,
+    CHUNK_SIDE_POS_X, CHUNK_SIDE_NEG_X, CHUNK_SIDE_POS_X, CHUNK_SIDE_NEG_X
+};
 
 static BlockColor g_blockColors[] = {
     {0, 0, 0, 0},           // BLOCK_AIR - transparente
     {20, 20, 20, 255},      // BLOCK_BLACK - preto
     {255, 50, 50, 255},     // BLOCK_RED - vermelho
-    {255, 165, 0, 255},     // BLOCK_ORANGE - laranja
+    {200, 100, 50, 255},    // BLOCK_ORANGE - laranja
     {128, 128, 128, 255},   // BLOCK_GRAY - cinza
-    {50, 255, 50, 255},     // BLOCK_GREEN - verde
-    {128, 0, 128, 200},     // BLOCK_PURPLE - roxo opaco
-    {138, 43, 226, 255},    // BLOCK_VIOLET - violeta
+    {50, 180, 80, 255},     // BLOCK_GREEN - verde
+    {120, 80, 180, 200},    // BLOCK_PURPLE - roxo translúcido (passe ordenado)
+    {120, 80, 180, 255},    // BLOCK_VIOLET - violeta
     {101, 67, 33, 255},     // BLOCK_TERRAIN - marrom (terreno)
 };
 
+#define CULL_MAX_COLUMNS (VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM)
+#define CULL_MAX_SECTIONS (CULL_MAX_COLUMNS * CHUNK_SECTION_COUNT)
+
+static void DestroyCullScratch(VoxelCullScratch* cull) {
+    if (!cull) return;
+    FrustumAABBBatch_Destroy(&cull->columns);
+    FrustumAABBBatch_Destroy(&cull->sections);
+    free(cull->columnEntries);
+    free(cull->sectionColumns);
+    free(cull->columnVisible);
+    free(cull->columnInside);
+    free(cull->sectionVisible);
+    free(cull->occluderChunks);
+    free(cull);
+}
+
+static VoxelCullScratch* CreateCullScratch(void) {
+    VoxelCullScratch* cull = (VoxelCullScratch*)calloc(1, sizeof(VoxelCullScratch));
+    if (!cull) return NULL;
+    bool ok = FrustumAABBBatch_Init(&cull->columns, CULL_MAX_COLUMNS);
+    ok = FrustumAABBBatch_Init(&cull->sections, CULL_MAX_SECTIONS) && ok;
+    cull->columnEntries = (VoxelChunkMesh**)malloc(CULL_MAX_COLUMNS * sizeof(VoxelChunkMesh*));
+    cull->sectionColumns = (int32_t*)malloc(CULL_MAX_SECTIONS * sizeof(int32_t));
+    cull->columnVisible = (uint32_t*)malloc(FRUSTUM_MASK_WORDS(CULL_MAX_COLUMNS) * sizeof(uint32_t));
+    cull->columnInside = (uint32_t*)malloc(FRUSTUM_MASK_WORDS(CULL_MAX_COLUMNS) * sizeof(uint32_t));
+    cull->sectionVisible = (uint32_t*)malloc(FRUSTUM_MASK_WORDS(CULL_MAX_SECTIONS) * sizeof(uint32_t));
+    cull->occluderChunks = (VoxelOccluderChunk*)malloc(CULL_MAX_COLUMNS * sizeof(VoxelOccluderChunk));
+    if (!ok || !cull->columnEntries || !cull->sectionColumns || !cull->columnVisible ||
+        !cull->columnInside || !cull->sectionVisible || !cull->occluderChunks) {
+        DestroyCullScratch(cull);
+        return NULL;
+    }
+    return cull;
+}
+
 void VoxelRenderer_Init(VoxelRenderer* renderer) {
     if (!renderer) return;
     memset(renderer, 0, sizeof(VoxelRenderer));
-    renderer->renderDistance = 4; // 4 chunks de distância
-    renderer->initialized = true;
+    const int32_t radii[VOXEL_MESH_LOD_COUNT] = {
+        VOXEL_RENDERER_LOD0_RADIUS, VOXEL_RENDERER_LOD1_RADIUS,
+        VOXEL_RENDERER_LOD2_RADIUS, VOXEL_RENDERER_LOD3_RADIUS
+    };
+    VoxelRenderer_SetLodRadii(renderer, radii);
+    memset(renderer->faceLight, 255, sizeof(renderer->faceLight)); // Neutra até SetLighting
+    renderer->meshCache = (VoxelChunkMesh*)calloc(VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM,
+                                                  sizeof(VoxelChunkMesh));
+    renderer->translucentDraws = (VoxelTranslucentDraw*)malloc(VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM *
+                                                               sizeof(VoxelTranslucentDraw));
+    renderer->cull = CreateCullScratch();
+    OcclusionCuller_Init(&renderer->occlusion); // Sem memória: SetOcclusionView não liga
+    renderer->meshJobs = VoxelMeshJobs_Create(0); // NULL: gera na thread de render
+    renderer->initialized = (renderer->meshCache != NULL && renderer->translucentDraws != NULL &&
+                             renderer->cull != NULL);
+}
+
+static void EvictChunkMesh(VoxelRenderer* renderer, VoxelChunkMesh* entry) {
+    VoxelMesh_Destroy(&entry->mesh);
+    entry->used = false;
+    entry->jobInFlight = false; // resultado pendente não casa mais (used/serial)
+    renderer->stats.cachedMeshes--;
+    renderer->stats.meshesEvicted++;
+}
+
+bool VoxelRenderer_LoadShader(VoxelRenderer* renderer, const char* vsPath, const char* fsPath) {
+    if (!renderer || !vsPath || !fsPath) return false;
+    if (!FileExists(vsPath) || !FileExists(fsPath)) return false;
+    
+    Shader shader = LoadShader(vsPath, fsPath);
+    VoxelMesh_InitShader(&renderer->meshShader, shader.id);
+    if (renderer->meshShader.shaderId == 0) {
+        if (shader.id != 0) UnloadShader(shader);
+        TraceLog(LOG_WARNING, "Shader de voxel compactado nao carregado; usando DrawTriangle3D.");
+        return false;
+    }
+    renderer->shader = shader;
+    return true;
+}
+
+void VoxelRenderer_Destroy(VoxelRenderer* renderer) {
+    if (!renderer) return;
+    VoxelMeshJobs_Destroy(renderer->meshJobs); // antes dos meshes: workers param aqui
+    renderer->meshJobs = NULL;
+    if (renderer->meshCache) {
+        for (int32_t i = 0; i < VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM; i++) {
+            if (renderer->meshCache[i].used) VoxelMesh_Destroy(&renderer->meshCache[i].mesh);
+        }
+        free(renderer->meshCache);
+        renderer->meshCache = NULL;
+    }
+    free(renderer->translucentDraws);
+    renderer->translucentDraws = NULL;
+    DestroyCullScratch(renderer->cull);
+    renderer->cull = NULL;
+    VoxelMeshSnapshot_Release(renderer->syncSnapshot);
+    free(renderer->syncSnapshot);
+    renderer->syncSnapshot = NULL;
+    free(renderer->syncScratch);
+    renderer->syncScratch = NULL;
+    OcclusionCuller_Destroy(&renderer->occlusion);
+    renderer->occlusionEnabled = false;
+    VoxelMesh_UnloadShared();
+    if (renderer->shader.id != 0) {
+        UnloadShader(renderer->shader);
+        renderer->shader.id = 0;
+        VoxelMesh_InitShader(&renderer->meshShader, 0);
+    }
+    renderer->initialized = false;
+}
+
+static inline VoxelChunkMesh* GetCacheSlot(VoxelRenderer* renderer, int32_t chunkX, int32_t chunkZ) {
+    int32_t sx = chunkX & (VOXEL_MESH_CACHE_DIM - 1); // & funciona para negativos (complemento de 2)
+    int32_t sz = chunkZ & (VOXEL_MESH_CACHE_DIM - 1);
+    return &renderer->meshCache[sz * VOXEL_MESH_CACHE_DIM + sx];
+}
+
+// Reassa a luz atual nos vértices do mesh em cache e reenvia (mesmo tamanho: reusa o VBO)
+static void RelightChunkMesh(VoxelRenderer* renderer, VoxelChunkMesh* entry) {
+    VoxelMesh_Relight(&entry->mesh, renderer->faceLight);
+    entry->lightingVersion = renderer->lightingVersion;
+    if (renderer->meshShader.shaderId != 0) VoxelMesh_Upload(&entry->mesh);
+    renderer->stats.meshesRelit++;
+}
+
+// Gera o mesh aqui mesmo (sem workers ou sem job livre) com snapshot e scratch do renderer
+static void GenerateChunkMeshSync(VoxelRenderer* renderer, VoxelChunkMesh* entry, VoxelWorld* world,
+                                  int32_t chunkX, int32_t chunkZ, int32_t lod) {
+    VoxelMesh* mesh = &entry->mesh;
+    memset(&mesh->chunkStats, 0, sizeof(mesh->chunkStats));
+    mesh->vertexCount = 0;
+    mesh->opaqueVertexCount = 0;
+    mesh->occluderCount = 0;
+    if (!renderer->syncSnapshot) {
+        renderer->syncSnapshot = (VoxelMeshSnapshot*)calloc(1, sizeof(VoxelMeshSnapshot));
+    }
+    if (!renderer->syncScratch) {
+        renderer->syncScratch = (VoxelMeshScratch*)malloc(sizeof(VoxelMeshScratch));
+    }
+    if (!renderer->syncSnapshot || !renderer->syncScratch) return;
+    if (VoxelMeshSnapshot_Capture(renderer->syncSnapshot, world, chunkX, chunkZ, lod)) {
+        memcpy(renderer->syncSnapshot->faceLight, renderer->faceLight, sizeof(renderer->faceLight));
+        VoxelMesh_BuildFromSnapshot(mesh, renderer->syncSnapshot, renderer->syncScratch);
+    }
+}
+
+// Versão da borda `side` do vizinho pronto, 0 se ausente/gerando (a borda é meshada como ar)
+static uint32_t GetNeighborBorderVersion(VoxelWorld* world, int32_t chunkX, int32_t chunkZ, int32_t side) {
+    Chunk* chunk = VoxelWorld_FindChunk(world, chunkX, chunkZ);
+    if (!chunk || !Chunk_IsReady(chunk)) return 0;
+    return Chunk_GetBorderVersion(chunk, side);
+}
+
+// Garante o mesh do chunk atualizado (ou a caminho). NULL se o chunk não está pronto.
+static VoxelChunkMesh* UpdateChunkMesh(VoxelRenderer* renderer, VoxelWorld* world,
+                                       int32_t chunkX, int32_t chunkZ, int32_t lod) {
+    VoxelChunkMesh* entry = GetCacheSlot(renderer, chunkX, chunkZ);
+    bool sameChunk = entry->used && entry->chunkX == chunkX && entry->chunkZ == chunkZ;
+    
+    Chunk* chunk = VoxelWorld_FindChunk(world, chunkX, chunkZ);
+    if (!chunk || !Chunk_IsReady(chunk)) {
+        if (sameChunk) EvictChunkMesh(renderer, entry); // descarregado
+        return NULL;
+    }
+    // Lida uma vez, antes da cópia: o job registra a versão do conteúdo copiado
+    // (se o chunk mudar no meio, o mesh sai com versão antiga e é refeito)
+    uint32_t chunkVersion = Chunk_GetVersion(chunk);
+    
+    // Heightfield (lod > 0) fecha as bordas com saias: vizinhos não invalidam
+    uint32_t neighborVersions[VOXEL_MESH_NEIGHBOR_COUNT] = {0};
+    for (int32_t n = 0; lod == 0 && n < VOXEL_MESH_NEIGHBOR_COUNT; n++) {
+        neighborVersions[n] = GetNeighborBorderVersion(world, chunkX + g_neighborOffsets[n][0],
+                                                       chunkZ + g_neighborOffsets[n][1], g_neighborFacingSide[n]);
+    }
     
-    // Inicializa mesh se ainda não foi inicializado
-    if (!g_meshInitialized) {
-        VoxelMesh_Init(&g_chunkMesh);
-        g_meshInitialized = true;
+    if (sameChunk && entry->version == chunkVersion && entry->lod == lod &&
+        memcmp(entry->neighborVersions, neighborVersions, sizeof(neighborVersions)) == 0) {
+        if (entry->lightingVersion != renderer->lightingVersion) RelightChunkMesh(renderer, entry);
+        return entry; // Cache válido
+    }
+    if (sameChunk && entry->jobInFlight) {
+        return entry; // Desenha o antigo; a versão é conferida de novo quando o job voltar
+    }
+    
+    if (entry->used && !sameChunk) EvictChunkMesh(renderer, entry);
+    if (!entry->used) {
+        VoxelMesh_Init(&entry->mesh);
+        if (!entry->mesh.initialized) return NULL;
+        entry->used = true;
+        entry->chunkX = chunkX;
+        entry->chunkZ = chunkZ;
+        entry->version = 0;
+        renderer->stats.cachedMeshes++;
+    }
+    
+    if (renderer->meshJobs) {
+        if (renderer->jobsInFlight >= VOXEL_RENDERER_MAX_JOBS_IN_FLIGHT) {
+            return entry; // Fila cheia: tenta no próximo frame (o antigo, se houver, continua)
+        }
+        VoxelMeshJob* job = VoxelMeshJobs_AcquireJob(renderer->meshJobs);
+        if (job && VoxelMeshSnapshot_Capture(&job->snapshot, world, chunkX, chunkZ, lod)) {
+            job->chunkX = chunkX;
+            job->chunkZ = chunkZ;
+            job->serial = ++renderer->nextJobSerial;
+            job->version = chunkVersion;
+            memcpy(job->neighborVersions, neighborVersions, sizeof(neighborVersions));
+            memcpy(job->snapshot.faceLight, renderer->faceLight, sizeof(renderer->faceLight));
+            job->lightingVersion = renderer->lightingVersion;
+            entry->jobInFlight = true;
+            entry->jobSerial = job->serial;
+            VoxelMeshJobs_Submit(renderer->meshJobs, job);
+            renderer->jobsInFlight++;
+            renderer->stats.meshesRebuilt++;
+            return entry;
+        }
+        VoxelMeshJobs_RecycleJob(renderer->meshJobs, job); // sem memória: gera aqui mesmo
+    }
+    
+    entry->version = chunkVersion;
+    memcpy(entry->neighborVersions, neighborVersions, sizeof(neighborVersions));
+    entry->lod = (uint8_t)lod;
+    GenerateChunkMeshSync(renderer, entry, world, chunkX, chunkZ, lod);
+    entry->lightingVersion = renderer->lightingVersion;
+    if (renderer->meshShader.shaderId != 0) VoxelMesh_Upload(&entry->mesh);
+    renderer->stats.meshesRebuilt++;
+    return entry;
+}
+
+// Troca os meshes prontos pelos antigos e faz o upload, até o orçamento do frame
+static void PublishFinishedMeshes(VoxelRenderer* renderer) {
+    int32_t uploadedVertices = 0;
+    while (uploadedVertices < VOXEL_RENDERER_UPLOAD_BUDGET) {
+        VoxelMeshJob* job = VoxelMeshJobs_PollFinished(renderer->meshJobs);
+        if (!job) break;
+        renderer->jobsInFlight--;
+        
+        VoxelChunkMesh* entry = GetCacheSlot(renderer, job->chunkX, job->chunkZ);
+        bool current = entry->used && entry->jobInFlight && entry->jobSerial == job->serial &&
+                       entry->chunkX == job->chunkX && entry->chunkZ == job->chunkZ;
+        if (current && !job->built) {
+            entry->jobInFlight = false; // sem memória: mantém o antigo e tenta de novo no próximo frame
+            entry->version = 0;
+        } else if (current) {
+            VoxelMesh_SwapVertices(&entry->mesh, &job->mesh); // buffer antigo volta ao pool com o job
+            entry->version = job->version;
+            memcpy(entry->neighborVersions, job->neighborVersions, sizeof(job->neighborVersions));
+            entry->lightingVersion = job->lightingVersion;
+            entry->lod = job->snapshot.lod;
+            entry->jobInFlight = false;
+            if (entry->lightingVersion != renderer->lightingVersion) {
+                RelightChunkMesh(renderer, entry); // luz mudou com o job na fila (já faz o upload)
+            } else if (renderer->meshShader.shaderId != 0) {
+                VoxelMesh_Upload(&entry->mesh);
+            }
+            uploadedVertices += entry->mesh.vertexCount + 1; // + 1: mesh vazio também conta
+            renderer->stats.meshesPublished++;
+        }
+        VoxelMeshJobs_RecycleJob(renderer->meshJobs, job);
     }
 }
 
@@ -44,52 +342,315 @@ BlockColor VoxelRenderer_GetBlockColor(uint8_t blockType) {
     return g_blockColors[blockType];
 }
 
+void VoxelRenderer_SetLighting(VoxelRenderer* renderer, LightingSystem* lighting) {
+    if (!renderer || !lighting || lighting->version == renderer->lightingVersion) return;
+    renderer->lightingVersion = Lighting_GetFaceLight(lighting, renderer->faceLight);
+}
+
+void VoxelRenderer_SetLodRadii(VoxelRenderer* renderer, const int32_t radii[VOXEL_MESH_LOD_COUNT]) {
+    if (!renderer || !radii) return;
+    int32_t previous = 0;
+    for (int32_t i = 0; i < VOXEL_MESH_LOD_COUNT; i++) {
+        int32_t radius = radii[i];
+        if (radius < previous) radius = previous;
+        if (radius > (VOXEL_MESH_CACHE_DIM - 1) / 2) radius = (VOXEL_MESH_CACHE_DIM - 1) / 2;
+        renderer->lodRadius[i] = radius;
+        previous = radius;
+    }
+    renderer->renderDistance = renderer->lodRadius[VOXEL_MESH_LOD_COUNT - 1];
+}
+
+void VoxelRenderer_SetFrustum(VoxelRenderer* renderer, const Frustum* frustum) {
+    if (!renderer) return;
+    renderer->frustumEnabled = (frustum != NULL);
+    if (frustum) renderer->frustum = *frustum;
+}
+
+// Colunas (chunk inteiro em X/Z, faixa Y ocupada) num lote só; as que cruzam uma borda
+// têm as seções ocupadas testadas num segundo lote e só ficam se alguma seção passar
+static void FrustumCullColumns(VoxelRenderer* renderer, int32_t columnCount) {
+    VoxelCullScratch* cull = renderer->cull;
+    Frustum_CullAABBBatch(&renderer->frustum, &cull->columns, cull->columnVisible, cull->columnInside);
+    
+    // Colunas na borda com mais de uma seção: a visibilidade passa a ser a das seções
+    FrustumAABBBatch_Clear(&cull->sections);
+    for (int32_t i = 0; i < columnCount; i++) {
+        if (!Frustum_MaskTest(cull->columnVisible, i) || Frustum_MaskTest(cull->columnInside, i)) continue;
+        const VoxelMesh* mesh = &cull->columnEntries[i]->mesh;
+        uint32_t sections = mesh->sectionMask;
+        if ((sections & (sections - 1u)) == 0) continue; // Uma seção: a caixa da coluna já é ela
+        
+        cull->columnVisible[i >> 5] &= ~(1u << (i & 31));
+        for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+            if (!(sections & (1u << s))) continue;
+            Vec3 min = Vec3_Make((float)mesh->originX, (float)(s * CHUNK_SECTION_HEIGHT), (float)mesh->originZ);
+            Vec3 max = Vec3_Make((float)(mesh->originX + CHUNK_SIZE_X), (float)((s + 1) * CHUNK_SECTION_HEIGHT),
+                                 (float)(mesh->originZ + CHUNK_SIZE_Z));
+            cull->sectionColumns[FrustumAABBBatch_Push(&cull->sections, min, max)] = i;
+        }
+    }
+    if (cull->sections.count > 0) {
+        Frustum_CullAABBBatch(&renderer->frustum, &cull->sections, cull->sectionVisible, NULL);
+        for (int32_t k = 0; k < cull->sections.count; k++) {
+            if (!Frustum_MaskTest(cull->sectionVisible, k)) continue;
+            int32_t column = cull->sectionColumns[k];
+            cull->columnVisible[column >> 5] |= 1u << (column & 31);
+        }
+    }
+    renderer->stats.sectionsTested = cull->sections.count;
+    
+    for (int32_t i = 0; i < columnCount; i++) {
+        if (Frustum_MaskTest(cull->columnVisible, i)) cull->columnEntries[i]->drawn = true;
+        else renderer->stats.chunksCulled++;
+    }
+}
+
+// Mais perto primeiro
+static int CompareOccluderChunks(const void* a, const void* b) {
+    float da = ((const VoxelOccluderChunk*)a)->distance;
+    float db = ((const VoxelOccluderChunk*)b)->distance;
+    return (da > db) - (da < db);
+}
+
+// Oclusão em CPU: rasteriza as faces grandes dos chunks de voxel completo que passaram
+// no frustum (perto primeiro, até VOXEL_RENDERER_MAX_OCCLUDER_QUADS) e esconde as colunas
+// cuja caixa (ou todas as seções ocupadas) fica atrás delas
+static void OcclusionCullColumns(VoxelRenderer* renderer, int32_t columnCount) {
+    VoxelCullScratch* cull = renderer->cull;
+    OcclusionCuller* occlusion = &renderer->occlusion;
+    OcclusionCuller_Begin(occlusion, &renderer->occlusionView);
+    
+    int32_t occluderChunks = 0;
+    Vec3 eye = renderer->occlusionView.position;
+    for (int32_t i = 0; i < columnCount; i++) {
+        VoxelChunkMesh* entry = cull->columnEntries[i];
+        if (!entry->drawn || entry->mesh.occluderCount == 0) continue;
+        float dx = (float)entry->mesh.originX + CHUNK_SIZE_X * 0.5f - eye.x;
+        float dz = (float)entry->mesh.originZ + CHUNK_SIZE_Z * 0.5f - eye.z;
+        cull->occluderChunks[occluderChunks].distance = dx * dx + dz * dz;
+        cull->occluderChunks[occluderChunks].entry = entry;
+        occluderChunks++;
+    }
+    qsort(cull->occluderChunks, (size_t)occluderChunks, sizeof(VoxelOccluderChunk), CompareOccluderChunks);
+    
+    for (int32_t c = 0; c < occluderChunks && occlusion->occluderQuads < VOXEL_RENDERER_MAX_OCCLUDER_QUADS; c++) {
+        const VoxelMesh* mesh = &cull->occluderChunks[c].entry->mesh;
+        for (int32_t q = 0; q < mesh->occluderCount; q++) {
+            const VoxelOccluderQuad* quad = &mesh->occluders[q];
+            float x0 = (float)(mesh->originX + quad->minX), x1 = (float)(mesh->originX + quad->maxX);
+            float z0 = (float)(mesh->originZ + quad->minZ), z1 = (float)(mesh->originZ + quad->maxZ);
+            float y0 = (float)quad->minY, y1 = (float)quad->maxY;
+            Vec3 corners[4];
+            if (quad->minX == quad->maxX) {          // Plano X
+                corners[0] = Vec3_Make(x0, y0, z0); corners[1] = Vec3_Make(x0, y1, z0);
+                corners[2] = Vec3_Make(x0, y1, z1); corners[3] = Vec3_Make(x0, y0, z1);
+            } else if (quad->minY == quad->maxY) {   // Plano Y
+                corners[0] = Vec3_Make(x0, y0, z0); corners[1] = Vec3_Make(x1, y0, z0);
+                corners[2] = Vec3_Make(x1, y0, z1); corners[3] = Vec3_Make(x0, y0, z1);
+            } else {                                 // Plano Z
+                corners[0] = Vec3_Make(x0, y0, z0); corners[1] = Vec3_Make(x1, y0, z0);
+                corners[2] = Vec3_Make(x1, y1, z0); corners[3] = Vec3_Make(x0, y1, z0);
+            }
+            OcclusionCuller_AddQuad(occlusion, corners);
+        }
+    }
+    OcclusionCuller_BuildPyramid(occlusion);
+    renderer->stats.occluderQuads = occlusion->occluderQuads;
+    
+    for (int32_t i = 0; i < columnCount; i++) {
+        VoxelChunkMesh* entry = cull->columnEntries[i];
+        if (!entry->drawn) continue;
+        const VoxelMesh* mesh = &entry->mesh;
+        float x0 = (float)mesh->originX, x1 = (float)(mesh->originX + CHUNK_SIZE_X);
+        float z0 = (float)mesh->originZ, z1 = (float)(mesh->originZ + CHUNK_SIZE_Z);
+        bool visible = OcclusionCuller_IsAABBVisible(occlusion, Vec3_Make(x0, (float)mesh->minY, z0),
+                                                     Vec3_Make(x1, (float)mesh->maxY, z1));
+        uint32_t sections = mesh->sectionMask;
+        if (visible && (sections & (sections - 1u)) != 0) {
+            visible = false;
+            for (int32_t s = 0; s < CHUNK_SECTION_COUNT && !visible; s++) {
+                if (!(sections & (1u << s))) continue;
+                visible = OcclusionCuller_IsAABBVisible(occlusion, Vec3_Make(x0, (float)(s * CHUNK_SECTION_HEIGHT), z0),
+                                                        Vec3_Make(x1, (float)((s + 1) * CHUNK_SECTION_HEIGHT), z1));
+            }
+        }
+        if (!visible) {
+            entry->drawn = false;
+            renderer->stats.chunksOccluded++;
+        }
+    }
+}
+
+// Marca entry->drawn nos meshes não vazios que passam no frustum e na oclusão.
+// Retorna quantas colunas entraram no lote (cull->columnEntries).
+static int32_t CullChunkMeshes(VoxelRenderer* renderer) {
+    VoxelCullScratch* cull = renderer->cull;
+    FrustumAABBBatch_Clear(&cull->columns);
+    for (int32_t i = 0; i < VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM; i++) {
+        VoxelChunkMesh* entry = &renderer->meshCache[i];
+        entry->drawn = false;
+        if (!entry->used || entry->mesh.vertexCount == 0) continue;
+        const VoxelMesh* mesh = &entry->mesh;
+        Vec3 min = Vec3_Make((float)mesh->originX, (float)mesh->minY, (float)mesh->originZ);
+        Vec3 max = Vec3_Make((float)(mesh->originX + CHUNK_SIZE_X), (float)mesh->maxY, (float)(mesh->originZ + CHUNK_SIZE_Z));
+        cull->columnEntries[FrustumAABBBatch_Push(&cull->columns, min, max)] = entry;
+    }
+    int32_t columnCount = cull->columns.count;
+    renderer->stats.chunksTested = columnCount;
+    
+    if (renderer->frustumEnabled) {
+        FrustumCullColumns(renderer, columnCount);
+    } else {
+        for (int32_t i = 0; i < columnCount; i++) cull->columnEntries[i]->drawn = true;
+    }
+    if (renderer->occlusionEnabled) OcclusionCullColumns(renderer, columnCount);
+    return columnCount;
+}
+
 void VoxelRenderer_SetRenderDistance(VoxelRenderer* renderer, int32_t distance) {
-    if (renderer) {
-        renderer->renderDistance = distance;
+    if (!renderer) return;
+    int32_t radii[VOXEL_MESH_LOD_COUNT];
+    for (int32_t i = 0; i < VOXEL_MESH_LOD_COUNT; i++) {
+        radii[i] = (renderer->lodRadius[i] < distance) ? renderer->lodRadius[i] : distance;
+    }
+    radii[VOXEL_MESH_LOD_COUNT - 1] = distance;
+    VoxelRenderer_SetLodRadii(renderer, radii);
+}
+
+void VoxelRenderer_SetOcclusionView(VoxelRenderer* renderer, const OcclusionView* view) {
+    if (!renderer) return;
+    renderer->occlusionEnabled = (view != NULL && renderer->occlusion.levels[0] != NULL);
+    if (view) renderer->occlusionView = *view;
+}
+
+// Mais longe primeiro
+static int CompareTranslucentDraws(const void* a, const void* b) {
+    float da = ((const VoxelTranslucentDraw*)a)->distance;
+    float db = ((const VoxelTranslucentDraw*)b)->distance;
+    return (da < db) - (da > db);
+}
+
+// Passe translúcido: reordena os quads de cada chunk (só se a câmera andou o bastante),
+// ordena os chunks de trás para frente e desenha com a profundidade só para teste
+static void RenderTranslucentPass(VoxelRenderer* renderer, int32_t drawCount, bool gpu, Camera3D* camera) {
+    VoxelTranslucentDraw* draws = renderer->translucentDraws;
+    for (int32_t i = 0; i < drawCount; i++) {
+        VoxelChunkMesh* entry = draws[i].entry;
+        if (VoxelMesh_SortTranslucent(&entry->mesh, camera->position)) renderer->stats.translucentSorts++;
+        float dx = (float)entry->mesh.originX + CHUNK_SIZE_X * 0.5f - camera->position.x;
+        float dz = (float)entry->mesh.originZ + CHUNK_SIZE_Z * 0.5f - camera->position.z;
+        draws[i].distance = dx * dx + dz * dz;
+    }
+    qsort(draws, (size_t)drawCount, sizeof(VoxelTranslucentDraw), CompareTranslucentDraws);
+    
+#if defined(USE_RLGL)
+    rlDrawRenderBatchActive(); // o que já está no batch escreve profundidade normalmente
+    rlDisableDepthMask();
+#endif
+    for (int32_t i = 0; i < drawCount; i++) {
+        VoxelMesh_RenderTranslucent(&draws[i].entry->mesh, gpu ? &renderer->meshShader : NULL, camera);
+    }
+#if defined(USE_RLGL)
+    rlDrawRenderBatchActive(); // fallback DrawTriangle3D: descarrega antes de religar a escrita
+    rlEnableDepthMask();
+#endif
+    renderer->stats.translucentChunksDrawn = drawCount;
+}
+
+// Nível de detalhe do chunk a (dx, dz) chunks do player; -1 fora da distância de renderização
+static int32_t SelectChunkLod(const VoxelRenderer* renderer, int32_t dx, int32_t dz) {
+    int32_t dist2 = dx * dx + dz * dz;
+    for (int32_t lod = 0; lod < VOXEL_MESH_LOD_COUNT; lod++) {
+        if (dist2 <= renderer->lodRadius[lod] * renderer->lodRadius[lod]) return lod;
     }
+    return -1;
 }
 
 void VoxelRenderer_Render(VoxelRenderer* renderer, VoxelWorld* world, 
                          float playerX, float playerY, float playerZ,
                          Camera3D* camera) {
     if (!renderer || !renderer->initialized || !world || !camera) return;
-    
-    // Inicializa mesh se necessário
-    if (!g_meshInitialized) {
-        VoxelMesh_Init(&g_chunkMesh);
-        g_meshInitialized = true;
-    }
-    
-    // Atualiza streaming de chunks (raio para 30m)
-    const float MAX_RENDER_DISTANCE = 30.0f;
-    int32_t chunkRadius = (int32_t)ceilf(MAX_RENDER_DISTANCE / (float)CHUNK_SIZE_X) + 1; // Chunks necessários para 30m
-    VoxelWorld_UpdateStreaming(world, playerX, playerY, playerZ, chunkRadius);
+    (void)playerY;
     
     // Calcula chunks visíveis (corrigido para coordenadas negativas)
     // Usa a mesma lógica do Chunk_GlobalToLocal para garantir consistência
     int32_t playerChunkX = (playerX < 0) ? ((int32_t)playerX + 1) / CHUNK_SIZE_X - 1 : (int32_t)playerX / CHUNK_SIZE_X;
     int32_t playerChunkZ = (playerZ < 0) ? ((int32_t)playerZ + 1) / CHUNK_SIZE_Z - 1 : (int32_t)playerZ / CHUNK_SIZE_Z;
     
-    // Limpa mesh antes de gerar novos chunks
-    VoxelMesh_Clear(&g_chunkMesh);
-    
-    // Gera mesh para chunks em raio (renderiza todos os chunks carregados)
-    // Aumenta o raio para garantir que o mapa seja renderizado
-    int32_t renderRadius = chunkRadius + 2; // Adiciona margem extra
-    
-    for (int32_t dz = -renderRadius; dz <= renderRadius; dz++) {
-        for (int32_t dx = -renderRadius; dx <= renderRadius; dx++) {
-            int32_t chunkX = playerChunkX + dx;
-            int32_t chunkZ = playerChunkZ + dz;
-            
-            // Gera mesh do chunk (sem verificação de distância - renderiza todos)
-            VoxelMesh_GenerateChunk(&g_chunkMesh, world, 
-                                   chunkX, chunkZ,
-                                   playerX, playerY, playerZ);
+    renderer->stats.meshesRebuilt = 0;
+    renderer->stats.meshesPublished = 0;
+    renderer->stats.meshesEvicted = 0;
+    renderer->stats.meshesRelit = 0;
+    renderer->stats.chunksTested = 0;
+    renderer->stats.chunksCulled = 0;
+    renderer->stats.sectionsTested = 0;
+    renderer->stats.chunksOccluded = 0;
+    renderer->stats.occluderQuads = 0;
+    renderer->stats.chunksDrawn = 0;
+    renderer->stats.verticesDrawn = 0;
+    memset(renderer->stats.lodChunksDrawn, 0, sizeof(renderer->stats.lodChunksDrawn));
+    renderer->stats.translucentChunksDrawn = 0;
+    renderer->stats.translucentSorts = 0;
+    
+    // Descarta meshes que saíram da distância de renderização
+    for (int32_t i = 0; i < VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM; i++) {
+        VoxelChunkMesh* entry = &renderer->meshCache[i];
+        if (!entry->used) continue;
+        if (SelectChunkLod(renderer, entry->chunkX - playerChunkX, entry->chunkZ - playerChunkZ) < 0) {
+            EvictChunkMesh(renderer, entry);
+        }
+    }
+    
+    // Publica os prontos e atualiza os meshes antes de ativar o shader (o upload mexe no VAO ativo).
+    // Um nível por vez, de dentro para fora: com a fila de jobs cheia, perto vem primeiro.
+    PublishFinishedMeshes(renderer);
+    for (int32_t lod = 0; lod < VOXEL_MESH_LOD_COUNT; lod++) {
+        int32_t radius = renderer->lodRadius[lod];
+        for (int32_t dz = -radius; dz <= radius; dz++) {
+            for (int32_t dx = -radius; dx <= radius; dx++) {
+                if (SelectChunkLod(renderer, dx, dz) != lod) continue;
+                UpdateChunkMesh(renderer, world, playerChunkX + dx, playerChunkZ + dz, lod);
+            }
         }
     }
     
-    // Renderiza o mesh completo
-    VoxelMesh_Render(&g_chunkMesh, camera);
+    int32_t columnCount = CullChunkMeshes(renderer);
+    
+    bool gpu = VoxelMesh_BeginShader(&renderer->meshShader);
+    int32_t translucentCount = 0;
+    for (int32_t i = 0; i < columnCount; i++) {
+        VoxelChunkMesh* entry = renderer->cull->columnEntries[i];
+        if (!entry->drawn) continue;
+        
+        VoxelMesh_Render(&entry->mesh, gpu ? &renderer->meshShader : NULL, camera);
+        if (entry->mesh.vertexCount > entry->mesh.opaqueVertexCount) {
+            renderer->translucentDraws[translucentCount++].entry = entry;
+        }
+        renderer->stats.chunksDrawn++;
+        renderer->stats.lodChunksDrawn[entry->lod]++;
+        renderer->stats.verticesDrawn += entry->mesh.vertexCount;
+    }
+    if (translucentCount > 0) RenderTranslucentPass(renderer, translucentCount, gpu, camera);
+    if (gpu) VoxelMesh_EndShader(&renderer->meshShader);
+    renderer->stats.jobsPending = VoxelMeshJobs_GetPendingCount(renderer->meshJobs);
+}
+
+void VoxelRenderer_RenderWireframe(VoxelRenderer* renderer, Camera3D* camera, Color color) {
+    if (!renderer || !renderer->initialized || !camera) return;
+    
+    bool gpu = VoxelMesh_BeginShader(&renderer->meshShader);
+    if (gpu) VoxelMesh_SetShaderTint(&renderer->meshShader, color, VOXEL_RENDERER_WIRE_OFFSET);
+#if defined(USE_RLGL)
+    rlEnableWireMode();
+#endif
+    for (int32_t i = 0; i < VOXEL_MESH_CACHE_DIM * VOXEL_MESH_CACHE_DIM; i++) {
+        VoxelChunkMesh* entry = &renderer->meshCache[i];
+        if (!entry->used || !entry->drawn) continue;
+        VoxelMesh_RenderAll(&entry->mesh, gpu ? &renderer->meshShader : NULL, camera);
+    }
+#if defined(USE_RLGL)
+    rlDrawRenderBatchActive(); // fallback DrawTriangle3D: descarrega ainda em modo de linhas
+    rlDisableWireMode();
+#endif
+    if (gpu) VoxelMesh_EndShader(&renderer->meshShader);
 }
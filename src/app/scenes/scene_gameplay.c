@@ -6,11 +6,19 @@
 #include "core/net/net.h"
 #include "core/net/protocol.h"
 #include "core/core.h"
+#include "core/sim_thread.h"
+#include "core/thread.h"
+#include "core/time.h"
+#include "core/triple_buffer.h"
 #include "app/input/input.h"
 #include "app/camera/fps_camera.h"
 #include "core/physics/physics.h"  /* PLAYER_HEIGHT, PLAYER_EYE_HEIGHT */
 #include "app/render/atmosphere.h"
 #include "app/render/lighting.h"
+#include "app/render/voxel_renderer.h"
+#include "app/render/render_queue.h"
+#include "app/render/render_material.h"
+#include "app/render/dynamic_resolution.h"
 #include "core/world/world_beware.h"
 #include "core/world/voxel_world.h"
 #include "core/world/world_config.h"
@@ -120,11 +128,23 @@ static bool g_noClip = false; // Modo "No clipping" (movimento livre)
 static bool g_isColliding = false; // Flag para detectar colisão (chão ou parede)
 static Atmosphere g_atmosphere; // Sistema de atmosfera (fog + sky)
 static LightingSystem g_lighting; // Sistema de iluminação direcional fake
-static Shader g_fogShader = {0}; // Fog no forward (view-space)
-static int g_fogLocStart = -1, g_fogLocEnd = -1, g_fogLocColor = -1, g_fogLocType = -1, g_fogLocDensity = -1;
-static int g_fogLocHorizon = -1, g_fogLocSky = -1, g_fogLocH0 = -1, g_fogLocHRange = -1;
-static Shader g_skyShader = {0}; // Sky gradient por raio (sem depth)
-static int g_skyLocBottom = -1, g_skyLocHorizon = -1, g_skyLocTop = -1;
+static uint8_t g_faceLight[LIGHTING_FACE_COUNT]; // Luz por face assada de g_lighting
+static uint32_t g_faceLightVersion = 0;          // g_lighting.version em g_faceLight (0 = nunca)
+/* Campos do bloco de fog: uniforms de fog_forward.fs (mesmo fs no fog_forward.vs e no voxel_packed.vs) */
+typedef struct FogBlockFields {
+    int32_t start, end, color, type, density;
+    int32_t horizon, sky, h0, hRange;
+} FogBlockFields;
+static UniformBlock g_fogBlock;        // Fog de g_atmosphere: compartilhado por fog e voxel
+static FogBlockFields g_fogFields;
+static UniformBlock g_cameraBlock;     // Câmera do frame (invViewProj)
+static int32_t g_cameraInvViewProj = -1;
+static RenderMaterial g_fogMaterial;   // Fog no forward (view-space)
+static VoxelRenderer g_voxelRenderer;  // Chunks em mesh cacheado (mundo streaming)
+static RenderMaterial g_voxelMaterial; // Shader do g_voxelRenderer (não é dono)
+static RenderQueue g_renderQueue;      // Draws do passe 3D ordenados por chave
+static RenderMaterial g_skyMaterial;   // Sky gradient por raio (triângulo de tela cheia, sem depth)
+static int32_t g_skyBottom = -1, g_skyHorizon = -1, g_skyTop = -1;
 
 /* Nave 3D: modelo GLB (carregado para uso futuro; placeholder usa Ship_Draw). */
 static Model g_shipModel = {0};
@@ -133,6 +153,11 @@ static bool g_shipModelLoaded = false;
 /* CRT overlay: renderiza gameplay num RT e desenha por cima com shader (capinha sem afetar nada). */
 static RenderTexture2D g_crtTarget = {0};
 static Shader g_crtShader = {0};
+/* Cena 3D em resolução dinâmica: RT do tamanho nativo, desenhado só no canto do viewport
+   escalado (trocar a escala não realoca); ampliado no g_crtTarget antes do HUD nativo. */
+#define DYNRES_TARGET_FRAME_TIME (1.0f / 60.0f)   /* SetTargetFPS(60) em app.c */
+static RenderTexture2D g_sceneTarget = {0};
+static DynamicResolution g_dynRes;
 /* CRT do overlay do terminal ARC (crt.fs do terminal-with-raylib). */
 static Shader g_terminalCrtShader = {0};
 static int g_terminalCrtTimeLoc = -1;
@@ -151,6 +176,54 @@ static ArcTerminalFull* g_arcTerminalFull = NULL;
 static bool g_nearArcMonitor = false;
 #define MONITOR_INTERACT_DIST 2.5f
 
+/* Simulação em thread própria (SimThread, passo fixo): nave, física do jogador, streaming do
+ * mundo e rede. A thread principal fica com janela, input, UI e GL: amostra o input do frame
+ * (GameplayInput) e desenha o estado interpolado entre os dois últimos snapshots publicados
+ * (GameplaySnapshot, buffer triplo). Com a thread rodando, g_playerPhysics, g_ship,
+ * g_worldBeware, g_noClip, g_isColliding, g_standingOnShip, g_isOnLadder e g_walkBobPhase
+ * são só dela; a thread principal lê snapshots. */
+#define SIM_STEP_SECONDS (1.0f / 60.0f)
+#define SIM_SNAP_DISTANCE 4.0f   /* Salto maior num passo (drop F5, spawn): vai direto, sem interpolar */
+
+enum {
+    SIM_EVENT_JUMP          = 1 << 0,
+    SIM_EVENT_TOGGLE_NOCLIP = 1 << 1,   /* N */
+    SIM_EVENT_SHIP_DROP     = 1 << 2,   /* F5 */
+    SIM_EVENT_SHIP_MOVE     = 1 << 3,   /* F6 */
+};
+
+typedef struct GameplayInput {
+    float forward, right;   /* Teclas de movimento seguradas no último frame (-1..1) */
+    float fly;              /* Noclip: sobe (espaço/Q) e desce (ctrl/E) */
+    float yaw;              /* Mouse look fica no frame: a simulação só usa a direção */
+    bool moving;            /* Alguma tecla de movimento segurada (head bob) */
+    bool sprint;
+    bool active;            /* Mouse travado: jogador controla o corpo */
+    bool simulate;          /* false: pausa ou terminal aberto congelam a simulação */
+    uint32_t events;        /* SIM_EVENT_*: bordas acumuladas até um passo consumir */
+} GameplayInput;
+
+typedef struct GameplaySnapshot {
+    double tickTime;        /* Hora (Time_GetSeconds) que o estado representa */
+    uint64_t tick;
+    PhysicsBody player;
+    Ship ship;
+    Vector3 bobOffset;      /* Câmera: olhos do player + head bob */
+    uint32_t worldVersion;
+    int32_t loadedChunks;
+    int32_t streamMinZ, streamMaxZ;
+    bool noClip, isColliding, standingOnShip;
+} GameplaySnapshot;
+
+static SimThread* g_simThread = NULL;       /* NULL: simula no Update (thread não criada) */
+static TripleBuffer g_snapshots;            /* Simulação escreve, Draw lê */
+static SpinLock g_simInputLock;
+static GameplayInput g_simInput;            /* Update escreve, cada passo consome */
+static uint64_t g_simTick = 0;              /* Só a simulação */
+static Vector3 g_simBobOffset;              /* Só a simulação */
+static GameplaySnapshot g_snapPrev, g_snapCurr;  /* Dois últimos publicados (thread principal) */
+static GameplaySnapshot g_view;             /* Interpolado para o frame (Draw/HUD) */
+
 /* Colisão: 3 passes (Y, X, Z) para evitar blocos “puxando” o player.
  * Gravidade só no eixo Y. Colidimos com todo bloco sólido (exceto ar). */
 // Verifica se há um bloco sólido na posição do mapa (ou do VoxelWorld quando streaming ativo)
@@ -201,8 +274,10 @@ static bool GetBlockFaceVertices(float bx, float by, float bz, int faceDir, Vect
 static void DrawBlockFace_Solid(float bx, float by, float bz, int faceDir, Color baseColor, int* pFacesInBatch) {
     Vector3 v[4];
     if (!GetBlockFaceVertices(bx, by, bz, faceDir, v)) return;
-    Vector3 n = GetFaceNormal(faceDir);
-    Color lit = Lighting_ApplyDirectionalLight(&g_lighting, n, baseColor);
+    // Luz da face pela tabela (refeita só quando g_lighting muda), não por face desenhada
+    unsigned int light = g_faceLight[faceDir];
+    Color lit = {(unsigned char)((baseColor.r * light + 127) / 255), (unsigned char)((baseColor.g * light + 127) / 255),
+                 (unsigned char)((baseColor.b * light + 127) / 255), baseColor.a};
     DrawTriangle3D(v[0], v[1], v[2], lit);
     DrawTriangle3D(v[0], v[2], v[3], lit);
     if (pFacesInBatch) {
@@ -510,6 +585,282 @@ static void ResolveCollisionsY(void) {
     if (g_playerPhysics.onGround) g_isColliding = true;
 }
 
+/* ——— Simulação (SimThread, ou o Update quando não há thread). Só input amostrado: nada de
+ * input/janela do raylib aqui. ——— */
+static void Gameplay_Simulate(const GameplayInput* in, float dt) {
+    FPSCamera view = {0};   /* Só a direção do frame, para os vetores no plano XZ */
+    view.yaw = in->yaw;
+
+    if (in->events & SIM_EVENT_TOGGLE_NOCLIP) {
+        g_noClip = !g_noClip;
+    }
+
+    /* Nave atualiza primeiro (clamp ao chão está dentro de Ship_Update). */
+    if (g_useStreamingWorld && g_voxelWorld) {
+        Ship_Update(&g_ship, dt);
+        Ship_UpdateCollision(&g_ship);
+        /* Delta aplicado aqui (antes do movimento) usando standingOnShip do passo anterior.
+         * Herdar deltaY evita kick/jitter quando a nave desce (player acompanha em Y).
+         * Quando speed > 0: se o player estiver na borda, o delta pode tirá-lo da projeção XZ,
+         * standing vira false e ele cai — comportamento correto de plataforma móvel, não bug. */
+        if (g_standingOnShip) {
+            g_playerPhysics.x += g_ship.deltaX;
+            g_playerPhysics.y += g_ship.deltaY;
+            g_playerPhysics.z += g_ship.deltaZ;
+            if (g_ship.deltaY != 0.0f) g_playerPhysics.vy = 0.0f;
+        }
+    }
+
+    /* F5: inicia Drop Sequence (descida curva); player livre antes/durante/depois. */
+    if (g_useStreamingWorld && g_voxelWorld && (in->events & SIM_EVENT_SHIP_DROP) && g_ship.state == SHIP_IDLE_HOVER) {
+        g_ship.state = SHIP_DESCENDING;
+        g_ship.descendTimer = 0.0f;
+        /* Destino: pairar perto do chão no centro do corredor (landZ fixo = 0). */
+        float groundY = 0.0f;
+        float finalY = groundY + g_ship.targetHeight;
+        float landX = 0.0f;
+        float landZ = 0.0f;
+        g_ship.descendEndPos = (Vector3){ landX, finalY, landZ };
+        /* Início do arco: alto e atrás (-30 em Z); nave já está aqui ao iniciar gameplay. */
+        g_ship.descendStartPos = (Vector3){ landX, g_ship.startHeight, landZ - 30.0f };
+        g_ship.position = g_ship.descendStartPos;
+    }
+    /* F6: inicia movimento da nave em direção ao norte (+Z); só quando já pousou. */
+    if (g_useStreamingWorld && g_voxelWorld && (in->events & SIM_EVENT_SHIP_MOVE) && g_ship.state == SHIP_HOVER_READY) {
+        g_ship.speed = 1.5f;
+        g_ship.moveDirX = 0.0f;
+        g_ship.moveDirZ = 1.0f;
+    }
+    if (in->active) {
+        float moveSpeed = 5.0f * (in->sprint ? 1.6f : 1.0f);
+        float forward = in->forward, right = in->right;
+
+        // Normaliza movimento diagonal
+        if (forward != 0.0f || right != 0.0f) {
+            float len = sqrtf(forward * forward + right * right);
+            if (len > 0.0001f) { forward /= len; right /= len; }
+        }
+
+        // Obtém vetores forward e right da câmera no plano XZ
+        float forwardX, forwardZ, rightX, rightZ;
+        FPSCamera_GetForwardFlat(&view, &forwardX, &forwardZ);
+        FPSCamera_GetRightFlat(&view, &rightX, &rightZ);
+        float moveX = (forwardX * forward + rightX * right) * moveSpeed * dt;
+        float moveZ = (forwardZ * forward + rightZ * right) * moveSpeed * dt;
+
+        if (g_noClip) {
+            g_playerPhysics.x += moveX;
+            g_playerPhysics.z += moveZ;
+            g_playerPhysics.y += in->fly * moveSpeed * dt;
+
+            // NO CLIPPING: Não aplica colisão
+        } else {
+            if (g_isOnLadder) { moveX = 0.0f; moveZ = 0.0f; } /* escada: só sobe, centraliza no X depois. */
+            // Movimento e colisão por eixo (X → Z → Y) para não escalar parede nem grudar no chão
+            g_playerPhysics.x += moveX;
+            ResolveCollisionsX();
+            g_playerPhysics.z += moveZ;
+            ResolveCollisionsZ();
+
+            // Verifica ground ANTES do pulo: checa se há bloco sólido abaixo dos pés
+            // Esta verificação é feita ANTES do movimento Y para garantir que o pulo funcione
+            bool isOnGround = false;
+
+            // Primeiro, verifica se estava no chão no passo anterior (da colisão)
+            // Isso ajuda a detectar ground mesmo quando o player está parado
+            if (g_playerPhysics.onGround && g_playerPhysics.vy <= 0.1f) {
+                isOnGround = true;
+            }
+
+            // Verifica múltiplos pontos abaixo dos pés para melhor detecção
+            int32_t feetX = (int32_t)floorf(g_playerPhysics.x);
+            int32_t feetY = (int32_t)floorf(g_playerPhysics.y) - 1; // Um bloco abaixo dos pés
+            int32_t feetZ = (int32_t)floorf(g_playerPhysics.z);
+
+            // Verifica se há bloco sólido abaixo e se o player está próximo o suficiente
+            if (IsBlockSolid(feetX, feetY, feetZ)) {
+                float blockTop = (float)feetY + 1.0f;
+                // Player está no chão se:
+                // 1. Está dentro de uma tolerância do topo do bloco
+                // 2. E não está caindo muito rápido (velocidade Y pequena ou zero)
+                if (g_playerPhysics.y >= blockTop - 0.15f && g_playerPhysics.y <= blockTop + 0.25f) {
+                    if (g_playerPhysics.vy <= 0.1f) { // Não está caindo ou caindo muito devagar
+                        isOnGround = true;
+                    }
+                }
+            }
+
+            if ((in->events & SIM_EVENT_JUMP) && isOnGround) {
+                g_playerPhysics.vy = JUMP_FORCE;
+                isOnGround = false; // Não está mais no chão após pular
+                g_playerPhysics.onGround = false; // Reseta flag também
+            }
+
+            /* Escada: sobe automaticamente, gravidade desativada, centraliza no X. */
+            if (g_isOnLadder) {
+                g_playerPhysics.vx = 0.0f;
+                g_playerPhysics.vz = 0.0f;
+                g_playerPhysics.vy = 2.0f; /* velocidade de subida */
+                float ladderCenterX = (g_ship.ladderBox.min.x + g_ship.ladderBox.max.x) * 0.5f;
+                g_playerPhysics.x = LerpFloat(g_playerPhysics.x, ladderCenterX, 6.0f * dt);
+            } else {
+                /* Gravidade quando não está no chão. */
+                if (!isOnGround) {
+                    g_playerPhysics.vy += GRAVITY * dt;
+                    if (g_playerPhysics.vy < MAX_FALL_SPEED) {
+                        g_playerPhysics.vy = MAX_FALL_SPEED;
+                    }
+                } else {
+                    g_playerPhysics.vy = 0.0f;
+                }
+            }
+
+            // Atualiza posição Y com velocidade e resolve colisão só no eixo Y
+            g_playerPhysics.y += g_playerPhysics.vy * dt;
+            ResolveCollisionsY();
+
+            // Após colisão, se estiver no chão, garante que velocidade Y seja zero
+            if (g_playerPhysics.onGround) {
+                g_playerPhysics.vy = 0.0f;
+            }
+        }
+    }
+
+    if (g_useStreamingWorld && g_voxelWorld) {
+        WorldBeware_Update(&g_worldBeware, g_ship.position.x, g_ship.position.z, 0.0f, g_playerPhysics.x, g_playerPhysics.z);
+        /* Zona segura (deck): jogador dentro = isSafe (oxigênio, etc.). */
+        {
+            Vector3 pMin = {
+                g_playerPhysics.x - g_playerPhysics.width * 0.5f,
+                g_playerPhysics.y,
+                g_playerPhysics.z - g_playerPhysics.depth * 0.5f
+            };
+            Vector3 pMax = {
+                g_playerPhysics.x + g_playerPhysics.width * 0.5f,
+                g_playerPhysics.y + g_playerPhysics.height,
+                g_playerPhysics.z + g_playerPhysics.depth * 0.5f
+            };
+            BoundingBox playerBox = (BoundingBox){ pMin, pMax };
+            g_playerPhysics.isSafe = CheckCollisionBoxes(playerBox, g_ship.deckBox);
+        }
+    } else {
+        g_playerPhysics.isSafe = false;
+    }
+
+    /* Head bob só enquanto segura teclas de movimento; desliga ao parar. Desativado durante pouso. */
+    {
+        bool allowBob = (g_ship.state == SHIP_HOVER_READY);
+        if (!allowBob || g_noClip || !in->moving) {
+            g_simBobOffset = (Vector3){ 0.0f, 0.0f, 0.0f };
+            g_walkBobPhase = 0.0f;
+        } else {
+            float bobSpeed = 8.0f * (in->sprint ? 1.4f : 1.0f);
+            g_walkBobPhase += dt * bobSpeed;
+            float bobY = 0.048f * sinf(g_walkBobPhase);
+            float sway = 0.022f * sinf(g_walkBobPhase * 2.0f);
+            float rx, rz;
+            FPSCamera_GetRightFlat(&view, &rx, &rz);
+            g_simBobOffset = (Vector3){ rx * sway, bobY, rz * sway };
+        }
+    }
+}
+
+static void Gameplay_CaptureSnapshot(GameplaySnapshot* out, double tickTime) {
+    memset(out, 0, sizeof(*out));
+    out->tickTime = tickTime;
+    out->tick = g_simTick;
+    out->player = g_playerPhysics;
+    out->ship = g_ship;
+    out->bobOffset = g_simBobOffset;
+    out->noClip = g_noClip;
+    out->isColliding = g_isColliding;
+    out->standingOnShip = g_standingOnShip;
+    if (g_useStreamingWorld && g_voxelWorld) {
+        out->worldVersion = VoxelWorld_GetVersion(g_voxelWorld);
+        VoxelWorld_GetStats(g_voxelWorld, &out->loadedChunks, NULL);
+        WorldBeware_GetStreamRange(&g_worldBeware, &out->streamMinZ, &out->streamMaxZ);
+    }
+}
+
+// Um passo: consome o input do frame, simula e publica o snapshot
+static void Gameplay_Step(float dt, double tickTime) {
+    GameplayInput in;
+    SpinLock_Lock(&g_simInputLock);
+    in = g_simInput;
+    g_simInput.events = 0;
+    SpinLock_Unlock(&g_simInputLock);
+
+    /* Pausa/terminal aberto: mundo congelado (bordas do meio tempo caem); o render fica no último */
+    if (!in.simulate) return;
+
+    Gameplay_Simulate(&in, dt);
+    g_simTick++;
+    GameplaySnapshot* snap = (GameplaySnapshot*)TripleBuffer_WriteSlot(&g_snapshots);
+    if (!snap) return;
+    Gameplay_CaptureSnapshot(snap, tickTime);
+    TripleBuffer_Publish(&g_snapshots);
+}
+
+static void Gameplay_ThreadStep(void* userData, float dt, double tickTime) {
+    (void)userData;
+    Core_SimStep(dt);   /* Rede no ritmo da simulação (Core_Tick não faz poll com a thread ligada) */
+    Gameplay_Step(dt, tickTime);
+}
+
+// Junta o input do frame ao da simulação: estado segurado é o último, bordas acumulam
+static void Gameplay_SubmitInput(const GameplayInput* frame) {
+    SpinLock_Lock(&g_simInputLock);
+    uint32_t events = g_simInput.events | frame->events;
+    g_simInput = *frame;
+    g_simInput.events = events;
+    SpinLock_Unlock(&g_simInputLock);
+}
+
+static void ShiftBox(BoundingBox* box, Vector3 shift) {
+    box->min = Vector3Add(box->min, shift);
+    box->max = Vector3Add(box->max, shift);
+}
+
+/* Estado do frame: pega o snapshot novo (se houver) e interpola entre os dois últimos. O render
+ * anda um passo atrás da simulação, então quase sempre há snapshot dos dois lados; se a
+ * simulação atrasar, fica parado no último (sem extrapolar). */
+static void Gameplay_UpdateView(void) {
+    bool fresh = false;
+    const GameplaySnapshot* latest = (const GameplaySnapshot*)TripleBuffer_Read(&g_snapshots, &fresh);
+    if (fresh && latest) {
+        g_snapPrev = g_snapCurr;
+        g_snapCurr = *latest;
+    }
+    const GameplaySnapshot* a = &g_snapPrev;
+    const GameplaySnapshot* b = &g_snapCurr;
+    g_view = *b;
+
+    double span = b->tickTime - a->tickTime;
+    if (!g_simThread || span <= 0.0) return;   /* Simulação no frame: o último já é o do frame */
+    double renderTime = Time_GetSeconds() - (double)SIM_STEP_SECONDS;
+    float alpha = Clamp((float)((renderTime - a->tickTime) / span), 0.0f, 1.0f);
+
+    Vector3 playerA = { a->player.x, a->player.y, a->player.z };
+    Vector3 playerB = { b->player.x, b->player.y, b->player.z };
+    if (Vector3DistanceSqr(playerA, playerB) < SIM_SNAP_DISTANCE * SIM_SNAP_DISTANCE) {
+        Vector3 p = Vector3Lerp(playerA, playerB, alpha);
+        g_view.player.x = p.x;
+        g_view.player.y = p.y;
+        g_view.player.z = p.z;
+        g_view.bobOffset = Vector3Lerp(a->bobOffset, b->bobOffset, alpha);
+    }
+    if (Vector3DistanceSqr(a->ship.position, b->ship.position) < SIM_SNAP_DISTANCE * SIM_SNAP_DISTANCE) {
+        /* Caixas são derivadas da posição: andam junto */
+        Vector3 shipPos = Vector3Lerp(a->ship.position, b->ship.position, alpha);
+        Vector3 shift = Vector3Subtract(shipPos, b->ship.position);
+        g_view.ship.position = shipPos;
+        g_view.ship.descendT = LerpFloat(a->ship.descendT, b->ship.descendT, alpha);
+        ShiftBox(&g_view.ship.hullBox, shift);
+        ShiftBox(&g_view.ship.deckBox, shift);
+        ShiftBox(&g_view.ship.ladderBox, shift);
+    }
+}
+
 /* ——— Bússola (direção do olhar no plano XZ). Mundo: +Z=Norte, -Z=Sul, +X=Leste, -X=Oeste. ——— */
 #ifndef PI
 #define PI 3.14159265358979323846f
@@ -673,8 +1024,66 @@ static void GenerateDebugMap(void) {
     }
 }
 
+/* Blocos compartilhados: campos declarados antes de qualquer material ligar o bloco */
+static void UniformBlocks_Init(void) {
+    UniformBlock_Init(&g_fogBlock);
+    g_fogFields.start = UniformBlock_AddField(&g_fogBlock, "fogStart", MATERIAL_UNIFORM_FLOAT);
+    g_fogFields.end = UniformBlock_AddField(&g_fogBlock, "fogEnd", MATERIAL_UNIFORM_FLOAT);
+    g_fogFields.color = UniformBlock_AddField(&g_fogBlock, "fogColor", MATERIAL_UNIFORM_VEC3);
+    g_fogFields.type = UniformBlock_AddField(&g_fogBlock, "fogType", MATERIAL_UNIFORM_INT);
+    g_fogFields.density = UniformBlock_AddField(&g_fogBlock, "fogDensity", MATERIAL_UNIFORM_FLOAT);
+    g_fogFields.horizon = UniformBlock_AddField(&g_fogBlock, "fogHorizonColor", MATERIAL_UNIFORM_VEC3);
+    g_fogFields.sky = UniformBlock_AddField(&g_fogBlock, "fogSkyColor", MATERIAL_UNIFORM_VEC3);
+    g_fogFields.h0 = UniformBlock_AddField(&g_fogBlock, "fogH0", MATERIAL_UNIFORM_FLOAT);
+    g_fogFields.hRange = UniformBlock_AddField(&g_fogBlock, "fogHRange", MATERIAL_UNIFORM_FLOAT);
+
+    UniformBlock_Init(&g_cameraBlock);
+    g_cameraInvViewProj = UniformBlock_AddField(&g_cameraBlock, "invViewProj", MATERIAL_UNIFORM_MATRIX);
+}
+
+/* Bloco de fog a partir de g_atmosphere. Fog desligado: linear com faixa vazia (fogT = 0).
+   Valores iguais aos do frame anterior não sobem a versão: nenhum upload. */
+static void Fog_UpdateBlock(void) {
+    bool enabled = g_atmosphere.fog.enabled;
+    float fogDensity = (g_atmosphere.fog.type == FOG_EXPONENTIAL)
+        ? (-logf(1.0f - FOG_EXP_TARGET) / g_atmosphere.fog.endDistance)
+        : g_atmosphere.fog.density;
+    UniformBlock_SetFloat(&g_fogBlock, g_fogFields.start, enabled ? g_atmosphere.fog.startDistance : 0.0f);
+    UniformBlock_SetFloat(&g_fogBlock, g_fogFields.end, enabled ? g_atmosphere.fog.endDistance : 0.0f);
+    UniformBlock_SetColor(&g_fogBlock, g_fogFields.color, g_atmosphere.fog.fogColor);
+    UniformBlock_SetInt(&g_fogBlock, g_fogFields.type, enabled ? (int)g_atmosphere.fog.type : (int)FOG_LINEAR);
+    UniformBlock_SetFloat(&g_fogBlock, g_fogFields.density, fogDensity);
+    UniformBlock_SetColor(&g_fogBlock, g_fogFields.horizon, g_atmosphere.fog.fogColor);
+    UniformBlock_SetColor(&g_fogBlock, g_fogFields.sky, g_atmosphere.sky.topColor);
+    UniformBlock_SetFloat(&g_fogBlock, g_fogFields.h0, 0.0f);
+    UniformBlock_SetFloat(&g_fogBlock, g_fogFields.hRange, 20.0f);
+}
+
+/* Frustum da câmera do frame para o culling de chunks (far = distância de renderização + 1 chunk) */
+static void UpdateVoxelFrustum(const Camera3D* cam) {
+    Vec3 position = Vec3_Make(cam->position.x, cam->position.y, cam->position.z);
+    Vec3 target = Vec3_Make(cam->target.x, cam->target.y, cam->target.z);
+    Vec3 up = Vec3_Make(cam->up.x, cam->up.y, cam->up.z);
+    float aspect = (g_crtTarget.texture.height > 0)
+        ? (float)g_crtTarget.texture.width / (float)g_crtTarget.texture.height : 16.0f / 9.0f;
+    float farDist = (float)((g_voxelRenderer.renderDistance + 1) * CHUNK_SIZE_X);
+    Vec3 forward = Vec3_Normalize(Vec3_Sub(target, position));
+    Frustum frustum;
+    Frustum_CalculateUnclamped(&frustum, position, forward, up, cam->fovy * DEG2RAD, aspect, 0.05f, farDist);
+    VoxelRenderer_SetFrustum(&g_voxelRenderer, &frustum);
+    OcclusionView view = {position, forward, up, cam->fovy * DEG2RAD, aspect, 0.05f};
+    VoxelRenderer_SetOcclusionView(&g_voxelRenderer, &view);
+}
+
 void Scene_Gameplay_Shutdown(void) {
     if (!g_initialized) return;
+    /* Simulação para antes de soltar o que ela usa (mundo, nave, física) */
+    if (g_simThread) {
+        SimThread_Stop(g_simThread);
+        g_simThread = NULL;
+        Core_SetSimThreaded(false);
+    }
+    TripleBuffer_Destroy(&g_snapshots);
     g_mode = GP_PLAYING;
     g_pausePage = PAUSE_MAIN;
     g_pauseSelectionMain = 0;
@@ -702,17 +1111,12 @@ void Scene_Gameplay_Shutdown(void) {
     // Limpa sistemas de renderização
     Atmosphere_Shutdown(&g_atmosphere);
     Lighting_Shutdown(&g_lighting);
-    if (g_fogShader.id != 0) {
-        UnloadShader(g_fogShader);
-        g_fogShader.id = 0;
-        g_fogLocStart = g_fogLocEnd = g_fogLocColor = g_fogLocType = g_fogLocDensity = -1;
-        g_fogLocHorizon = g_fogLocSky = g_fogLocH0 = g_fogLocHRange = -1;
-    }
-    if (g_skyShader.id != 0) {
-        UnloadShader(g_skyShader);
-        g_skyShader.id = 0;
-        g_skyLocBottom = g_skyLocHorizon = g_skyLocTop = -1;
-    }
+    RenderMaterial_Unload(&g_fogMaterial);
+    RenderMaterial_Unload(&g_voxelMaterial);   /* só solta a referência: o renderer é o dono */
+    VoxelRenderer_Destroy(&g_voxelRenderer); /* antes do mundo: workers seguram snapshots */
+    RenderQueue_Init(&g_renderQueue);        /* slots de shader apontam para ids descarregados */
+    RenderMaterial_Unload(&g_skyMaterial);
+    g_skyBottom = g_skyHorizon = g_skyTop = -1;
     if (g_shipModelLoaded) {
         UnloadModel(g_shipModel);
         g_shipModelLoaded = false;
@@ -721,6 +1125,10 @@ void Scene_Gameplay_Shutdown(void) {
         UnloadRenderTexture(g_crtTarget);
         g_crtTarget = (RenderTexture2D){0};
     }
+    if (g_sceneTarget.id != 0) {
+        UnloadRenderTexture(g_sceneTarget);
+        g_sceneTarget = (RenderTexture2D){0};
+    }
     if (g_crtShader.id != 0) {
         UnloadShader(g_crtShader);
         g_crtShader = (Shader){0};
@@ -749,13 +1157,17 @@ void Scene_Gameplay_Init(void) {
     if (g_initialized) {
         Scene_Gameplay_Shutdown();
     }
+    RenderQueue_Init(&g_renderQueue);
     
     if (!g_useStreamingWorld) {
         GenerateDebugMap();
     } else {
         g_voxelWorld = VoxelWorld_Create("beware-the-dust");
+        VoxelWorld_EnablePersistence(g_voxelWorld, "saves"); /* sem disco: segue só com a seed */
+        VoxelWorld_UseSeedBake(g_voxelWorld, "bakes");       /* ausente/velho: gera ao vivo */
         WorldBeware_Init(&g_worldBeware, "beware-the-dust");
         WorldBeware_AttachVoxelWorld(&g_worldBeware, g_voxelWorld);
+        VoxelRenderer_Init(&g_voxelRenderer);
         Ship_Init(&g_ship);
     }
     
@@ -796,6 +1208,9 @@ void Scene_Gameplay_Init(void) {
     if (sw < 1) sw = 1;
     if (sh < 1) sh = 1;
     g_crtTarget = LoadRenderTexture(sw, sh);
+    g_sceneTarget = LoadRenderTexture(sw, sh);
+    SetTextureFilter(g_sceneTarget.texture, TEXTURE_FILTER_BILINEAR);   /* ampliação suave */
+    DynamicResolution_Init(&g_dynRes, DYNRES_TARGET_FRAME_TIME);
     {
         const char* crtPath = GetAssetPath("assets/shaders/menu-crt.fs");
         g_crtShader = LoadShader(0, crtPath);
@@ -854,54 +1269,86 @@ void Scene_Gameplay_Init(void) {
                                  (Color){50, 50, 60, 255},     // Cor ambiente (azul escuro)
                                  0.8f,                          // Intensidade (80%)
                                  0.3f);                         // Intensidade ambiente (30%)
+    g_faceLightVersion = 0; // Tabela de luz por face refeita no primeiro Draw
 
     // Fog no forward (view-space): shader com d = -viewPos.z, sem depth texture
     const char* vsPath = GetAssetPath("assets/shaders/fog_forward.vs");
     const char* fsPath = GetAssetPath("assets/shaders/fog_forward.fs");
-    if (FileExists(vsPath) && FileExists(fsPath)) {
-        g_fogShader = LoadShader(vsPath, fsPath);
-        if (g_fogShader.id != 0) {
-            g_fogLocStart = GetShaderLocation(g_fogShader, "fogStart");
-            g_fogLocEnd = GetShaderLocation(g_fogShader, "fogEnd");
-            g_fogLocColor = GetShaderLocation(g_fogShader, "fogColor");
-            g_fogLocType = GetShaderLocation(g_fogShader, "fogType");
-            g_fogLocDensity = GetShaderLocation(g_fogShader, "fogDensity");
-            g_fogLocHorizon = GetShaderLocation(g_fogShader, "fogHorizonColor");
-            g_fogLocSky = GetShaderLocation(g_fogShader, "fogSkyColor");
-            g_fogLocH0 = GetShaderLocation(g_fogShader, "fogH0");
-            g_fogLocHRange = GetShaderLocation(g_fogShader, "fogHRange");
+    UniformBlocks_Init();
+    if (FileExists(vsPath) && FileExists(fsPath) && RenderMaterial_Load(&g_fogMaterial, vsPath, fsPath)) {
+        /* Sem faixa e cor de fog o shader não serve: fica sem material */
+        if (GetShaderLocation(g_fogMaterial.shader, "fogStart") < 0 || GetShaderLocation(g_fogMaterial.shader, "fogEnd") < 0 ||
+            GetShaderLocation(g_fogMaterial.shader, "fogColor") < 0) {
+            RenderMaterial_Unload(&g_fogMaterial);
+        } else {
+            RenderMaterial_BindBlock(&g_fogMaterial, &g_fogBlock);
         }
     }
-    if (g_fogShader.id == 0) {
+    if (!RenderMaterial_IsReady(&g_fogMaterial)) {
         TraceLog(LOG_WARNING, "Fog forward shader nao carregado; fog em CPU desativado.");
     }
 
-    // Sky gradient por direção do raio (esfera, sem depth texture)
+    /* Mundo streaming: meshes por chunk (voxel_packed.vs + o mesmo fs de fog), até onde o fog cobre */
+    if (g_useStreamingWorld && g_voxelRenderer.initialized) {
+        char voxelVsPath[512];
+        snprintf(voxelVsPath, sizeof(voxelVsPath), "%s", GetAssetPath("assets/shaders/voxel_packed.vs"));
+        if (VoxelRenderer_LoadShader(&g_voxelRenderer, voxelVsPath, GetAssetPath("assets/shaders/fog_forward.fs"))) {
+            RenderMaterial_InitFromShader(&g_voxelMaterial, g_voxelRenderer.shader);
+            RenderMaterial_BindBlock(&g_voxelMaterial, &g_fogBlock);
+        }
+        VoxelRenderer_SetRenderDistance(&g_voxelRenderer,
+                                        (int32_t)ceilf(g_atmosphere.fog.endDistance / (float)CHUNK_SIZE_X) + 1);
+    }
+
+    // Sky gradient por direção do raio (triângulo de tela cheia, sem depth texture)
     vsPath = GetAssetPath("assets/shaders/sky_gradient.vs");
     fsPath = GetAssetPath("assets/shaders/sky_gradient.fs");
-    if (FileExists(vsPath) && FileExists(fsPath)) {
-        g_skyShader = LoadShader(vsPath, fsPath);
-        if (g_skyShader.id != 0) {
-            g_skyLocBottom = GetShaderLocation(g_skyShader, "skyBottom");
-            g_skyLocHorizon = GetShaderLocation(g_skyShader, "skyHorizon");
-            g_skyLocTop = GetShaderLocation(g_skyShader, "skyTop");
+    if (FileExists(vsPath) && FileExists(fsPath) && RenderMaterial_Load(&g_skyMaterial, vsPath, fsPath)) {
+        g_skyBottom = RenderMaterial_AddUniform(&g_skyMaterial, "skyBottom", MATERIAL_UNIFORM_VEC3);
+        g_skyHorizon = RenderMaterial_AddUniform(&g_skyMaterial, "skyHorizon", MATERIAL_UNIFORM_VEC3);
+        g_skyTop = RenderMaterial_AddUniform(&g_skyMaterial, "skyTop", MATERIAL_UNIFORM_VEC3);
+        /* Sem as cores ou sem invViewProj (shader antigo, da esfera): cai no fallback 2D */
+        if (g_skyBottom < 0 || g_skyHorizon < 0 || g_skyTop < 0 ||
+            GetShaderLocation(g_skyMaterial.shader, "invViewProj") < 0) {
+            RenderMaterial_Unload(&g_skyMaterial);
+            g_skyBottom = g_skyHorizon = g_skyTop = -1;
+        } else {
+            RenderMaterial_BindBlock(&g_skyMaterial, &g_cameraBlock);
         }
     }
-    if (g_skyShader.id == 0) {
+    if (!RenderMaterial_IsReady(&g_skyMaterial)) {
         TraceLog(LOG_WARNING, "Sky gradient shader nao carregado; usando Atmosphere_DrawSky.");
     }
     
     // Inicializa modo no clip como desativado
     g_noClip = false;
+
+    // Simulação: estado inicial vira os dois snapshots; input parado até o primeiro Update
+    g_simTick = 0;
+    g_walkBobPhase = 0.0f;
+    g_simBobOffset = (Vector3){ 0.0f, 0.0f, 0.0f };
+    memset(&g_simInput, 0, sizeof(g_simInput));
+    Gameplay_CaptureSnapshot(&g_snapCurr, Time_GetSeconds());
+    g_snapPrev = g_snapCurr;
+    g_view = g_snapCurr;
+    if (!TripleBuffer_Init(&g_snapshots, sizeof(GameplaySnapshot))) {
+        TraceLog(LOG_WARNING, "Gameplay: buffer de snapshots nao alocado.");
+    }
+    g_simThread = SimThread_Start(SIM_STEP_SECONDS, Gameplay_ThreadStep, NULL);
+    if (g_simThread) {
+        Core_SetSimThreaded(true);
+    } else {
+        TraceLog(LOG_WARNING, "Gameplay: thread de simulacao nao criada; simulando no frame.");
+    }
     
     g_firstFrame = true;
     DisableCursor();
     g_initialized = true;
 }
 
-void Scene_Gameplay_Update(float dt) {
-    if (!g_initialized) return;
-
+/* Thread principal: menus, terminal, mouse look e amostra do input para a simulação.
+ * Retornos antes do fim deixam frame->simulate = false (pausa/terminal congelam o mundo). */
+static void Gameplay_UpdateInput(float dt, GameplayInput* frame) {
     if (IsKeyPressed(KEY_F1)) g_dbgShowGrid = !g_dbgShowGrid;
     if (IsKeyPressed(KEY_F2)) g_showDirection = !g_showDirection;
     if (IsKeyPressed(KEY_F3)) g_dbgShowStats = !g_dbgShowStats;
@@ -1060,10 +1507,10 @@ void Scene_Gameplay_Update(float dt) {
 
     if (g_mode != GP_PLAYING) return;
 
-    /* Terminal ARC: E perto do monitor = toggle overlay. */
+    /* Terminal ARC: E perto do monitor = toggle overlay (nave/jogador do último snapshot). */
     if (g_arcTerminalFull && g_useStreamingWorld && g_voxelWorld) {
-        float mx = g_ship.position.x, mz = g_ship.position.z + 1.5f;
-        float dx = g_playerPhysics.x - mx, dz = g_playerPhysics.z - mz;
+        float mx = g_snapCurr.ship.position.x, mz = g_snapCurr.ship.position.z + 1.5f;
+        float dx = g_snapCurr.player.x - mx, dz = g_snapCurr.player.z - mz;
         float distSq = dx * dx + dz * dz;
         bool nearMonitor = (distSq < MONITOR_INTERACT_DIST * MONITOR_INTERACT_DIST);
 
@@ -1090,9 +1537,6 @@ void Scene_Gameplay_Update(float dt) {
                 FPSCamera_LockMouse(&g_fpsCamera);
             }
             g_fpsCamera.fov = g_settings.fov;
-            g_fpsCamera.position.x = g_playerPhysics.x;
-            g_fpsCamera.position.y = g_playerPhysics.y + PLAYER_EYE_HEIGHT;
-            g_fpsCamera.position.z = g_playerPhysics.z;
             return;  /* Não processa movimento quando terminal aberto. */
         } else if (nearMonitor && IsKeyPressed(KEY_E)) {
             ArcTerminalFull_Open(g_arcTerminalFull);
@@ -1117,229 +1561,48 @@ void Scene_Gameplay_Update(float dt) {
         int centerY = GetScreenHeight() / 2;
         SetMousePosition(centerX, centerY);
     }
-    
-    if (IsKeyPressed(KEY_N)) {
-        g_noClip = !g_noClip;
-    }
-    
-    /* Nave atualiza primeiro (clamp ao chão está dentro de Ship_Update). */
-    if (g_useStreamingWorld && g_voxelWorld) {
-        Ship_Update(&g_ship, dt);
-        Ship_UpdateCollision(&g_ship);
-        /* Delta aplicado aqui (antes do movimento) usando standingOnShip do frame anterior.
-         * Herdar deltaY evita kick/jitter quando a nave desce (player acompanha em Y).
-         * Quando speed > 0: se o player estiver na borda, o delta pode tirá-lo da projeção XZ,
-         * standing vira false e ele cai — comportamento correto de plataforma móvel, não bug. */
-        if (g_standingOnShip) {
-            g_playerPhysics.x += g_ship.deltaX;
-            g_playerPhysics.y += g_ship.deltaY;
-            g_playerPhysics.z += g_ship.deltaZ;
-            if (g_ship.deltaY != 0.0f) g_playerPhysics.vy = 0.0f;
-        }
-    }
-    
-    /* F5: inicia Drop Sequence (descida curva); player livre antes/durante/depois. */
-    if (g_useStreamingWorld && g_voxelWorld && IsKeyPressed(KEY_F5) && g_ship.state == SHIP_IDLE_HOVER) {
-        g_ship.state = SHIP_DESCENDING;
-        g_ship.descendTimer = 0.0f;
-        /* Destino: pairar perto do chão no centro do corredor (landZ fixo = 0). */
-        float groundY = 0.0f;
-        float finalY = groundY + g_ship.targetHeight;
-        float landX = 0.0f;
-        float landZ = 0.0f;
-        g_ship.descendEndPos = (Vector3){ landX, finalY, landZ };
-        /* Início do arco: alto e atrás (-30 em Z); nave já está aqui ao iniciar gameplay. */
-        g_ship.descendStartPos = (Vector3){ landX, g_ship.startHeight, landZ - 30.0f };
-        g_ship.position = g_ship.descendStartPos;
-    }
-    /* F6: inicia movimento da nave em direção ao norte (+Z); só quando já pousou. */
-    if (g_useStreamingWorld && g_voxelWorld && IsKeyPressed(KEY_F6) && g_ship.state == SHIP_HOVER_READY) {
-        g_ship.speed = 1.5f;
-        g_ship.moveDirX = 0.0f;
-        g_ship.moveDirZ = 1.0f;
-    }
-    if (g_fpsCamera.locked) {
-        float moveSpeed = 5.0f * (KeyDown(ACT_SPRINT) ? 1.6f : 1.0f);
 
-        if (g_noClip) {
-            float forward = 0.0f, right = 0.0f;
-            if (KeyDown(ACT_MOVE_FORWARD)) forward += 1.0f;
-            if (KeyDown(ACT_MOVE_BACK)) forward -= 1.0f;
-            if (KeyDown(ACT_MOVE_LEFT)) right -= 1.0f;
-            if (KeyDown(ACT_MOVE_RIGHT)) right += 1.0f;
-            
-            // Normaliza movimento diagonal
-            if (forward != 0.0f || right != 0.0f) {
-                float len = sqrtf(forward * forward + right * right);
-                if (len > 0.0001f) {
-                    forward /= len;
-                    right /= len;
-                }
-            }
-            
-            // Obtém vetores forward e right da câmera no plano XZ
-            float forwardX, forwardZ;
-            float rightX, rightZ;
-            FPSCamera_GetForwardFlat(&g_fpsCamera, &forwardX, &forwardZ);
-            FPSCamera_GetRightFlat(&g_fpsCamera, &rightX, &rightZ);
-            
-            float moveX = (forwardX * forward + rightX * right) * moveSpeed * dt;
-            float moveZ = (forwardZ * forward + rightZ * right) * moveSpeed * dt;
-            g_playerPhysics.x += moveX;
-            g_playerPhysics.z += moveZ;
-            float moveY = 0.0f;
-            if (IsKeyDown(KEY_SPACE)) moveY += 1.0f;
-            if (IsKeyDown(KEY_LEFT_CONTROL)) moveY -= 1.0f;
-            if (IsKeyDown(KEY_Q)) moveY += 1.0f;
-            if (IsKeyDown(KEY_E)) moveY -= 1.0f;
-            g_playerPhysics.y += moveY * moveSpeed * dt;
-            
-            // NO CLIPPING: Não aplica colisão
-        } else {
-            float forward = 0.0f, right = 0.0f;
-            if (KeyDown(ACT_MOVE_FORWARD)) forward += 1.0f;
-            if (KeyDown(ACT_MOVE_BACK)) forward -= 1.0f;
-            if (KeyDown(ACT_MOVE_LEFT)) right -= 1.0f;
-            if (KeyDown(ACT_MOVE_RIGHT)) right += 1.0f;
-            if (forward != 0.0f || right != 0.0f) {
-                float len = sqrtf(forward * forward + right * right);
-                if (len > 0.0001f) { forward /= len; right /= len; }
-            }
-            float forwardX, forwardZ, rightX, rightZ;
-            FPSCamera_GetForwardFlat(&g_fpsCamera, &forwardX, &forwardZ);
-            FPSCamera_GetRightFlat(&g_fpsCamera, &rightX, &rightZ);
-            float moveX = (forwardX * forward + rightX * right) * moveSpeed * dt;
-            float moveZ = (forwardZ * forward + rightZ * right) * moveSpeed * dt;
-            if (g_isOnLadder) { moveX = 0.0f; moveZ = 0.0f; } /* escada: só sobe, centraliza no X depois. */
-            // Movimento e colisão por eixo (X → Z → Y) para não escalar parede nem grudar no chão
-            g_playerPhysics.x += moveX;
-            ResolveCollisionsX();
-            g_playerPhysics.z += moveZ;
-            ResolveCollisionsZ();
-            
-            // Verifica ground ANTES do pulo: checa se há bloco sólido abaixo dos pés
-            // Esta verificação é feita ANTES do movimento Y para garantir que o pulo funcione
-            bool isOnGround = false;
-            
-            // Primeiro, verifica se estava no chão no frame anterior (da colisão)
-            // Isso ajuda a detectar ground mesmo quando o player está parado
-            if (g_playerPhysics.onGround && g_playerPhysics.vy <= 0.1f) {
-                isOnGround = true;
-            }
-            
-            // Verifica múltiplos pontos abaixo dos pés para melhor detecção
-            int32_t feetX = (int32_t)floorf(g_playerPhysics.x);
-            int32_t feetY = (int32_t)floorf(g_playerPhysics.y) - 1; // Um bloco abaixo dos pés
-            int32_t feetZ = (int32_t)floorf(g_playerPhysics.z);
-            
-            // Verifica se há bloco sólido abaixo e se o player está próximo o suficiente
-            if (IsBlockSolid(feetX, feetY, feetZ)) {
-                float blockTop = (float)feetY + 1.0f;
-                // Player está no chão se:
-                // 1. Está dentro de uma tolerância do topo do bloco
-                // 2. E não está caindo muito rápido (velocidade Y pequena ou zero)
-                if (g_playerPhysics.y >= blockTop - 0.15f && g_playerPhysics.y <= blockTop + 0.25f) {
-                    if (g_playerPhysics.vy <= 0.1f) { // Não está caindo ou caindo muito devagar
-                        isOnGround = true;
-                    }
-                }
-            }
-            
-            if (KeyPressed(ACT_JUMP) && isOnGround) {
-                g_playerPhysics.vy = JUMP_FORCE;
-                isOnGround = false; // Não está mais no chão após pular
-                g_playerPhysics.onGround = false; // Reseta flag também
-            }
+    // Input para a simulação: teclas seguradas agora, bordas do frame
+    if (IsKeyPressed(KEY_N)) frame->events |= SIM_EVENT_TOGGLE_NOCLIP;
+    if (IsKeyPressed(KEY_F5)) frame->events |= SIM_EVENT_SHIP_DROP;
+    if (IsKeyPressed(KEY_F6)) frame->events |= SIM_EVENT_SHIP_MOVE;
+    if (KeyPressed(ACT_JUMP)) frame->events |= SIM_EVENT_JUMP;
+    if (KeyDown(ACT_MOVE_FORWARD)) frame->forward += 1.0f;
+    if (KeyDown(ACT_MOVE_BACK)) frame->forward -= 1.0f;
+    if (KeyDown(ACT_MOVE_LEFT)) frame->right -= 1.0f;
+    if (KeyDown(ACT_MOVE_RIGHT)) frame->right += 1.0f;
+    if (IsKeyDown(KEY_SPACE)) frame->fly += 1.0f;
+    if (IsKeyDown(KEY_LEFT_CONTROL)) frame->fly -= 1.0f;
+    if (IsKeyDown(KEY_Q)) frame->fly += 1.0f;
+    if (IsKeyDown(KEY_E)) frame->fly -= 1.0f;
+    frame->moving = KeyDown(ACT_MOVE_FORWARD) || KeyDown(ACT_MOVE_BACK) || KeyDown(ACT_MOVE_LEFT) || KeyDown(ACT_MOVE_RIGHT);
+    frame->sprint = KeyDown(ACT_SPRINT);
+    frame->yaw = g_fpsCamera.yaw;
+    frame->active = g_fpsCamera.locked;
+    frame->simulate = true;
 
-            /* Escada: sobe automaticamente, gravidade desativada, centraliza no X. */
-            if (g_isOnLadder) {
-                g_playerPhysics.vx = 0.0f;
-                g_playerPhysics.vz = 0.0f;
-                g_playerPhysics.vy = 2.0f; /* velocidade de subida */
-                float ladderCenterX = (g_ship.ladderBox.min.x + g_ship.ladderBox.max.x) * 0.5f;
-                g_playerPhysics.x = LerpFloat(g_playerPhysics.x, ladderCenterX, 6.0f * dt);
-            } else {
-                /* Gravidade quando não está no chão. */
-                if (!isOnGround) {
-                    g_playerPhysics.vy += GRAVITY * dt;
-                    if (g_playerPhysics.vy < MAX_FALL_SPEED) {
-                        g_playerPhysics.vy = MAX_FALL_SPEED;
-                    }
-                } else {
-                    g_playerPhysics.vy = 0.0f;
-                }
-            }
-            
-            // Atualiza posição Y com velocidade e resolve colisão só no eixo Y
-            g_playerPhysics.y += g_playerPhysics.vy * dt;
-            ResolveCollisionsY();
-            
-            // Após colisão, se estiver no chão, garante que velocidade Y seja zero
-            if (g_playerPhysics.onGround) {
-                g_playerPhysics.vy = 0.0f;
-                // Garante que está colidindo quando está no chão
-                if (g_isColliding) {
-                    // Já está marcado como colidindo
-                }
-            }
-        }
-    }
-    
     if (g_arcTerminalFull) {
         ArcTerminalFull_Update(g_arcTerminalFull, dt);
     }
-    if (g_useStreamingWorld && g_voxelWorld) {
-        WorldBeware_Update(&g_worldBeware, g_ship.position.x, g_ship.position.z, 0.0f, g_playerPhysics.x, g_playerPhysics.z);
-        /* Zona segura (deck): jogador dentro = isSafe (oxigênio, etc.). */
-        {
-            Vector3 pMin = {
-                g_playerPhysics.x - g_playerPhysics.width * 0.5f,
-                g_playerPhysics.y,
-                g_playerPhysics.z - g_playerPhysics.depth * 0.5f
-            };
-            Vector3 pMax = {
-                g_playerPhysics.x + g_playerPhysics.width * 0.5f,
-                g_playerPhysics.y + g_playerPhysics.height,
-                g_playerPhysics.z + g_playerPhysics.depth * 0.5f
-            };
-            BoundingBox playerBox = (BoundingBox){ pMin, pMax };
-            g_playerPhysics.isSafe = CheckCollisionBoxes(playerBox, g_ship.deckBox);
-        }
-    } else {
-        g_playerPhysics.isSafe = false;
-    }
-    
-    // Atualiza posição da câmera para seguir o player
-    g_fpsCamera.position.x = g_playerPhysics.x;
-    g_fpsCamera.position.y = g_playerPhysics.y + PLAYER_EYE_HEIGHT;  /* y = pé; câmera nos olhos. */
-    g_fpsCamera.position.z = g_playerPhysics.z;
-
-    /* Head bob só enquanto segura teclas de movimento; desliga ao parar. Desativado durante pouso. */
-    {
-        bool allowBob = (g_ship.state == SHIP_HOVER_READY);
-        int moving = 0;
-        if (allowBob && !g_noClip && (KeyDown(ACT_MOVE_FORWARD) || KeyDown(ACT_MOVE_BACK) || KeyDown(ACT_MOVE_LEFT) || KeyDown(ACT_MOVE_RIGHT)))
-            moving = 1;
-        if (!allowBob || !moving) {
-            g_fpsCamera.bobOffset.x = g_fpsCamera.bobOffset.y = g_fpsCamera.bobOffset.z = 0.0f;
-            g_walkBobPhase = 0.0f;
-        } else {
-            float bobSpeed = 8.0f * (KeyDown(ACT_SPRINT) ? 1.4f : 1.0f);
-            g_walkBobPhase += dt * bobSpeed;
-            float bobY = 0.048f * sinf(g_walkBobPhase);
-            float sway = 0.022f * sinf(g_walkBobPhase * 2.0f);
-            float rx, rz;
-            FPSCamera_GetRightFlat(&g_fpsCamera, &rx, &rz);
-            g_fpsCamera.bobOffset.x = rx * sway;
-            g_fpsCamera.bobOffset.y = bobY;
-            g_fpsCamera.bobOffset.z = rz * sway;
-        }
-    }
 
     // Input/rede: movimento é via WASD + PhysicsBody. InputCmd reservado para rede.
     (void)Input_GetCommand(); /* uso futuro: enviar PKT_INPUT ao host */
 }
 
+void Scene_Gameplay_Update(float dt) {
+    if (!g_initialized) return;
+
+    GameplayInput frame;
+    memset(&frame, 0, sizeof(frame));
+    Gameplay_UpdateInput(dt, &frame);
+    if (!g_initialized) return;   /* Saiu para o menu (Shutdown já parou a simulação) */
+
+    Gameplay_SubmitInput(&frame);
+    if (!g_simThread) {
+        Gameplay_Step(dt, Time_GetSeconds());
+    }
+}
+
 /* Slider genérico: t em [0,1]. bg=fundo, fill=preenchimento, knob=controle. */
 static void DrawSlider(int x, int y, int w, int h, float t, Color bg, Color fill, Color knob) {
     DrawRectangle(x, y, w, h, bg);
@@ -1367,127 +1630,83 @@ static void DrawCrosshair(void) {
     DrawCrosshairAt(GetScreenWidth() / 2, GetScreenHeight() / 2);
 }
 
-void Scene_Gameplay_Draw(void) {
-    if (!g_initialized) return;
-
-    /* Terminal ARC: renderiza no RT próprio somente quando aberto. */
-    if (g_arcTerminalFull && ArcTerminalFull_IsOpen(g_arcTerminalFull)) {
-        ArcTerminalFull_Render(g_arcTerminalFull);
-    }
+// ——— Comandos da fila 3D (RenderQueue): retornam os draws diretos (fora do batch) ———
 
-    BeginTextureMode(g_crtTarget);
-    ClearBackground(BLACK);
+// Dados do frame lidos pelos comandos
+typedef struct GameplayDrawFrame {
+    Camera3D camera;
+    bool useVoxelRenderer;
+    int32_t playerBlockX;
+    int32_t playerBlockZ;
+} GameplayDrawFrame;
 
-    // ——— 2D (antes do 3D): só fallback do céu. Nunca desenhar UI/menu aqui. ———
-    if (g_skyShader.id == 0) {
-        Atmosphere_DrawSky(&g_atmosphere);
-    }
-#if !defined(USE_RLGL)
-    else {
-        Atmosphere_DrawSky(&g_atmosphere); /* sem rlgl: não desenha esfera 3D */
-    }
-#endif
-#if defined(USE_RLGL)
-    rlDrawRenderBatchActive();  // flush 2D antes de BeginMode3D; evita vértices 2D com projeção 3D
-#endif
+#define LEGACY_RENDER_DISTANCE 30.0f   // Mapa debug: raio da varredura por bloco
+#define LEGACY_RENDER_RADIUS ((int32_t)LEGACY_RENDER_DISTANCE + 5)
 
-    // ——— 3D: sky (esfera), grid, blocos. Tudo entre BeginMode3D e EndMode3D. ———
-    Camera3D raylibCam = FPSCamera_GetRaylibCamera(&g_fpsCamera);
-    BeginMode3D(raylibCam);
+static GameplayDrawFrame g_drawFrame;
 
 #if defined(USE_RLGL)
-    // Checklist sky: flush antes; estados culling/depth; DrawSphere; restaurar; flush depois.
-    if (g_skyShader.id != 0 && g_skyLocBottom >= 0 && g_skyLocHorizon >= 0 && g_skyLocTop >= 0) {
-        rlDrawRenderBatchActive();          // antes do sky: não desenhar lixo com estados alterados
-        rlDisableBackfaceCulling();
-        rlDisableDepthMask();
-        BeginShaderMode(g_skyShader);
-        float sb[3] = { g_atmosphere.sky.bottomColor.r/255.0f, g_atmosphere.sky.bottomColor.g/255.0f, g_atmosphere.sky.bottomColor.b/255.0f };
-        float sh[3] = { g_atmosphere.sky.horizonColor.r/255.0f, g_atmosphere.sky.horizonColor.g/255.0f, g_atmosphere.sky.horizonColor.b/255.0f };
-        float st[3] = { g_atmosphere.sky.topColor.r/255.0f, g_atmosphere.sky.topColor.g/255.0f, g_atmosphere.sky.topColor.b/255.0f };
-        SetShaderValue(g_skyShader, g_skyLocBottom, sb, SHADER_UNIFORM_VEC3);
-        SetShaderValue(g_skyShader, g_skyLocHorizon, sh, SHADER_UNIFORM_VEC3);
-        SetShaderValue(g_skyShader, g_skyLocTop, st, SHADER_UNIFORM_VEC3);
-        DrawSphere(g_fpsCamera.position, 400.0f, WHITE);
-        EndShaderMode();
-        rlEnableDepthMask();
-        rlEnableBackfaceCulling();
-        rlDrawRenderBatchActive();          // depois do sky: isolado do grid/blocos
-    }
+// Céu: gradiente por raio num triângulo de tela cheia (3 vértices no batch, já em NDC).
+// O shader reconstrói o raio pela inversa da view-projection; grupo sem escrita de profundidade.
+static int32_t DrawSkyCommand(void* userData) {
+    (void)userData;
+    RenderMaterial_Apply(&g_skyMaterial);
+    RenderMaterial_SetColor(&g_skyMaterial, g_skyBottom, g_atmosphere.sky.bottomColor);
+    RenderMaterial_SetColor(&g_skyMaterial, g_skyHorizon, g_atmosphere.sky.horizonColor);
+    RenderMaterial_SetColor(&g_skyMaterial, g_skyTop, g_atmosphere.sky.topColor);
+    rlBegin(RL_TRIANGLES);
+    rlColor4ub(255, 255, 255, 255);
+    rlVertex3f(-1.0f, -1.0f, 0.0f);
+    rlVertex3f(3.0f, -1.0f, 0.0f);
+    rlVertex3f(-1.0f, 3.0f, 0.0f);
+    rlEnd();
+    return 0;
+}
 #endif
 
-    if (g_dbgShowGrid) {
-        int32_t gridSize = 60;
-        int32_t gridSpacing = 10;
-        Color gridColor = (Color){50, 50, 50, 100};
-        for (int z = -gridSize; z <= gridSize; z += gridSpacing) {
-            float zf = (float)z;
-            if (!isfinite((double)zf)) continue;
-            DrawLine3D((Vector3){(float)-gridSize, 0.5f, zf}, (Vector3){(float)gridSize, 0.5f, zf}, gridColor);
-        }
-        for (int x = -gridSize; x <= gridSize; x += gridSpacing) {
-            float xf = (float)x;
-            if (!isfinite((double)xf)) continue;
-            DrawLine3D((Vector3){xf, 0.5f, (float)-gridSize}, (Vector3){xf, 0.5f, (float)gridSize}, gridColor);
-        }
-#if defined(USE_RLGL)
-        rlDrawRenderBatchActive();
-#endif
-    }
+static int32_t DrawGridCommand(void* userData) {
+    (void)userData;
+    int32_t gridSize = 60;
+    int32_t gridSpacing = 10;
+    Color gridColor = (Color){50, 50, 50, 100};
+    for (int z = -gridSize; z <= gridSize; z += gridSpacing) {
+        float zf = (float)z;
+        if (!isfinite((double)zf)) continue;
+        DrawLine3D((Vector3){(float)-gridSize, 0.5f, zf}, (Vector3){(float)gridSize, 0.5f, zf}, gridColor);
+    }
+    for (int x = -gridSize; x <= gridSize; x += gridSpacing) {
+        float xf = (float)x;
+        if (!isfinite((double)xf)) continue;
+        DrawLine3D((Vector3){xf, 0.5f, (float)-gridSize}, (Vector3){xf, 0.5f, (float)gridSize}, gridColor);
+    }
+    return 0;
+}
 
-    // Fog no forward: view-space d = -viewPos.z. Shader só em blocos (triângulos + wireframe).
-    if (g_atmosphere.fog.enabled && g_fogShader.id != 0 && g_fogLocStart >= 0 && g_fogLocEnd >= 0 && g_fogLocColor >= 0) {
-        BeginShaderMode(g_fogShader);
-        float fogStart = g_atmosphere.fog.startDistance;
-        float fogEnd = g_atmosphere.fog.endDistance;
-        float fogColorVec3[3] = {
-            g_atmosphere.fog.fogColor.r / 255.0f,
-            g_atmosphere.fog.fogColor.g / 255.0f,
-            g_atmosphere.fog.fogColor.b / 255.0f
-        };
-        SetShaderValue(g_fogShader, g_fogLocStart, &fogStart, SHADER_UNIFORM_FLOAT);
-        SetShaderValue(g_fogShader, g_fogLocEnd, &fogEnd, SHADER_UNIFORM_FLOAT);
-        SetShaderValue(g_fogShader, g_fogLocColor, fogColorVec3, SHADER_UNIFORM_VEC3);
-        if (g_fogLocType >= 0) {
-            int fogType = (int)g_atmosphere.fog.type;
-            SetShaderValue(g_fogShader, g_fogLocType, &fogType, SHADER_UNIFORM_INT);
-        }
-        if (g_fogLocDensity >= 0) {
-            float fogDensity = (g_atmosphere.fog.type == FOG_EXPONENTIAL)
-                ? (-logf(1.0f - FOG_EXP_TARGET) / g_atmosphere.fog.endDistance)
-                : g_atmosphere.fog.density;
-            SetShaderValue(g_fogShader, g_fogLocDensity, &fogDensity, SHADER_UNIFORM_FLOAT);
-        }
-        if (g_fogLocHorizon >= 0) {
-            float fh[3] = { g_atmosphere.fog.fogColor.r/255.0f, g_atmosphere.fog.fogColor.g/255.0f, g_atmosphere.fog.fogColor.b/255.0f };
-            SetShaderValue(g_fogShader, g_fogLocHorizon, fh, SHADER_UNIFORM_VEC3);
-        }
-        if (g_fogLocSky >= 0) {
-            float fs[3] = { g_atmosphere.sky.topColor.r/255.0f, g_atmosphere.sky.topColor.g/255.0f, g_atmosphere.sky.topColor.b/255.0f };
-            SetShaderValue(g_fogShader, g_fogLocSky, fs, SHADER_UNIFORM_VEC3);
-        }
-        if (g_fogLocH0 >= 0) {
-            float fogH0 = 0.0f;
-            SetShaderValue(g_fogShader, g_fogLocH0, &fogH0, SHADER_UNIFORM_FLOAT);
-        }
-        if (g_fogLocHRange >= 0) {
-            float fogHRange = 20.0f;
-            SetShaderValue(g_fogShader, g_fogLocHRange, &fogHRange, SHADER_UNIFORM_FLOAT);
-        }
-    }
+// Meshes por chunk em cache, refeitos só quando o chunk (ou a borda de um vizinho) muda
+static int32_t DrawVoxelWorldCommand(void* userData) {
+    (void)userData;
+    UpdateVoxelFrustum(&g_drawFrame.camera);
+    VoxelRenderer_SetLighting(&g_voxelRenderer, &g_lighting);
+    VoxelRenderer_Render(&g_voxelRenderer, g_voxelWorld, g_view.player.x, g_view.player.y,
+                         g_view.player.z, &g_drawFrame.camera);
+    return g_voxelRenderer.stats.chunksDrawn + g_voxelRenderer.stats.translucentChunksDrawn;
+}
 
-    // ——— Passe 1: só triângulos (faces sólidas), com fog shader ———
-    const float RENDER_DISTANCE = 30.0f;
-    const float RENDER_DISTANCE_SQ = RENDER_DISTANCE * RENDER_DISTANCE;
-    int32_t playerBlockX = (int32_t)floorf(g_playerPhysics.x);
-    int32_t playerBlockZ = (int32_t)floorf(g_playerPhysics.z);
-    int32_t renderRadius = (int32_t)RENDER_DISTANCE + 5;
+// Sem renderer (mapa debug): varredura por bloco
+static int32_t DrawLegacyBlocksCommand(void* userData) {
+    (void)userData;
+    const float RENDER_DISTANCE_SQ = LEGACY_RENDER_DISTANCE * LEGACY_RENDER_DISTANCE;
+    int32_t playerBlockX = g_drawFrame.playerBlockX;
+    int32_t playerBlockZ = g_drawFrame.playerBlockZ;
+    int32_t renderRadius = LEGACY_RENDER_RADIUS;
     int facesInBatch = 0;
-
+    if (g_faceLightVersion == 0 || g_faceLightVersion != g_lighting.version) {
+        g_faceLightVersion = Lighting_GetFaceLight(&g_lighting, g_faceLight);
+    }
     for (int32_t x = playerBlockX - renderRadius; x <= playerBlockX + renderRadius; x++) {
         for (int32_t z = playerBlockZ - renderRadius; z <= playerBlockZ + renderRadius; z++) {
-            float dx = (float)x + 0.5f - g_playerPhysics.x;
-            float dz = (float)z + 0.5f - g_playerPhysics.z;
+            float dx = (float)x + 0.5f - g_view.player.x;
+            float dz = (float)z + 0.5f - g_view.player.z;
             if (dx * dx + dz * dz > RENDER_DISTANCE_SQ) continue;
             for (int32_t y = 0; y < MAP_SIZE_Y; y++) {
                 if (!IsBlockSolid(x, y, z)) continue;
@@ -1522,36 +1741,42 @@ void Scene_Gameplay_Draw(void) {
             }
         }
     }
+    return 0;
+}
 
-    if (g_useStreamingWorld && g_voxelWorld) {
-        Ship_Draw(&g_ship);
-    }
+static int32_t DrawShipCommand(void* userData) {
+    (void)userData;
+    Ship_Draw(&g_view.ship);
+    return 0;
+}
 
-    if (g_atmosphere.fog.enabled && g_fogShader.id != 0) {
-        EndShaderMode();
-    }
-#if defined(USE_RLGL)
-    rlDrawRenderBatchActive();
-#endif
+// Monitor na nave: cubo cinza (terminal físico); interação por proximidade
+static int32_t DrawShipMonitorCommand(void* userData) {
+    (void)userData;
+    float deckTop = g_view.ship.hullBox.max.y;
+    float monY = deckTop + 0.5f;
+    float monZ = g_view.ship.position.z + 1.5f;
+    DrawCube((Vector3){g_view.ship.position.x, monY, monZ}, 0.3f, 1.0f, 0.3f, (Color){50, 55, 60, 255});
+    return 0;
+}
 
-        /* Monitor na nave: cubo cinza (terminal físico); interação por proximidade. */
-        if (g_useStreamingWorld && g_voxelWorld) {
-            float deckTop = g_ship.hullBox.max.y;
-            float monY = deckTop + 0.5f;
-            float monZ = g_ship.position.z + 1.5f;
-            DrawCube((Vector3){g_ship.position.x, monY, monZ}, 0.3f, 1.0f, 0.3f, (Color){50, 55, 60, 255});
-        }
-#if defined(USE_RLGL)
-    rlDrawRenderBatchActive();  // flush sólidos/fog antes do passe de wireframe
-#endif
+static int32_t DrawVoxelWireCommand(void* userData) {
+    (void)userData;
+    VoxelRenderer_RenderWireframe(&g_voxelRenderer, &g_drawFrame.camera, (Color){0, 0, 0, 80});
+    return g_voxelRenderer.stats.chunksDrawn;
+}
 
-    // ——— Passe 2: só linhas (wireframe), shader padrão, fora do fog. F4 = g_dbgShowWireframe. ———
-    if (g_dbgShowWireframe) {
+static int32_t DrawLegacyWireCommand(void* userData) {
+    (void)userData;
+    const float RENDER_DISTANCE_SQ = LEGACY_RENDER_DISTANCE * LEGACY_RENDER_DISTANCE;
+    int32_t playerBlockX = g_drawFrame.playerBlockX;
+    int32_t playerBlockZ = g_drawFrame.playerBlockZ;
+    int32_t renderRadius = LEGACY_RENDER_RADIUS;
     int linesInBatch = 0;
     for (int32_t x = playerBlockX - renderRadius; x <= playerBlockX + renderRadius; x++) {
         for (int32_t z = playerBlockZ - renderRadius; z <= playerBlockZ + renderRadius; z++) {
-            float dx = (float)x + 0.5f - g_playerPhysics.x;
-            float dz = (float)z + 0.5f - g_playerPhysics.z;
+            float dx = (float)x + 0.5f - g_view.player.x;
+            float dz = (float)z + 0.5f - g_view.player.z;
             if (dx * dx + dz * dz > RENDER_DISTANCE_SQ) continue;
             for (int32_t y = 0; y < MAP_SIZE_Y; y++) {
                 if (!IsBlockSolid(x, y, z)) continue;
@@ -1564,29 +1789,143 @@ void Scene_Gameplay_Draw(void) {
             }
         }
     }
-    /* Nave: wire + 8 vértices do AABB (só debug visual). */
-    {
-        const BoundingBox* bb = &g_ship.hullBox;
-        DrawBoundingBox(*bb, LIME);
-        const float r = 0.05f;
-        Vector3 c[] = {
-            { bb->min.x, bb->min.y, bb->min.z }, { bb->max.x, bb->min.y, bb->min.z },
-            { bb->min.x, bb->max.y, bb->min.z }, { bb->max.x, bb->max.y, bb->min.z },
-            { bb->min.x, bb->min.y, bb->max.z }, { bb->max.x, bb->min.y, bb->max.z },
-            { bb->min.x, bb->max.y, bb->max.z }, { bb->max.x, bb->max.y, bb->max.z }
-        };
-        for (int i = 0; i < 8; i++) DrawSphere(c[i], r, LIME);
+    return 0;
+}
+
+// Nave: wire + 8 vértices do AABB (só debug visual)
+static int32_t DrawShipDebugCommand(void* userData) {
+    (void)userData;
+    const BoundingBox* bb = &g_view.ship.hullBox;
+    DrawBoundingBox(*bb, LIME);
+    const float r = 0.05f;
+    Vector3 c[] = {
+        { bb->min.x, bb->min.y, bb->min.z }, { bb->max.x, bb->min.y, bb->min.z },
+        { bb->min.x, bb->max.y, bb->min.z }, { bb->max.x, bb->max.y, bb->min.z },
+        { bb->min.x, bb->min.y, bb->max.z }, { bb->max.x, bb->min.y, bb->max.z },
+        { bb->min.x, bb->max.y, bb->max.z }, { bb->max.x, bb->max.y, bb->max.z }
+    };
+    for (int i = 0; i < 8; i++) DrawSphere(c[i], r, LIME);
+    return 0;
+}
+
+void Scene_Gameplay_Draw(void) {
+    if (!g_initialized) return;
+    Gameplay_UpdateView();
+
+    /* Terminal ARC: renderiza no RT próprio somente quando aberto. */
+    if (g_arcTerminalFull && ArcTerminalFull_IsOpen(g_arcTerminalFull)) {
+        ArcTerminalFull_Render(g_arcTerminalFull);
     }
+
+    // ——— Cena em resolução dinâmica: só o canto sceneW x sceneH do g_sceneTarget. ———
+    // A escala é uniforme: o aspecto do BeginMode3D (tamanho do RT) continua certo, e o 2D
+    // do fallback do céu (ortho do RT inteiro) encolhe junto com o viewport.
+    DynamicResolution_Update(&g_dynRes, GetFrameTime());
+    int sceneW = DynamicResolution_Scale(&g_dynRes, g_sceneTarget.texture.width);
+    int sceneH = DynamicResolution_Scale(&g_dynRes, g_sceneTarget.texture.height);
+    BeginTextureMode(g_sceneTarget);
+    ClearBackground(BLACK);
+#if defined(USE_RLGL)
+    rlViewport(0, 0, sceneW, sceneH);
+#endif
+
+    // ——— 2D (antes do 3D): só fallback do céu. Nunca desenhar UI/menu aqui. ———
+    if (!RenderMaterial_IsReady(&g_skyMaterial)) {
+        Atmosphere_DrawSky(&g_atmosphere);
+    }
+#if !defined(USE_RLGL)
+    else {
+        Atmosphere_DrawSky(&g_atmosphere); /* sem rlgl: não desenha o triângulo do céu */
+    }
+#endif
+
+    // ——— 3D: comandos gravados na fila e submetidos por passe/shader/estado. ———
+    // BeginMode3D/EndMode3D já descarregam o batch (2D antes e depois não se misturam).
+    // Câmera: orientação do frame (mouse), posição e head bob interpolados da simulação
+    g_fpsCamera.position = (Vector3){ g_view.player.x, g_view.player.y + PLAYER_EYE_HEIGHT, g_view.player.z };
+    g_fpsCamera.bobOffset = g_view.bobOffset;
+    g_drawFrame.camera = FPSCamera_GetRaylibCamera(&g_fpsCamera);
+    g_drawFrame.useVoxelRenderer = g_useStreamingWorld && g_voxelWorld && g_voxelRenderer.initialized;
+    g_drawFrame.playerBlockX = (int32_t)floorf(g_view.player.x);
+    g_drawFrame.playerBlockZ = (int32_t)floorf(g_view.player.z);
+    BeginMode3D(g_drawFrame.camera);
+    RenderQueue_Begin(&g_renderQueue);
+    RenderMaterial_ResetStats(&g_fogMaterial);
+    RenderMaterial_ResetStats(&g_voxelMaterial);
+    RenderMaterial_ResetStats(&g_skyMaterial);
+
 #if defined(USE_RLGL)
-        rlDrawRenderBatchActive();
+    if (RenderMaterial_IsReady(&g_skyMaterial)) {
+        // Bloco de câmera: matrizes do BeginMode3D (parado, nada é reenviado)
+        Matrix invViewProj = MatrixInvert(MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+        UniformBlock_Set(&g_cameraBlock, g_cameraInvViewProj, &invViewProj);
+        uint8_t skySlot = RenderQueue_RegisterShader(&g_renderQueue, g_skyMaterial.shader);
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_SKY, skySlot, RENDER_STATE_NO_DEPTH_WRITE, 0.0f),
+                         DrawSkyCommand, NULL);
+    }
 #endif
+    if (g_dbgShowGrid) {
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_OPAQUE, 0, 0, 0.0f), DrawGridCommand, NULL);
+    }
+
+    // Fog no forward: view-space d = -viewPos.z. Bloco sincronizado antes da fila (o voxel usa o
+    // próprio shader); cada material só envia os campos que mudaram desde o seu último Apply.
+    Fog_UpdateBlock();
+    if (g_drawFrame.useVoxelRenderer) {
+        RenderMaterial_Apply(&g_voxelMaterial);
+    }
+    uint8_t fogSlot = 0;
+    if (g_atmosphere.fog.enabled && RenderMaterial_IsReady(&g_fogMaterial)) {
+        RenderMaterial_Apply(&g_fogMaterial);
+        fogSlot = RenderQueue_RegisterShader(&g_renderQueue, g_fogMaterial.shader);
     }
 
+    // Opacos: mundo (meshes em cache ou varredura do mapa debug) e nave com fog; monitor sem
+    if (g_drawFrame.useVoxelRenderer) {
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_OPAQUE, 0, 0, 0.0f), DrawVoxelWorldCommand, NULL);
+    } else {
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_OPAQUE, fogSlot, 0, 0.0f), DrawLegacyBlocksCommand, NULL);
+    }
+    if (g_useStreamingWorld && g_voxelWorld) {
+        float shipDepth = Vector3Distance(g_drawFrame.camera.position, g_view.ship.position);
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_OPAQUE, fogSlot, 0, shipDepth), DrawShipCommand, NULL);
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_OPAQUE, 0, 0, shipDepth), DrawShipMonitorCommand, NULL);
+    }
+
+    // Debug (F4): mundo streaming usa o mesh em cache de cada chunk em modo de linhas (shader
+    // do voxel, com fog); mapa debug varre por bloco com o shader padrão. Mais a caixa da nave.
+    if (g_dbgShowWireframe) {
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_DEBUG, 0, 0, 0.0f),
+                         g_drawFrame.useVoxelRenderer ? DrawVoxelWireCommand : DrawLegacyWireCommand, NULL);
+        RenderQueue_Push(&g_renderQueue, RenderQueue_MakeKey(RENDER_PASS_DEBUG, 0, 0, 0.0f), DrawShipDebugCommand, NULL);
+    }
+
+    // A simulação carrega/descarrega chunks em paralelo: leituras do mundo no passe sob época
+    int32_t worldGuard = VoxelWorld_ReadBegin();
+    RenderQueue_Submit(&g_renderQueue);
+    VoxelWorld_ReadEnd(worldGuard);
     EndMode3D();
+    EndTextureMode();   /* restaura o viewport */
 
+    // ——— Composição: amplia a cena (bilinear) no RT nativo do CRT, sem blend (alfa da cena não
+    // importa e o RT inteiro é coberto: dispensa o clear). HUD por cima em resolução nativa. ———
+    BeginTextureMode(g_crtTarget);
+    {
+        // Escala < 1: o bilinear na borda do canto renderizado mistura texels limpos do resto do
+        // RT (franja escura à direita/em cima). Meio texel para dentro: só amostra o renderizado.
+        float insetX = (sceneW < g_sceneTarget.texture.width) ? 0.5f : 0.0f;
+        float insetY = (sceneH < g_sceneTarget.texture.height) ? 0.5f : 0.0f;
+        Rectangle sceneSrc = { insetX, insetY, (float)sceneW - 2.0f * insetX, -((float)sceneH - 2.0f * insetY) };
+        Rectangle sceneDst = { 0.0f, 0.0f, (float)g_crtTarget.texture.width, (float)g_crtTarget.texture.height };
 #if defined(USE_RLGL)
-    rlDrawRenderBatchActive();  // transição 3D→2D: evita vértices 3D desenhados com projeção 2D
+        rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM);
 #endif
+        DrawTexturePro(g_sceneTarget.texture, sceneSrc, sceneDst, (Vector2){0.0f, 0.0f}, 0.0f, WHITE);
+#if defined(USE_RLGL)
+        EndBlendMode();
+#endif
+    }
 
     // ——— 2D (sempre depois de EndMode3D): HUD ou overlay de pause (centralizado, fonte assets/fonts). ———
     if (g_mode == GP_PAUSED) {
@@ -1686,49 +2025,83 @@ void Scene_Gameplay_Draw(void) {
             char info[256];
             DrawFPS(10, (int)startY);
             startY += 25.0f;
-            snprintf(info, sizeof(info), "Position: X=%.1f Y=%.1f Z=%.1f", g_playerPhysics.x, g_playerPhysics.y, g_playerPhysics.z);
+            snprintf(info, sizeof(info), "Position: X=%.1f Y=%.1f Z=%.1f", g_view.player.x, g_view.player.y, g_view.player.z);
             DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
             startY += lineHeight;
-            snprintf(info, sizeof(info), "Velocity: X=%.1f Y=%.1f Z=%.1f", g_playerPhysics.vx, g_playerPhysics.vy, g_playerPhysics.vz);
+            snprintf(info, sizeof(info), "Velocity: X=%.1f Y=%.1f Z=%.1f", g_view.player.vx, g_view.player.vy, g_view.player.vz);
             DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
             startY += lineHeight;
-            bool isColliding = g_isColliding && !g_noClip;
+            snprintf(info, sizeof(info), "Scene: %dx%d (%.0f%%)  frame avg %.1f ms / %.1f ms",
+                     sceneW, sceneH, g_dynRes.scale * 100.0f, g_dynRes.averageFrameTime * 1000.0f,
+                     g_dynRes.targetFrameTime * 1000.0f);
+            DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
+            startY += lineHeight;
+            if (g_simThread) {
+                SimThreadStats ss;
+                SimThread_GetStats(g_simThread, &ss);
+                snprintf(info, sizeof(info), "Sim: tick %llu  step %.2f ms (max %.2f) / %.1f ms  dropped %llu",
+                         (unsigned long long)g_view.tick, ss.lastStepTime * 1000.0f, ss.maxStepTime * 1000.0f,
+                         SIM_STEP_SECONDS * 1000.0f, (unsigned long long)ss.droppedSteps);
+            } else {
+                snprintf(info, sizeof(info), "Sim: per frame (no thread)  tick %llu", (unsigned long long)g_view.tick);
+            }
+            DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
+            startY += lineHeight;
+            bool isColliding = g_view.isColliding && !g_view.noClip;
             snprintf(info, sizeof(info), "Collision: %s", isColliding ? "YES" : "NO");
             DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
             startY += lineHeight;
-            snprintf(info, sizeof(info), "Standing: %d  OnGround: %d", g_standingOnShip ? 1 : 0, g_playerPhysics.onGround ? 1 : 0);
+            snprintf(info, sizeof(info), "Standing: %d  OnGround: %d", g_view.standingOnShip ? 1 : 0, g_view.player.onGround ? 1 : 0);
             DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
             startY += lineHeight;
             if (g_useStreamingWorld && g_voxelWorld) {
-                int32_t minZ = 0, maxZ = 0;
-                WorldBeware_GetStreamRange(&g_worldBeware, &minZ, &maxZ);
-                snprintf(info, sizeof(info), "STREAM Z: %d..%d", minZ, maxZ);
+                snprintf(info, sizeof(info), "STREAM Z: %d..%d", g_view.streamMinZ, g_view.streamMaxZ);
                 DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
                 startY += lineHeight;
-                snprintf(info, sizeof(info), "Safe (deck): %s", g_playerPhysics.isSafe ? "YES" : "NO");
+                snprintf(info, sizeof(info), "Safe (deck): %s", g_view.player.isSafe ? "YES" : "NO");
                 DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
                 startY += lineHeight;
                 const char* shipStateStr = "?";
-                if (g_ship.state == SHIP_IDLE_HOVER) shipStateStr = "IDLE_HOVER";
-                else if (g_ship.state == SHIP_DESCENDING) shipStateStr = "DESCENDING";
-                else if (g_ship.state == SHIP_HOVER_READY) shipStateStr = "HOVER_READY";
-                snprintf(info, sizeof(info), "ShipState: %s  ShipY: %.1f  ShipSpeed: %.1f", shipStateStr, g_ship.position.y, g_ship.speed);
+                if (g_view.ship.state == SHIP_IDLE_HOVER) shipStateStr = "IDLE_HOVER";
+                else if (g_view.ship.state == SHIP_DESCENDING) shipStateStr = "DESCENDING";
+                else if (g_view.ship.state == SHIP_HOVER_READY) shipStateStr = "HOVER_READY";
+                snprintf(info, sizeof(info), "ShipState: %s  ShipY: %.1f  ShipSpeed: %.1f", shipStateStr, g_view.ship.position.y, g_view.ship.speed);
                 DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
                 startY += lineHeight;
-                snprintf(info, sizeof(info), "ShipY: %.1f  HullMinY: %.1f  HullMaxY: %.1f", g_ship.position.y, g_ship.hullBox.min.y, g_ship.hullBox.max.y);
+                snprintf(info, sizeof(info), "ShipY: %.1f  HullMinY: %.1f  HullMaxY: %.1f", g_view.ship.position.y, g_view.ship.hullBox.min.y, g_view.ship.hullBox.max.y);
                 DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
                 startY += lineHeight;
-                float playerFootY = g_playerPhysics.y;
-                float playerCenterY = g_playerPhysics.y + g_playerPhysics.height * 0.5f;
-                float playerHeadY = g_playerPhysics.y + g_playerPhysics.height;
+                float playerFootY = g_view.player.y;
+                float playerCenterY = g_view.player.y + g_view.player.height * 0.5f;
+                float playerHeadY = g_view.player.y + g_view.player.height;
                 snprintf(info, sizeof(info), "PlayerFootY: %.1f  PlayerCenterY: %.1f  PlayerHeadY: %.1f", playerFootY, playerCenterY, playerHeadY);
                 DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
                 startY += lineHeight;
             }
             if (g_useStreamingWorld && g_voxelWorld) {
-                int32_t loadedChunks = 0;
-                VoxelWorld_GetStats(g_voxelWorld, &loadedChunks, NULL);
-                snprintf(info, sizeof(info), "Chunks: %d", loadedChunks);
+                int32_t referencedSections = 0, storedSections = 0;
+                float dedupRatio = 1.0f;
+                VoxelWorld_GetSectionStats(&referencedSections, &storedSections, &dedupRatio);
+                snprintf(info, sizeof(info), "Chunks: %d (world v%u)  Sections: %d/%d (dedup %.1fx)",
+                         g_view.loadedChunks, g_view.worldVersion, storedSections, referencedSections, dedupRatio);
+                if (g_voxelRenderer.initialized) {
+                    DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
+                    startY += lineHeight;
+                    const VoxelRendererStats* rs = &g_voxelRenderer.stats;
+                    snprintf(info, sizeof(info), "Render chunks: %d tested  %d culled  %d occluded  %d drawn  (%d sections, %d occluders, %d verts, %d jobs)",
+                             rs->chunksTested, rs->chunksCulled, rs->chunksOccluded, rs->chunksDrawn, rs->sectionsTested,
+                             rs->occluderQuads, rs->verticesDrawn, rs->jobsPending);
+                    DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
+                    startY += lineHeight;
+                    const RenderQueueStats* qs = &g_renderQueue.stats;
+                    snprintf(info, sizeof(info), "Render queue: %d cmds  %d draw calls  %d state changes  %d shader changes  %d flushes",
+                             qs->commands, qs->drawCalls, qs->stateChanges, qs->shaderChanges, qs->flushes);
+                    DrawTextEx(g_consolaFont, info, (Vector2){10.0f, startY}, fontSize, 0.0f, textColor);
+                    startY += lineHeight;
+                    snprintf(info, sizeof(info), "Uniforms: %d uploads  %d skipped (cached)",
+                             g_fogMaterial.uploads + g_voxelMaterial.uploads + g_skyMaterial.uploads,
+                             g_fogMaterial.skipped + g_voxelMaterial.skipped + g_skyMaterial.skipped);
+                }
             } else {
                 int32_t blockCount = 0;
                 for (int32_t x = 0; x < MAP_SIZE_X; x++)
@@ -83,3 +83,17 @@ void Arc_GetFormattedDateTime(char* out, size_t outSize) {
 #endif
     out[outSize - 1] = '\0';
 }
+
+unsigned long long arc_hash_bytes(unsigned long long h, const void* data, size_t n) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+unsigned long long arc_hash_str(unsigned long long h, const char* s) {
+    if (!s) return arc_hash_bytes(h, "", 1);
+    return arc_hash_bytes(h, s, strlen(s) + 1);
+}
@@ -1,5 +1,6 @@
 #include "app/ui/arc_terminal/login.h"
 #include "app/ui/arc_terminal/arc_render.h"
+#include "app/ui/arc_terminal/arc_utils.h"
 #include <raylib.h>
 #include <math.h>
 
@@ -31,3 +32,12 @@ void Arc_Login_Render(ArcLoginRenderContext* ctx, Font font) {
         Arc_DrawShellText(font, errorMsg, (ctx->screenW - errorSize.x) / 2.0f, loginBox.y + boxHeight + 15, 16, WHITE);
     }
 }
+
+unsigned long long Arc_Login_RenderSignature(const ArcLoginRenderContext* ctx) {
+    if (!ctx) return ARC_HASH_SEED;
+    int blink = (int)(GetTime() * 2) % 2;
+    int error = ctx->authError ? 1 : 0;
+    unsigned long long h = arc_hash_str(ARC_HASH_SEED, ctx->username);
+    h = arc_hash_bytes(h, &blink, sizeof(blink));
+    return arc_hash_bytes(h, &error, sizeof(error));
+}
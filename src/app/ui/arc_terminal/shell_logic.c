@@ -35,6 +35,7 @@ static void shell_add_to_terminal(ArcShellContext* s, const char* text) {
         memcpy(s->terminalHistory[MAX_LINES - 1], text, len);
         s->terminalHistory[MAX_LINES - 1][len] = '\0';
     }
+    s->historyVersion++;
 }
 
 static void shell_add_to_log(ArcShellContext* s, const char* text) {
@@ -50,6 +51,7 @@ static void shell_add_to_log(ArcShellContext* s, const char* text) {
         memcpy(s->logHistory[MAX_LOG_LINES - 1], text, len);
         s->logHistory[MAX_LOG_LINES - 1][len] = '\0';
     }
+    s->historyVersion++;
 }
 
 static void shell_push_cmd_history(ArcShellContext* s, const char* cmd) {
@@ -305,6 +307,7 @@ void Arc_Shell_Destroy(ArcShellContext* s) {
 void Arc_Shell_Reset(ArcShellContext* s, const char* username) {
     if (!s) return;
     s->lineCount = 0;
+    s->historyVersion++;
     s->command_str[0] = '\0';
     s->shellLetterCount = 0;
     s->logCount = 0;
@@ -446,6 +449,12 @@ void Arc_Shell_Update(ArcShellContext* s, float screenW, float screenH,
             }
         }
 
+        /* Cabeçalho das operações: avança aqui, o render pode ser pulado */
+        if (s->navSelected == 0 && !s->openAirlockSwitchActive && s->landingHeaderTypewriter < 1.2f) {
+            s->landingHeaderTypewriter += dt;
+            if (s->landingHeaderTypewriter > 1.2f) s->landingHeaderTypewriter = 1.2f;
+        }
+
         if (s->emergencyConfirming) {
             s->emergencyConfirmTimer -= dt;
             if (s->emergencyConfirmTimer < 0) s->emergencyConfirmTimer = 0;
@@ -576,6 +585,7 @@ void Arc_Shell_ProcessKey(ArcShellContext* s, int key,
     if (key == KEY_ENTER && s->shellLetterCount > 0) {
         if (strcmp(s->command_str, "clear") == 0) {
             s->lineCount = 0;
+            s->historyVersion++;
         } else {
             shell_add_to_terminal(s, TextFormat("%s@ARC_Shell> %s", username ? username : "operator", s->command_str));
             shell_push_cmd_history(s, s->command_str);
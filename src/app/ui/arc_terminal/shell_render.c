@@ -36,28 +36,33 @@ static int get_landing_bracket(const ArcShellContext* s, int step) {
     return -1;
 }
 
-void Arc_Shell_Render(ArcShellContext* s, Font font, Texture2D logo, bool logoOk,
-    const char* username, const char* cpuName, unsigned long long totalRam,
-    float screenW, float screenH) {
-    if (!s) return;
-
-    float dividerY = screenH * (ARC_DIVIDER_Y_OFFSET / 1080.0f);
-    float menuDividerX = screenW - 375.0f;
-    float wikiDividerX = 40.0f + 300.0f;
-    float lineSpacing = 30.0f;
-    float emergencyDividerX = menuDividerX - ARC_EMERGENCY_PANEL_WIDTH;
-
+void Arc_Shell_RenderStatic(Texture2D logo, bool logoOk, float screenW, float screenH) {
     if (logoOk && logo.id != 0) {
         float wm = 0.8f;
         float ww = (float)logo.width * wm, wh = (float)logo.height * wm;
         DrawTextureEx(logo, (Vector2){(screenW - ww) / 2, (screenH - wh) / 2}, 0, wm, (Color){255, 255, 255, 30});
     }
+    DrawRectangleLinesEx((Rectangle){20, 20, screenW - 40, screenH - 40}, 2, ARC_COLOR_GREEN);
+}
 
+static bool airlock_screen(const ArcShellContext* s) {
+    return s->currentMode == ARC_MODE_NAVIGATION && s->openAirlockSwitchActive;
+}
+
+static void render_clock(const ArcShellContext* s, Font font) {
+    if (airlock_screen(s)) return; /* Tela preta da troca automática cobre o relógio */
     char dateTimeStr[32];
     Arc_GetFormattedDateTime(dateTimeStr, sizeof(dateTimeStr));
     Arc_DrawShellText(font, dateTimeStr, 40, 50, 16, WHITE);
+}
+
+static void render_body(const ArcShellContext* s, Font font, float screenW, float screenH) {
+    float dividerY = screenH * (ARC_DIVIDER_Y_OFFSET / 1080.0f);
+    float menuDividerX = screenW - 375.0f;
+    float wikiDividerX = 40.0f + 300.0f;
+    float lineSpacing = 30.0f;
+    float emergencyDividerX = menuDividerX - ARC_EMERGENCY_PANEL_WIDTH;
 
-    DrawRectangleLinesEx((Rectangle){20, 20, screenW - 40, screenH - 40}, 2, ARC_COLOR_GREEN);
     const char* header = Arc_GetModeTitle(s->currentMode);
     Vector2 headerSize = MeasureTextEx(font, header, 25, 2);
     Arc_DrawShellText(font, header, (screenW - headerSize.x) / 2, 35, 25, ARC_COLOR_GREEN);
@@ -298,8 +303,6 @@ void Arc_Shell_Render(ArcShellContext* s, Font font, Texture2D logo, bool logoOk
                 char navOpsTitle[256];
                 snprintf(navOpsTitle, sizeof(navOpsTitle), "PRIORITY NAVIGATION OPERATIONS | [ %s ]", missionName);
                 float twDur = 1.2f;
-                if (s->landingHeaderTypewriter < twDur) s->landingHeaderTypewriter += GetFrameTime();
-                if (s->landingHeaderTypewriter > twDur) s->landingHeaderTypewriter = twDur;
                 int twLen = (int)((s->landingHeaderTypewriter / twDur) * strlen(navOpsTitle));
                 if (twLen > (int)strlen(navOpsTitle)) twLen = (int)strlen(navOpsTitle);
                 char twBuf[256];
@@ -460,13 +463,16 @@ void Arc_Shell_Render(ArcShellContext* s, Font font, Texture2D logo, bool logoOk
         Arc_DrawShellText(font, "Use 'switch -t /priority-manage' para retornar", screenW/2 - 250, screenH/2 + 20, 18, WHITE);
     }
 
+    if (s->suggestionCount > 0 && s->suggestionLine[0] && s->currentMode != ARC_MODE_NAVIGATION)
+        Arc_DrawShellText(font, s->suggestionLine, 40, screenH - 105, 18, (Color){120, 255, 120, 255});
+}
+
+static void render_prompt(const ArcShellContext* s, Font font, const char* username, float screenW, float screenH) {
     DrawLineEx((Vector2){40, screenH - 75}, (Vector2){screenW - 40, screenH - 75}, 1, ARC_COLOR_GREEN);
     char prompt[128];
     snprintf(prompt, sizeof(prompt), "%s@ARC_Shell>", username && username[0] ? username : "operator");
     Arc_DrawShellText(font, prompt, 40, screenH - 60, 25, ARC_COLOR_GREEN);
     float pw = MeasureTextEx(font, prompt, 25, 2).x + 10;
-    if (s->suggestionCount > 0 && s->suggestionLine[0] && s->currentMode != ARC_MODE_NAVIGATION)
-        Arc_DrawShellText(font, s->suggestionLine, 40, screenH - 105, 18, (Color){120, 255, 120, 255});
     BeginScissorMode((int)(40 + pw), (int)(screenH - 75), (int)(screenW - pw - 80), 50);
     Arc_DrawShellText(font, s->command_str, 40 + pw, screenH - 60, 25, ARC_COLOR_GREEN);
     if ((int)(GetTime() * 2) % 2 == 0) {
@@ -474,7 +480,127 @@ void Arc_Shell_Render(ArcShellContext* s, Font font, Texture2D logo, bool logoOk
         DrawRectangle((int)(40 + pw + cw + 2), (int)(screenH - 58), 12, 22, ARC_COLOR_GREEN);
     }
     EndScissorMode();
+}
+
+Rectangle Arc_Shell_RegionRect(ArcShellRegion region, float screenW, float screenH) {
+    switch (region) {
+        case ARC_SHELL_REGION_CLOCK:  return (Rectangle){ 30, 44, 300, 28 };
+        case ARC_SHELL_REGION_PROMPT: return (Rectangle){ 22, screenH - 74, screenW - 44, 52 };
+        default:                      return (Rectangle){ 0, 0, screenW, screenH };
+    }
+}
+
+void Arc_Shell_RenderRegion(const ArcShellContext* s, ArcShellRegion region, Font font,
+    const char* username, float screenW, float screenH) {
+    if (!s) return;
+    switch (region) {
+        case ARC_SHELL_REGION_CLOCK:  render_clock(s, font); break;
+        case ARC_SHELL_REGION_BODY:   render_body(s, font, screenW, screenH); break;
+        case ARC_SHELL_REGION_PROMPT: render_prompt(s, font, username, screenW, screenH); break;
+        default: break;
+    }
+}
+
+/* Assinaturas: só entra o que muda o desenho. Animações por tempo entram pela fase
+ * (pontos 4x/s, cursor 2x/s, segmentos da barra), não pelo relógio cru. */
+static unsigned long long hash_int(unsigned long long h, int v) {
+    return arc_hash_bytes(h, &v, sizeof(v));
+}
+
+static int dots_phase(void) {
+    return (int)((float)GetTime() * 4) % 4;
+}
+
+static unsigned long long sign_navigation(const ArcShellContext* s, unsigned long long h) {
+    h = hash_int(h, s->openAirlockSwitchActive);
+    if (s->openAirlockSwitchActive) return hash_int(h, dots_phase());
+
+    h = hash_int(h, s->navSelected);
+    h = hash_int(h, s->planetSelected);
+    h = hash_int(h, s->missionSelected);
+    h = hash_int(h, s->missionClicked);
+    h = arc_hash_bytes(h, &s->wikiScroll, sizeof(s->wikiScroll));
+    float tw = s->typewriterTimer < s->typewriterDuration ? s->typewriterTimer : s->typewriterDuration;
+    h = arc_hash_bytes(h, &tw, sizeof(tw));
+    if (s->navSelected != 0) return h;
+
+    ClimateData clim = GetClimateData(s->planetSelected);
+    ClimateVisualState vis = GetClimateVisualState(s->planetSelected);
+    char values[64];
+    snprintf(values, sizeof(values), "%.0f|%.1f|%d|%d", clim.temperature, clim.gravity, clim.riskLevel, clim.anomalyIndex);
+    h = arc_hash_str(h, values);
+    /* Textos do clima são literais estáticos: o ponteiro identifica o valor */
+    const char* texts[] = { clim.envType, clim.status, clim.recommendedLoad, clim.notes,
+                            clim.resources, clim.anomalies, clim.weather, clim.atmosphere };
+    h = arc_hash_bytes(h, texts, sizeof(texts));
+    int updating = vis.weatherUpdating | vis.riskLevelUpdating | vis.statusUpdating | vis.temperatureUpdating;
+    h = hash_int(h, vis.weatherUpdating);
+    h = hash_int(h, vis.riskLevelUpdating);
+    h = hash_int(h, vis.statusUpdating);
+    h = hash_int(h, vis.temperatureUpdating);
+
+    float now = (float)GetTime();
+    int wikiLoad = (s->landingLoadingStep == 1 && now - s->deployScannersWikiStart < 3.0f);
+    h = hash_int(h, wikiLoad);
+    h = arc_hash_bytes(h, s->landingDone, sizeof(s->landingDone));
+    h = hash_int(h, s->landingStepSelected);
+    h = hash_int(h, s->landingLoadingStep);
+    if (s->landingLoadingStep >= 0) {
+        int filled = (int)((now - s->landingLoadingStart) / 3.0f * BAR_SEGMENTS);
+        h = hash_int(h, filled < BAR_SEGMENTS ? filled : BAR_SEGMENTS);
+    }
+    h = hash_int(h, (s->landingShowDoneForStep >= 0 && now < s->landingShowDoneUntil) ? s->landingShowDoneForStep : -1);
+    h = hash_int(h, s->mapUpdating);
+    h = hash_int(h, s->locationLandUpdating);
+    h = hash_int(h, s->doorsOpenUpdating);
+    h = hash_int(h, s->landingEmergencySelected);
+    h = arc_hash_bytes(h, &s->landingHeaderTypewriter, sizeof(s->landingHeaderTypewriter));
+    if (wikiLoad || updating || s->mapUpdating || s->locationLandUpdating || s->doorsOpenUpdating)
+        h = hash_int(h, dots_phase());
+    return h;
+}
 
+unsigned long long Arc_Shell_RegionSignature(const ArcShellContext* s, ArcShellRegion region,
+    const char* username) {
+    unsigned long long h = arc_hash_bytes(ARC_HASH_SEED, &region, sizeof(region));
+    if (!s) return h;
+    switch (region) {
+        case ARC_SHELL_REGION_CLOCK: {
+            char dateTimeStr[32];
+            Arc_GetFormattedDateTime(dateTimeStr, sizeof(dateTimeStr));
+            h = hash_int(h, airlock_screen(s));
+            return arc_hash_str(h, dateTimeStr);
+        }
+        case ARC_SHELL_REGION_PROMPT:
+            h = arc_hash_str(h, username);
+            h = arc_hash_str(h, s->command_str);
+            return hash_int(h, (int)(GetTime() * 2) % 2);
+        case ARC_SHELL_REGION_BODY:
+            h = hash_int(h, (int)s->currentMode);
+            h = arc_hash_str(h, s->suggestionCount > 0 ? s->suggestionLine : "");
+            if (s->currentMode == ARC_MODE_PRIORITY_MANAGE) {
+                h = hash_int(h, s->menuSelected);
+                h = arc_hash_bytes(h, &s->historyVersion, sizeof(s->historyVersion));
+                h = hash_int(h, s->lineCount);
+                h = hash_int(h, s->logCount);
+                h = hash_int(h, s->logScroll);
+            } else if (s->currentMode == ARC_MODE_NAVIGATION) {
+                h = sign_navigation(s, h);
+            }
+            return h;
+        default:
+            return h;
+    }
+}
+
+void Arc_Shell_Render(ArcShellContext* s, Font font, Texture2D logo, bool logoOk,
+    const char* username, const char* cpuName, unsigned long long totalRam,
+    float screenW, float screenH) {
+    if (!s) return;
+    Arc_Shell_RenderStatic(logo, logoOk, screenW, screenH);
+    render_body(s, font, screenW, screenH);
+    render_clock(s, font);
+    render_prompt(s, font, username, screenW, screenH);
     (void)cpuName;
     (void)totalRam;
 }
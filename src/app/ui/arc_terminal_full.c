@@ -14,6 +14,9 @@
 #include <string.h>
 #include <stdio.h>
 #include <raylib.h>
+#if defined(USE_RLGL)
+#include <rlgl.h>
+#endif
 
 #define ARC_W 1600
 #define ARC_H 920
@@ -58,6 +61,12 @@ struct ArcTerminalFull {
     char cpuName[256];
     unsigned long long totalRam;
     ArcShellContext* shell;
+    /* Redesenho sob demanda: o alvo só é tocado quando uma assinatura muda */
+    RenderTexture2D staticLayer;        /* Marca d'água + moldura do shell, feita uma vez */
+    bool staticReady;
+    bool drawnValid;                    /* false: próximo desenho é completo */
+    ArcTerminalState drawnState;
+    unsigned long long drawnSig[ARC_SHELL_REGION_COUNT];
 };
 
 ArcTerminalFull* ArcTerminalFull_Create(void) {
@@ -69,6 +78,12 @@ ArcTerminalFull* ArcTerminalFull_Create(void) {
         free(t);
         return NULL;
     }
+    t->staticLayer = LoadRenderTexture(ARC_W, ARC_H);
+    if (!t->staticLayer.id || !IsRenderTextureValid(t->staticLayer)) {
+        UnloadRenderTexture(t->target);
+        free(t);
+        return NULL;
+    }
 
     arc_get_cpu_name(t->cpuName);
     t->totalRam = arc_get_total_ram();
@@ -93,6 +108,7 @@ ArcTerminalFull* ArcTerminalFull_Create(void) {
     t->shell = Arc_Shell_Create();
     if (!t->shell) {
         if (t->target.id) UnloadRenderTexture(t->target);
+        if (t->staticLayer.id) UnloadRenderTexture(t->staticLayer);
         if (t->fontOk && t->font.texture.id) UnloadFont(t->font);
         if (t->logoOk && t->logo.id) UnloadTexture(t->logo);
         free(t);
@@ -106,6 +122,7 @@ void ArcTerminalFull_Destroy(ArcTerminalFull* t) {
     if (!t) return;
     if (t->shell) Arc_Shell_Destroy(t->shell);
     if (t->target.id) UnloadRenderTexture(t->target);
+    if (t->staticLayer.id) UnloadRenderTexture(t->staticLayer);
     if (t->fontOk && t->font.texture.id) UnloadFont(t->font);
     if (t->logoOk && t->logo.id) UnloadTexture(t->logo);
     free(t);
@@ -130,6 +147,7 @@ void ArcTerminalFull_Open(ArcTerminalFull* t) {
     t->loadCompleteTimer = 0;
     t->loadDone = false;
     t->loadDotsTimer = 0;
+    t->drawnValid = false;
     Arc_Shell_Reset(t->shell, t->username);
 }
 
@@ -254,20 +272,83 @@ void ArcTerminalFull_Update(ArcTerminalFull* t, float dt) {
     }
 }
 
+/* Copia um retângulo da camada fixa para o alvo, substituindo (não mistura) o que havia */
+static void RestoreStatic(ArcTerminalFull* t, Rectangle r) {
+    Rectangle src = { r.x, (float)ARC_H - r.y - r.height, r.width, -r.height };
+#if defined(USE_RLGL)
+    rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+#endif
+    DrawTextureRec(t->staticLayer.texture, src, (Vector2){ r.x, r.y }, WHITE);
+#if defined(USE_RLGL)
+    EndBlendMode();
+#endif
+}
+
+static void RenderShell(ArcTerminalFull* t) {
+    bool full = !t->drawnValid || t->drawnState != ARC_STATE_SHELL;
+    bool dirty[ARC_SHELL_REGION_COUNT];
+    for (int r = 0; r < ARC_SHELL_REGION_COUNT; r++) {
+        unsigned long long sig = Arc_Shell_RegionSignature(t->shell, (ArcShellRegion)r, t->username);
+        dirty[r] = full || sig != t->drawnSig[r];
+        t->drawnSig[r] = sig;
+    }
+    if (dirty[ARC_SHELL_REGION_BODY]) full = true;
+    if (!full && !dirty[ARC_SHELL_REGION_CLOCK] && !dirty[ARC_SHELL_REGION_PROMPT]) return;
+
+    if (!t->staticReady) {
+        BeginTextureMode(t->staticLayer);
+        ClearBackground(BLACK);
+        Arc_Shell_RenderStatic(t->logo, t->logoOk, (float)ARC_W, (float)ARC_H);
+        EndTextureMode();
+        t->staticReady = true;
+    }
+
+    BeginTextureMode(t->target);
+    if (full) {
+        RestoreStatic(t, (Rectangle){ 0, 0, (float)ARC_W, (float)ARC_H });
+        for (int r = 0; r < ARC_SHELL_REGION_COUNT; r++)
+            Arc_Shell_RenderRegion(t->shell, (ArcShellRegion)r, t->font, t->username, (float)ARC_W, (float)ARC_H);
+    } else {
+        for (int r = ARC_SHELL_REGION_BODY + 1; r < ARC_SHELL_REGION_COUNT; r++) {
+            if (!dirty[r]) continue;
+            RestoreStatic(t, Arc_Shell_RegionRect((ArcShellRegion)r, (float)ARC_W, (float)ARC_H));
+            Arc_Shell_RenderRegion(t->shell, (ArcShellRegion)r, t->font, t->username, (float)ARC_W, (float)ARC_H);
+        }
+    }
+    EndTextureMode();
+    t->drawnState = ARC_STATE_SHELL;
+    t->drawnValid = true;
+}
+
 void ArcTerminalFull_Render(ArcTerminalFull* t) {
     if (!t || !t->open || !t->target.id) return;
 
+    if (t->state == ARC_STATE_SHELL) {
+        RenderShell(t);
+        return;
+    }
+
+    ArcLoginRenderContext loginCtx = {
+        t->username, t->loginLen, t->authError,
+        (float)ARC_W, (float)ARC_H
+    };
+    if (t->state == ARC_STATE_LOGIN) {
+        unsigned long long sig = Arc_Login_RenderSignature(&loginCtx);
+        if (t->drawnValid && t->drawnState == ARC_STATE_LOGIN && sig == t->drawnSig[0]) return;
+        t->drawnSig[0] = sig;
+    }
+    /* Boot e loading são animados e curtos: redesenham todo frame */
+    t->drawnState = t->state;
+    t->drawnValid = true;
+
     BeginTextureMode(t->target);
     ClearBackground(BLACK);
 
     if (t->state == ARC_STATE_BOOT) {
         Arc_Boot_Render(t->bootTimer, t->cpuName, t->totalRam, t->font);
     } else if (t->state == ARC_STATE_LOGIN) {
-        ArcLoginRenderContext ctx = {
-            t->username, t->loginLen, t->authError,
-            (float)ARC_W, (float)ARC_H
-        };
-        Arc_Login_Render(&ctx, t->font);
+        Arc_Login_Render(&loginCtx, t->font);
     } else if (t->state == ARC_STATE_LOADING) {
         if (t->blackTimer >= 3.0f) {
             float logoScale = 0.5f;
@@ -291,10 +372,6 @@ void ArcTerminalFull_Render(ArcTerminalFull* t) {
             Vector2 lts = MeasureTextEx(t->font, loadTxt, 18, 1);
             Arc_DrawShellText(t->font, loadTxt, (ARC_W - lts.x) / 2, barY + barH + 20, 18, ARC_COLOR_GREEN);
         }
-    } else if (t->state == ARC_STATE_SHELL) {
-        Arc_Shell_Render(t->shell, t->font, t->logo, t->logoOk,
-            t->username, t->cpuName, t->totalRam,
-            (float)ARC_W, (float)ARC_H);
     }
 
     EndTextureMode();
@@ -146,6 +146,13 @@ void SciFiTerminal_ExecuteCommand(SciFiTerminal* terminal, const char* command,
                 loadedChunks, generatingChunks);
         SciFiTerminal_AddOutput(terminal, output);
         
+        int32_t referencedSections = 0, storedSections = 0;
+        float dedupRatio = 1.0f;
+        VoxelWorld_GetSectionStats(&referencedSections, &storedSections, &dedupRatio);
+        snprintf(output, sizeof(output), "> Sections: %d stored / %d referenced (dedup %.1fx)",
+                storedSections, referencedSections, dedupRatio);
+        SciFiTerminal_AddOutput(terminal, output);
+        
         if (checkpoints) {
             snprintf(output, sizeof(output), "> Checkpoints: %d active", checkpoints->count);
             SciFiTerminal_AddOutput(terminal, output);
@@ -0,0 +1,169 @@
+// ============================================================================
+// CHUNK_CODEC_BENCH.C - BENCHMARK DO CODEC DE CHUNKS
+// ============================================================================
+// Gera chunks do corredor (mesmo gerador do streaming), codifica e decodifica.
+// Reporta MB/s (sobre o tamanho do chunk em memória) e taxa de compressão.
+// Também valida o round-trip e o modo incremental (buffer pequeno).
+// Uso: bench_chunk_codec.exe [nº de chunks] [repetições]
+// ============================================================================
+
+#include "core/world/chunk.h"
+#include "core/world/chunk_codec.h"
+#include "core/world/voxel_world.h"
+#include "core/world/world_seed.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/time.h"
+
+#define BENCH_DEFAULT_CHUNKS   64
+#define BENCH_DEFAULT_REPEATS  20
+#define BENCH_STREAM_BUFFER    4096   /* buffer pequeno: força encode/decode incremental */
+
+/* Compara campo a campo (Voxel tem padding; memcmp não serve). */
+static bool SameBlocks(const Chunk* a, const Chunk* b) {
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        const Voxel* va = Chunk_GetSectionVoxels(a, s);
+        const Voxel* vb = Chunk_GetSectionVoxels(b, s);
+        for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+            if (va[i].type != vb[i].type || va[i].metadata != vb[i].metadata) return false;
+        }
+    }
+    return true;
+}
+
+/* Suja o chunk inteiro para garantir que o decoder escreve tudo. */
+static void PoisonChunk(Chunk* chunk) {
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        Voxel* blocks = Chunk_GetSectionMut(chunk, s);
+        if (blocks) memset(blocks, 0xCD, CHUNK_SECTION_VOLUME * sizeof(Voxel));
+    }
+}
+
+int main(int argc, char** argv) {
+    int chunkCount = (argc > 1) ? atoi(argv[1]) : BENCH_DEFAULT_CHUNKS;
+    int repeats = (argc > 2) ? atoi(argv[2]) : BENCH_DEFAULT_REPEATS;
+    if (chunkCount < 1) chunkCount = 1;
+    if (repeats < 1) repeats = 1;
+
+    printf("========================================\n");
+    printf("BENCHMARK - CHUNK CODEC v%d\n", CHUNK_CODEC_VERSION);
+    printf("========================================\n");
+
+    Time_Init();
+    VoxelWorld* world = VoxelWorld_Create("beware-the-dust");
+    Chunk** chunks = (Chunk**)calloc((size_t)chunkCount, sizeof(Chunk*));
+    uint8_t* encoded = (uint8_t*)malloc(CHUNK_CODEC_MAX_ENCODED_SIZE);
+    size_t* encodedSizes = (size_t*)calloc((size_t)chunkCount, sizeof(size_t));
+    uint8_t** blobs = (uint8_t**)calloc((size_t)chunkCount, sizeof(uint8_t*));
+    Chunk* scratch = Chunk_Create(0, 0, 0);
+    if (!world || !chunks || !encoded || !encodedSizes || !blobs || !scratch) {
+        fprintf(stderr, "Sem memoria para o benchmark\n");
+        return 1;
+    }
+
+    /* Chunks do corredor: faixa central, avançando em Z (zonas diferentes). */
+    for (int i = 0; i < chunkCount; i++) {
+        int32_t vx = (i % 16) - 8;
+        int32_t vz = (i / 16) * 7;
+        chunks[i] = Chunk_Create(vx, vz, WorldSeed_GetChunkSeed(VoxelWorld_GetSeedU64(world), vx, vz));
+        if (!chunks[i]) {
+            fprintf(stderr, "Falha ao criar chunk %d\n", i);
+            return 1;
+        }
+        ChunkGenContext ctx;
+        VoxelWorld_BuildGenContext(world, vx, vz, &ctx);
+        VoxelWorld_GenerateChunk(world, chunks[i], &ctx);
+    }
+
+    /* Tamanhos e cópias codificadas (para medir decode separado). */
+    size_t totalEncoded = 0;
+    for (int i = 0; i < chunkCount; i++) {
+        size_t size = 0;
+        if (ChunkCodec_EncodeToBuffer(chunks[i], encoded, CHUNK_CODEC_MAX_ENCODED_SIZE, &size) != CHUNK_CODEC_OK) {
+            fprintf(stderr, "Encode falhou no chunk %d\n", i);
+            return 1;
+        }
+        blobs[i] = (uint8_t*)malloc(size);
+        memcpy(blobs[i], encoded, size);
+        encodedSizes[i] = size;
+        totalEncoded += size;
+    }
+
+    /* Round-trip: one-shot e incremental. */
+    int failures = 0;
+    for (int i = 0; i < chunkCount; i++) {
+        PoisonChunk(scratch);
+        if (ChunkCodec_DecodeFromBuffer(scratch, blobs[i], encodedSizes[i]) != CHUNK_CODEC_OK ||
+            !SameBlocks(scratch, chunks[i]) ||
+            scratch->chunkX != chunks[i]->chunkX || scratch->chunkZ != chunks[i]->chunkZ) {
+            failures++;
+            continue;
+        }
+
+        ChunkEncoder enc;
+        ChunkDecoder dec;
+        uint8_t window[BENCH_STREAM_BUFFER];
+        ChunkEncoder_Begin(&enc, chunks[i]);
+        ChunkDecoder_Begin(&dec, scratch);
+        ChunkCodecResult er, dr = CHUNK_CODEC_NEED_INPUT;
+        do {
+            size_t produced = 0, consumed = 0;
+            er = ChunkEncoder_Encode(&enc, window, 7, &produced); /* 7 bytes: corta varints no meio */
+            dr = ChunkDecoder_Decode(&dec, window, produced, &consumed);
+        } while (er == CHUNK_CODEC_NEED_OUTPUT && dr == CHUNK_CODEC_NEED_INPUT);
+        if (er != CHUNK_CODEC_OK || dr != CHUNK_CODEC_OK ||
+            !SameBlocks(scratch, chunks[i])) {
+            failures++;
+        }
+    }
+
+    /* Encode: buffer de 4 KB (incremental, caminho real de rede/disco). */
+    const double rawBytes = (double)chunkCount * (double)(CHUNK_VOLUME * sizeof(Voxel)) * (double)repeats;
+    double t0 = Time_GetSeconds();
+    size_t sink = 0;
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < chunkCount; i++) {
+            ChunkEncoder enc;
+            uint8_t window[BENCH_STREAM_BUFFER];
+            size_t produced = 0;
+            ChunkEncoder_Begin(&enc, chunks[i]);
+            while (ChunkEncoder_Encode(&enc, window, sizeof(window), &produced) == CHUNK_CODEC_NEED_OUTPUT) {
+                sink += produced;
+            }
+            sink += produced;
+        }
+    }
+    double encodeSeconds = Time_GetSeconds() - t0;
+
+    /* Decode direto no chunk (buffer inteiro em memória). */
+    t0 = Time_GetSeconds();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < chunkCount; i++) {
+            ChunkCodec_DecodeFromBuffer(scratch, blobs[i], encodedSizes[i]);
+        }
+    }
+    double decodeSeconds = Time_GetSeconds() - t0;
+
+    double rawPerChunk = (double)(CHUNK_VOLUME * sizeof(Voxel));
+    printf("Chunks: %d  Repeticoes: %d\n", chunkCount, repeats);
+    printf("Tamanho em memoria: %.0f KB/chunk\n", rawPerChunk / 1024.0);
+    printf("Codificado (medio): %.1f bytes/chunk\n", (double)totalEncoded / (double)chunkCount);
+    printf("Compressao: %.1fx\n", rawPerChunk * (double)chunkCount / (double)totalEncoded);
+    printf("Encode: %.1f MB/s (%.3f s)\n", encodeSeconds > 0.0 ? rawBytes / (1024.0 * 1024.0) / encodeSeconds : 0.0, encodeSeconds);
+    printf("Decode: %.1f MB/s (%.3f s)\n", decodeSeconds > 0.0 ? rawBytes / (1024.0 * 1024.0) / decodeSeconds : 0.0, decodeSeconds);
+    printf("Round-trip: %s (%d falhas)\n", failures == 0 ? "OK" : "FALHOU", failures);
+    printf("(bytes emitidos: %zu)\n", sink);
+
+    for (int i = 0; i < chunkCount; i++) {
+        free(blobs[i]);
+        Chunk_Destroy(chunks[i]);
+    }
+    Chunk_Destroy(scratch);
+    free(blobs);
+    free(encodedSizes);
+    free(encoded);
+    free(chunks);
+    VoxelWorld_Destroy(world);
+    return failures == 0 ? 0 : 1;
+}
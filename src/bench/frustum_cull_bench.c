@@ -0,0 +1,204 @@
+// ============================================================================
+// FRUSTUM_CULL_BENCH.C - BENCHMARK DO FRUSTUM CULLING EM LOTE
+// ============================================================================
+// Janela de chunks do VoxelRenderer (colunas com seções de 16 blocos) contra o
+// frustum de uma câmera girando no centro. Compara Frustum_IsAABBInside caixa a
+// caixa, o lote escalar e o lote SIMD (SSE; AVX se compilado com -mavx), e o
+// culling hierárquico (colunas, depois seções só das colunas na borda).
+// Também confere que todos os caminhos dão a mesma máscara.
+// Uso: bench_frustum_cull.exe [raio em chunks] [repetições]
+// ============================================================================
+
+#include "app/render/frustum.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/time.h"
+
+#define BENCH_DEFAULT_RADIUS   31
+#define BENCH_DEFAULT_REPEATS  200
+#define BENCH_CHUNK_SIZE       16
+#define BENCH_SECTION_HEIGHT   16
+#define BENCH_SECTION_COUNT    16
+#define BENCH_VIEWS            16     /* direções da câmera por repetição */
+
+/* LCG simples: alturas reproduzíveis entre execuções. */
+static uint32_t g_rng = 0x2545F491u;
+static uint32_t NextRandom(void) {
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return g_rng >> 8;
+}
+
+static void BuildViewFrustum(Frustum* frustum, int view, int radius) {
+    float yaw = (float)view * (2.0f * 3.14159265f / (float)BENCH_VIEWS);
+    float pitch = (view & 1) ? -0.35f : 0.1f;
+    Vec3 forward = Vec3_Make(sinf(yaw) * cosf(pitch), sinf(pitch), cosf(yaw) * cosf(pitch));
+    Frustum_CalculateUnclamped(frustum, Vec3_Make(0.5f, 70.0f, 0.5f), forward, Vec3_Make(0.0f, 1.0f, 0.0f),
+                               70.0f * 3.14159265f / 180.0f, 16.0f / 9.0f, 0.05f,
+                               (float)(radius + 1) * BENCH_CHUNK_SIZE);
+}
+
+static int CompareMasks(const uint32_t* a, const uint32_t* b, int32_t count) {
+    int mismatches = 0;
+    for (int32_t i = 0; i < count; i++) {
+        if (Frustum_MaskTest(a, i) != Frustum_MaskTest(b, i)) mismatches++;
+    }
+    return mismatches;
+}
+
+static void PrintRate(const char* label, double seconds, double boxes, double baseline) {
+    double nsPerBox = boxes > 0.0 ? seconds * 1e9 / boxes : 0.0;
+    printf("%-28s %7.2f ns/caixa  %8.1f Mcaixas/s", label, nsPerBox, seconds > 0.0 ? boxes / seconds / 1e6 : 0.0);
+    if (baseline > 0.0 && seconds > 0.0) printf("  %5.2fx", baseline / seconds);
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    int radius = (argc > 1) ? atoi(argv[1]) : BENCH_DEFAULT_RADIUS;
+    int repeats = (argc > 2) ? atoi(argv[2]) : BENCH_DEFAULT_REPEATS;
+    if (radius < 1) radius = 1;
+    if (repeats < 1) repeats = 1;
+
+    printf("========================================\n");
+    printf("BENCHMARK - FRUSTUM CULLING EM LOTE (%s)\n", Frustum_BatchPathName());
+    printf("========================================\n");
+
+    int32_t side = radius * 2 + 1;
+    int32_t columnCount = side * side;
+    int32_t maxSections = columnCount * BENCH_SECTION_COUNT;
+
+    FrustumAABBBatch columns, sections, borderSections;
+    uint16_t* sectionMasks = (uint16_t*)malloc((size_t)columnCount * sizeof(uint16_t));
+    uint32_t* maskA = (uint32_t*)malloc((size_t)FRUSTUM_MASK_WORDS(maxSections) * sizeof(uint32_t));
+    uint32_t* maskB = (uint32_t*)malloc((size_t)FRUSTUM_MASK_WORDS(maxSections) * sizeof(uint32_t));
+    uint32_t* inside = (uint32_t*)malloc((size_t)FRUSTUM_MASK_WORDS(columnCount) * sizeof(uint32_t));
+    if (!FrustumAABBBatch_Init(&columns, columnCount) || !FrustumAABBBatch_Init(&sections, maxSections) ||
+        !FrustumAABBBatch_Init(&borderSections, maxSections) || !sectionMasks || !maskA || !maskB || !inside) {
+        fprintf(stderr, "Sem memoria para o benchmark\n");
+        return 1;
+    }
+
+    /* Colunas com terreno entre 32 e 96 e, às vezes, uma torre isolada lá em cima. */
+    Time_Init();
+    for (int32_t z = -radius; z <= radius; z++) {
+        for (int32_t x = -radius; x <= radius; x++) {
+            int32_t top = 2 + (int32_t)(NextRandom() % 4);
+            uint16_t mask = (uint16_t)((1u << top) - 1u);
+            if (NextRandom() % 8 == 0) mask |= (uint16_t)(1u << (10 + NextRandom() % 6));
+            int32_t highest = 0;
+            for (int32_t s = 0; s < BENCH_SECTION_COUNT; s++) {
+                if (!(mask & (1u << s))) continue;
+                highest = s;
+                Vec3 min = Vec3_Make((float)(x * BENCH_CHUNK_SIZE), (float)(s * BENCH_SECTION_HEIGHT), (float)(z * BENCH_CHUNK_SIZE));
+                Vec3 max = Vec3_Make(min.x + BENCH_CHUNK_SIZE, min.y + BENCH_SECTION_HEIGHT, min.z + BENCH_CHUNK_SIZE);
+                FrustumAABBBatch_Push(&sections, min, max);
+            }
+            sectionMasks[columns.count] = mask;
+            FrustumAABBBatch_Push(&columns,
+                                  Vec3_Make((float)(x * BENCH_CHUNK_SIZE), 0.0f, (float)(z * BENCH_CHUNK_SIZE)),
+                                  Vec3_Make((float)((x + 1) * BENCH_CHUNK_SIZE), (float)((highest + 1) * BENCH_SECTION_HEIGHT),
+                                            (float)((z + 1) * BENCH_CHUNK_SIZE)));
+        }
+    }
+
+    /* Conferência: os três caminhos concordam em todas as direções. */
+    int mismatches = 0;
+    for (int view = 0; view < BENCH_VIEWS; view++) {
+        Frustum frustum;
+        BuildViewFrustum(&frustum, view, radius);
+        Frustum_CullAABBBatch(&frustum, &sections, maskA, NULL);
+        Frustum_CullAABBBatchScalar(&frustum, &sections, maskB, NULL);
+        mismatches += CompareMasks(maskA, maskB, sections.count);
+        for (int32_t i = 0; i < sections.count; i++) {
+            bool one = Frustum_IsAABBInside(&frustum,
+                                            Vec3_Make(sections.minX[i], sections.minY[i], sections.minZ[i]),
+                                            Vec3_Make(sections.maxX[i], sections.maxY[i], sections.maxZ[i]));
+            if (one != Frustum_MaskTest(maskA, i)) mismatches++;
+        }
+    }
+
+    /* 1. Caixa a caixa com Vec3 (o que o renderer fazia). */
+    double boxes = (double)sections.count * (double)repeats * BENCH_VIEWS;
+    int32_t sink = 0;
+    double t0 = Time_GetSeconds();
+    for (int r = 0; r < repeats; r++) {
+        for (int view = 0; view < BENCH_VIEWS; view++) {
+            Frustum frustum;
+            BuildViewFrustum(&frustum, view, radius);
+            for (int32_t i = 0; i < sections.count; i++) {
+                sink += Frustum_IsAABBInside(&frustum,
+                                             Vec3_Make(sections.minX[i], sections.minY[i], sections.minZ[i]),
+                                             Vec3_Make(sections.maxX[i], sections.maxY[i], sections.maxZ[i]));
+            }
+        }
+    }
+    double scalarSeconds = Time_GetSeconds() - t0;
+
+    /* 2. Lote escalar. */
+    t0 = Time_GetSeconds();
+    for (int r = 0; r < repeats; r++) {
+        for (int view = 0; view < BENCH_VIEWS; view++) {
+            Frustum frustum;
+            BuildViewFrustum(&frustum, view, radius);
+            sink += Frustum_CullAABBBatchScalar(&frustum, &sections, maskA, NULL);
+        }
+    }
+    double batchScalarSeconds = Time_GetSeconds() - t0;
+
+    /* 3. Lote SIMD. */
+    t0 = Time_GetSeconds();
+    for (int r = 0; r < repeats; r++) {
+        for (int view = 0; view < BENCH_VIEWS; view++) {
+            Frustum frustum;
+            BuildViewFrustum(&frustum, view, radius);
+            sink += Frustum_CullAABBBatch(&frustum, &sections, maskA, NULL);
+        }
+    }
+    double batchSimdSeconds = Time_GetSeconds() - t0;
+
+    /* 4. Hierárquico: colunas, depois seções das colunas que cruzam a borda. */
+    int64_t hierarchicalBoxes = 0;
+    int64_t visibleBorderSections = 0;
+    t0 = Time_GetSeconds();
+    for (int r = 0; r < repeats; r++) {
+        for (int view = 0; view < BENCH_VIEWS; view++) {
+            Frustum frustum;
+            BuildViewFrustum(&frustum, view, radius);
+            Frustum_CullAABBBatch(&frustum, &columns, maskA, inside);
+            FrustumAABBBatch_Clear(&borderSections);
+            for (int32_t i = 0; i < columns.count; i++) {
+                if (!Frustum_MaskTest(maskA, i) || Frustum_MaskTest(inside, i)) continue;
+                for (int32_t s = 0; s < BENCH_SECTION_COUNT; s++) {
+                    if (!(sectionMasks[i] & (1u << s))) continue;
+                    Vec3 min = Vec3_Make(columns.minX[i], (float)(s * BENCH_SECTION_HEIGHT), columns.minZ[i]);
+                    Vec3 max = Vec3_Make(columns.maxX[i], (float)((s + 1) * BENCH_SECTION_HEIGHT), columns.maxZ[i]);
+                    FrustumAABBBatch_Push(&borderSections, min, max);
+                }
+            }
+            int32_t visible = Frustum_CullAABBBatch(&frustum, &borderSections, maskB, NULL);
+            hierarchicalBoxes += columns.count + borderSections.count;
+            visibleBorderSections += visible;
+        }
+    }
+    double hierarchicalSeconds = Time_GetSeconds() - t0;
+
+    printf("Colunas: %d  Secoes: %d  Direcoes: %d  Repeticoes: %d\n", columnCount, sections.count, BENCH_VIEWS, repeats);
+    PrintRate("Frustum_IsAABBInside", scalarSeconds, boxes, 0.0);
+    PrintRate("Lote escalar (SoA)", batchScalarSeconds, boxes, scalarSeconds);
+    PrintRate("Lote SIMD (SoA)", batchSimdSeconds, boxes, scalarSeconds);
+    printf("Hierarquico: %.1f caixas testadas por frame (de %d secoes)  %.2f us/frame  %.2fx\n",
+           (double)hierarchicalBoxes / ((double)repeats * BENCH_VIEWS), sections.count,
+           hierarchicalSeconds * 1e6 / ((double)repeats * BENCH_VIEWS),
+           hierarchicalSeconds > 0.0 ? scalarSeconds / hierarchicalSeconds : 0.0);
+    printf("Mascaras: %s (%d divergencias)\n", mismatches == 0 ? "OK" : "FALHOU", mismatches);
+    printf("(visiveis: %d caixas nos lotes / %lld secoes de borda no hierarquico)\n", sink, (long long)visibleBorderSections);
+
+    FrustumAABBBatch_Destroy(&columns);
+    FrustumAABBBatch_Destroy(&sections);
+    FrustumAABBBatch_Destroy(&borderSections);
+    free(sectionMasks);
+    free(maskA);
+    free(maskB);
+    free(inside);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -12,6 +12,7 @@ struct NetSystem;
 
 static bool g_initialized = false;
 static NetSystem* g_netSystem = NULL;
+static bool g_simThreaded = false;     // Atômico: SimThread chama Core_SimStep
 
 int Core_Init(void) {
     if (g_initialized) return 0;
@@ -30,13 +31,10 @@ int Core_Init(void) {
     return 0;
 }
 
-void Core_Tick(float dt) {
+static void Core_Simulate(float dt) {
     (void)dt; // Usado no futuro
-    if (!g_initialized) return;
     
-    Time_Update();
-    
-    // Poll de rede (todo frame)
+    // Poll de rede (todo frame, ou todo passo da thread de simulação)
     if (g_netSystem) {
         Net_Poll(g_netSystem);
     }
@@ -47,6 +45,25 @@ void Core_Tick(float dt) {
     }
 }
 
+void Core_Tick(float dt) {
+    if (!g_initialized) return;
+    
+    Time_Update();
+    
+    if (!__atomic_load_n(&g_simThreaded, __ATOMIC_ACQUIRE)) {
+        Core_Simulate(dt);
+    }
+}
+
+void Core_SetSimThreaded(bool threaded) {
+    __atomic_store_n(&g_simThreaded, threaded, __ATOMIC_RELEASE);
+}
+
+void Core_SimStep(float dt) {
+    if (!g_initialized) return;
+    Core_Simulate(dt);
+}
+
 void Core_Shutdown(void) {
     if (!g_initialized) return;
     
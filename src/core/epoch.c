@@ -0,0 +1,110 @@
+#include "core/epoch.h"
+#include <stdlib.h>
+
+// Esquema clássico de 3 épocas: a global só avança quando todo leitor ativo já
+// está nela; algo aposentado na época e é liberado quando a global chega a e + 2.
+
+int32_t Epoch_Enter(EpochDomain* domain) {
+    for (;;) {
+        uint64_t epoch = __atomic_load_n(&domain->globalEpoch, __ATOMIC_ACQUIRE);
+        uint64_t mark = (epoch << 1) | 1u;
+        for (int32_t i = 0; i < EPOCH_MAX_READERS; i++) {
+            uint64_t expected = 0;
+            // CAS é barreira completa: leituras da estrutura não sobem para antes do anúncio
+            if (__atomic_compare_exchange_n(&domain->readers[i], &expected, mark, false,
+                                            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                return i;
+            }
+        }
+        Thread_Yield(); // todos os slots ocupados
+    }
+}
+
+void Epoch_Exit(EpochDomain* domain, int32_t slot) {
+    if (slot < 0 || slot >= EPOCH_MAX_READERS) return;
+    __atomic_store_n(&domain->readers[slot], 0, __ATOMIC_RELEASE);
+}
+
+void Epoch_Retire(EpochDomain* domain, void* ptr, EpochFreeFunc freeFn) {
+    if (!ptr || !freeFn) return;
+
+    SpinLock_Lock(&domain->retireLock);
+    if (domain->retiredCount == domain->retiredCapacity) {
+        int32_t capacity = domain->retiredCapacity ? domain->retiredCapacity * 2 : 256;
+        EpochRetired* grown = (EpochRetired*)realloc(domain->retired, (size_t)capacity * sizeof(EpochRetired));
+        if (!grown) {
+            // Sem memória para adiar: melhor vazar que liberar com leitor ativo
+            SpinLock_Unlock(&domain->retireLock);
+            return;
+        }
+        domain->retired = grown;
+        domain->retiredCapacity = capacity;
+    }
+    EpochRetired* item = &domain->retired[domain->retiredCount++];
+    item->ptr = ptr;
+    item->freeFn = freeFn;
+    item->epoch = __atomic_load_n(&domain->globalEpoch, __ATOMIC_SEQ_CST);
+    SpinLock_Unlock(&domain->retireLock);
+}
+
+// Com retireLock: tenta avançar a época global
+static void Epoch_TryAdvance(EpochDomain* domain) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    uint64_t epoch = __atomic_load_n(&domain->globalEpoch, __ATOMIC_SEQ_CST);
+    for (int32_t i = 0; i < EPOCH_MAX_READERS; i++) {
+        uint64_t mark = __atomic_load_n(&domain->readers[i], __ATOMIC_SEQ_CST);
+        if ((mark & 1u) && (mark >> 1) != epoch) return; // leitor ainda numa época anterior
+    }
+    __atomic_store_n(&domain->globalEpoch, epoch + 1, __ATOMIC_SEQ_CST);
+}
+
+// Itens liberados por passada (cópia na pilha: coletar não aloca)
+#define EPOCH_COLLECT_BATCH 64
+
+void Epoch_Collect(EpochDomain* domain) {
+    SpinLock_Lock(&domain->retireLock);
+    Epoch_TryAdvance(domain);
+    uint64_t epoch = __atomic_load_n(&domain->globalEpoch, __ATOMIC_SEQ_CST);
+
+    for (;;) {
+        // Separa o que já é seguro; freeFn roda fora do lock (pode aposentar mais coisas,
+        // sempre na época atual: não entram nesta coleta)
+        EpochRetired ready[EPOCH_COLLECT_BATCH];
+        int32_t readyCount = 0;
+        int32_t kept = 0;
+        for (int32_t i = 0; i < domain->retiredCount; i++) {
+            if (readyCount < EPOCH_COLLECT_BATCH && domain->retired[i].epoch + 2 <= epoch) {
+                ready[readyCount++] = domain->retired[i];
+            } else {
+                domain->retired[kept++] = domain->retired[i];
+            }
+        }
+        domain->retiredCount = kept;
+        SpinLock_Unlock(&domain->retireLock);
+
+        for (int32_t i = 0; i < readyCount; i++) {
+            ready[i].freeFn(ready[i].ptr);
+        }
+        if (readyCount < EPOCH_COLLECT_BATCH) return;
+        SpinLock_Lock(&domain->retireLock);
+    }
+}
+
+void Epoch_Synchronize(EpochDomain* domain) {
+    uint64_t target = __atomic_load_n(&domain->globalEpoch, __ATOMIC_SEQ_CST) + 2;
+    for (;;) {
+        Epoch_Collect(domain);
+        if (__atomic_load_n(&domain->globalEpoch, __ATOMIC_SEQ_CST) >= target) {
+            Epoch_Collect(domain); // libera o que ficou na época de partida
+            return;
+        }
+        Thread_Yield();
+    }
+}
+
+int32_t Epoch_GetPendingCount(EpochDomain* domain) {
+    SpinLock_Lock(&domain->retireLock);
+    int32_t count = domain->retiredCount;
+    SpinLock_Unlock(&domain->retireLock);
+    return count;
+}
@@ -0,0 +1,108 @@
+#include "core/file_map.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+struct FileMap {
+    HANDLE file;
+    HANDLE mapping;
+    const uint8_t* data;
+    size_t size;
+};
+
+FileMap* FileMap_Open(const char* path) {
+    if (!path) return NULL;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) {
+        CloseHandle(file);
+        return NULL;
+    }
+    const uint8_t* data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    FileMap* map = data ? (FileMap*)calloc(1, sizeof(FileMap)) : NULL;
+    if (!map) {
+        if (data) UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return NULL;
+    }
+
+    map->file = file;
+    map->mapping = mapping;
+    map->data = data;
+    map->size = (size_t)size.QuadPart;
+    return map;
+}
+
+void FileMap_Close(FileMap* map) {
+    if (!map) return;
+    UnmapViewOfFile(map->data);
+    CloseHandle(map->mapping);
+    CloseHandle(map->file);
+    free(map);
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct FileMap {
+    const uint8_t* data;
+    size_t size;
+};
+
+FileMap* FileMap_Open(const char* path) {
+    if (!path) return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); /* o mapeamento continua válido */
+    if (data == MAP_FAILED) return NULL;
+
+    FileMap* map = (FileMap*)calloc(1, sizeof(FileMap));
+    if (!map) {
+        munmap(data, (size_t)st.st_size);
+        return NULL;
+    }
+    map->data = (const uint8_t*)data;
+    map->size = (size_t)st.st_size;
+    return map;
+}
+
+void FileMap_Close(FileMap* map) {
+    if (!map) return;
+    munmap((void*)map->data, map->size);
+    free(map);
+}
+
+#endif
+
+const uint8_t* FileMap_GetData(const FileMap* map) {
+    return map ? map->data : NULL;
+}
+
+size_t FileMap_GetSize(const FileMap* map) {
+    return map ? map->size : 0;
+}
@@ -130,12 +130,11 @@ void Ship_Draw(const Ship* s) {
 
     /* Plataforma única 5×5×1, sem rotação. */
 #if defined(USE_RLGL)
-    rlDrawRenderBatchActive();
+    /* Sem descarga: no batch a translação é aplicada nos vértices pela CPU (RenderQueue agrupa). */
     rlPushMatrix();
     rlTranslatef(s->position.x, s->position.y, s->position.z);
     DrawCube((Vector3){ 0.0f, 0.0f, 0.0f }, PLATFORM_HALF_X * 2.0f, PLATFORM_HALF_Y * 2.0f, PLATFORM_HALF_Z * 2.0f, DARKGRAY);
     rlPopMatrix();
-    rlDrawRenderBatchActive();
 #else
     DrawCube(s->position, PLATFORM_HALF_X * 2.0f, PLATFORM_HALF_Y * 2.0f, PLATFORM_HALF_Z * 2.0f, DARKGRAY);
 #endif
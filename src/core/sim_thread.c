@@ -0,0 +1,92 @@
+#include "core/sim_thread.h"
+#include "core/thread.h"
+#include "core/time.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_THREAD_SLEEP_MARGIN 0.002   // Acorda antes da hora (granularidade do Sleep) e cede o resto
+
+struct SimThread {
+    Thread* thread;
+    SimStepFunc step;
+    void* userData;
+    float stepSeconds;
+    volatile int32_t stopRequested;     // Atômico
+    SpinLock statsLock;
+    SimThreadStats stats;
+};
+
+static void SimThread_Run(void* userData) {
+    SimThread* sim = (SimThread*)userData;
+    const double step = (double)sim->stepSeconds;
+    double next = Time_GetSeconds() + step;
+
+    while (!__atomic_load_n(&sim->stopRequested, __ATOMIC_ACQUIRE)) {
+        double now = Time_GetSeconds();
+        if (now < next) {
+            double wait = next - now;
+            if (wait > SIM_THREAD_SLEEP_MARGIN) Thread_Sleep((uint32_t)((wait - SIM_THREAD_SLEEP_MARGIN) * 1000.0));
+            else Thread_Yield();
+            continue;
+        }
+
+        for (int32_t ran = 0; now >= next && ran < SIM_THREAD_MAX_CATCHUP; ran++) {
+            double begin = Time_GetSeconds();
+            sim->step(sim->userData, sim->stepSeconds, next);
+            float took = (float)(Time_GetSeconds() - begin);
+            SpinLock_Lock(&sim->statsLock);
+            sim->stats.steps++;
+            sim->stats.lastStepTime = took;
+            if (took > sim->stats.maxStepTime) sim->stats.maxStepTime = took;
+            SpinLock_Unlock(&sim->statsLock);
+            next += step;
+            now = Time_GetSeconds();
+        }
+
+        // Ainda atrasado depois da recuperação: pula para o presente
+        if (now >= next) {
+            uint64_t dropped = (uint64_t)((now - next) / step) + 1;
+            next += (double)dropped * step;
+            SpinLock_Lock(&sim->statsLock);
+            sim->stats.droppedSteps += dropped;
+            SpinLock_Unlock(&sim->statsLock);
+        }
+    }
+}
+
+SimThread* SimThread_Start(float stepSeconds, SimStepFunc step, void* userData) {
+    if (!step || stepSeconds <= 0.0f) return NULL;
+    SimThread* sim = (SimThread*)calloc(1, sizeof(SimThread));
+    if (!sim) return NULL;
+    sim->step = step;
+    sim->userData = userData;
+    sim->stepSeconds = stepSeconds;
+    sim->thread = Thread_Create(SimThread_Run, sim);
+    if (!sim->thread) {
+        free(sim);
+        return NULL;
+    }
+    return sim;
+}
+
+void SimThread_Stop(SimThread* sim) {
+    if (!sim) return;
+    __atomic_store_n(&sim->stopRequested, 1, __ATOMIC_RELEASE);
+    Thread_Join(sim->thread);
+    free(sim);
+}
+
+float SimThread_GetStep(const SimThread* sim) {
+    return sim ? sim->stepSeconds : 0.0f;
+}
+
+void SimThread_GetStats(SimThread* sim, SimThreadStats* outStats) {
+    if (!outStats) return;
+    if (!sim) {
+        memset(outStats, 0, sizeof(*outStats));
+        return;
+    }
+    SpinLock_Lock(&sim->statsLock);
+    *outStats = sim->stats;
+    SpinLock_Unlock(&sim->statsLock);
+}
@@ -0,0 +1,188 @@
+#include "core/thread.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600   /* CONDITION_VARIABLE: Vista+ */
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+struct Thread {
+    HANDLE handle;
+    ThreadFunc func;
+    void* userData;
+};
+
+struct Mutex {
+    CRITICAL_SECTION cs;
+};
+
+struct CondVar {
+    CONDITION_VARIABLE cv;
+};
+
+static DWORD WINAPI Thread_Entry(LPVOID param) {
+    Thread* thread = (Thread*)param;
+    thread->func(thread->userData);
+    return 0;
+}
+
+Thread* Thread_Create(ThreadFunc func, void* userData) {
+    if (!func) return NULL;
+    Thread* thread = (Thread*)calloc(1, sizeof(Thread));
+    if (!thread) return NULL;
+    thread->func = func;
+    thread->userData = userData;
+    thread->handle = CreateThread(NULL, 0, Thread_Entry, thread, 0, NULL);
+    if (!thread->handle) {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void Thread_Join(Thread* thread) {
+    if (!thread) return;
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    free(thread);
+}
+
+int32_t Thread_GetCpuCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int32_t)info.dwNumberOfProcessors : 1;
+}
+
+void Thread_Yield(void) {
+    SwitchToThread();
+}
+
+void Thread_Sleep(uint32_t milliseconds) {
+    Sleep(milliseconds);
+}
+
+Mutex* Mutex_Create(void) {
+    Mutex* mutex = (Mutex*)calloc(1, sizeof(Mutex));
+    if (mutex) InitializeCriticalSection(&mutex->cs);
+    return mutex;
+}
+
+void Mutex_Destroy(Mutex* mutex) {
+    if (!mutex) return;
+    DeleteCriticalSection(&mutex->cs);
+    free(mutex);
+}
+
+void Mutex_Lock(Mutex* mutex) { EnterCriticalSection(&mutex->cs); }
+void Mutex_Unlock(Mutex* mutex) { LeaveCriticalSection(&mutex->cs); }
+
+CondVar* CondVar_Create(void) {
+    CondVar* cond = (CondVar*)calloc(1, sizeof(CondVar));
+    if (cond) InitializeConditionVariable(&cond->cv);
+    return cond;
+}
+
+void CondVar_Destroy(CondVar* cond) {
+    free(cond); /* CONDITION_VARIABLE não precisa de destruição */
+}
+
+void CondVar_Wait(CondVar* cond, Mutex* mutex) { SleepConditionVariableCS(&cond->cv, &mutex->cs, INFINITE); }
+void CondVar_Signal(CondVar* cond) { WakeConditionVariable(&cond->cv); }
+void CondVar_Broadcast(CondVar* cond) { WakeAllConditionVariable(&cond->cv); }
+
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+struct Thread {
+    pthread_t handle;
+    ThreadFunc func;
+    void* userData;
+};
+
+struct Mutex {
+    pthread_mutex_t m;
+};
+
+struct CondVar {
+    pthread_cond_t cv;
+};
+
+static void* Thread_Entry(void* param) {
+    Thread* thread = (Thread*)param;
+    thread->func(thread->userData);
+    return NULL;
+}
+
+Thread* Thread_Create(ThreadFunc func, void* userData) {
+    if (!func) return NULL;
+    Thread* thread = (Thread*)calloc(1, sizeof(Thread));
+    if (!thread) return NULL;
+    thread->func = func;
+    thread->userData = userData;
+    if (pthread_create(&thread->handle, NULL, Thread_Entry, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void Thread_Join(Thread* thread) {
+    if (!thread) return;
+    pthread_join(thread->handle, NULL);
+    free(thread);
+}
+
+int32_t Thread_GetCpuCount(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int32_t)n : 1;
+}
+
+void Thread_Yield(void) {
+    sched_yield();
+}
+
+void Thread_Sleep(uint32_t milliseconds) {
+    /* unistd.h: <time.h> (nanosleep) é sombreado por include/core/time.h no -I */
+    while (milliseconds >= 1000u) {
+        sleep(1);
+        milliseconds -= 1000u;
+    }
+    if (milliseconds > 0) usleep((useconds_t)milliseconds * 1000u);
+}
+
+Mutex* Mutex_Create(void) {
+    Mutex* mutex = (Mutex*)calloc(1, sizeof(Mutex));
+    if (mutex) pthread_mutex_init(&mutex->m, NULL);
+    return mutex;
+}
+
+void Mutex_Destroy(Mutex* mutex) {
+    if (!mutex) return;
+    pthread_mutex_destroy(&mutex->m);
+    free(mutex);
+}
+
+void Mutex_Lock(Mutex* mutex) { pthread_mutex_lock(&mutex->m); }
+void Mutex_Unlock(Mutex* mutex) { pthread_mutex_unlock(&mutex->m); }
+
+CondVar* CondVar_Create(void) {
+    CondVar* cond = (CondVar*)calloc(1, sizeof(CondVar));
+    if (cond) pthread_cond_init(&cond->cv, NULL);
+    return cond;
+}
+
+void CondVar_Destroy(CondVar* cond) {
+    if (!cond) return;
+    pthread_cond_destroy(&cond->cv);
+    free(cond);
+}
+
+void CondVar_Wait(CondVar* cond, Mutex* mutex) { pthread_cond_wait(&cond->cv, &mutex->m); }
+void CondVar_Signal(CondVar* cond) { pthread_cond_signal(&cond->cv); }
+void CondVar_Broadcast(CondVar* cond) { pthread_cond_broadcast(&cond->cv); }
+
+#endif
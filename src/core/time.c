@@ -6,10 +6,12 @@ static float g_totalTime = 0.0f;
 static uint64_t g_ticks = 0;
 static LARGE_INTEGER g_frequency;
 static LARGE_INTEGER g_lastTime;
+static LARGE_INTEGER g_startTime;
 
 void Time_Init(void) {
     QueryPerformanceFrequency(&g_frequency);
     QueryPerformanceCounter(&g_lastTime);
+    g_startTime = g_lastTime;
     g_deltaTime = 0.0f;
     g_totalTime = 0.0f;
     g_ticks = 0;
@@ -43,3 +45,9 @@ float Time_GetTotalTime(void) {
 uint64_t Time_GetTicks(void) {
     return g_ticks;
 }
+
+double Time_GetSeconds(void) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (double)(now.QuadPart - g_startTime.QuadPart) / (double)g_frequency.QuadPart;
+}
@@ -0,0 +1,49 @@
+#include "core/triple_buffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TRIPLE_BUFFER_FRESH 0x4u     // Bit do meio: publicado e ainda não lido
+#define TRIPLE_BUFFER_INDEX 0x3u
+
+bool TripleBuffer_Init(TripleBuffer* tb, size_t slotSize) {
+    if (!tb || slotSize == 0) return false;
+    memset(tb, 0, sizeof(*tb));
+    tb->slots = (uint8_t*)calloc(3, slotSize);
+    if (!tb->slots) return false;
+    tb->slotSize = slotSize;
+    tb->front = 0;
+    tb->middle = 1;
+    tb->back = 2;
+    return true;
+}
+
+void TripleBuffer_Destroy(TripleBuffer* tb) {
+    if (!tb) return;
+    free(tb->slots);
+    memset(tb, 0, sizeof(*tb));
+}
+
+void* TripleBuffer_WriteSlot(TripleBuffer* tb) {
+    if (!tb || !tb->slots) return NULL;
+    return tb->slots + (size_t)tb->back * tb->slotSize;
+}
+
+void TripleBuffer_Publish(TripleBuffer* tb) {
+    if (!tb || !tb->slots) return;
+    // Release: o conteúdo do slot fica visível antes do índice
+    uint32_t old = __atomic_exchange_n(&tb->middle, tb->back | TRIPLE_BUFFER_FRESH, __ATOMIC_ACQ_REL);
+    tb->back = old & TRIPLE_BUFFER_INDEX;
+}
+
+const void* TripleBuffer_Read(TripleBuffer* tb, bool* outFresh) {
+    if (outFresh) *outFresh = false;
+    if (!tb || !tb->slots) return NULL;
+    if (__atomic_load_n(&tb->middle, __ATOMIC_ACQUIRE) & TRIPLE_BUFFER_FRESH) {
+        // Só o leitor limpa o bit: entre o load e a troca o escritor pode ter publicado de
+        // novo, mas o slot recebido continua sendo o mais novo
+        uint32_t old = __atomic_exchange_n(&tb->middle, tb->front, __ATOMIC_ACQ_REL);
+        tb->front = old & TRIPLE_BUFFER_INDEX;
+        if (outFresh) *outFresh = true;
+    }
+    return tb->slots + (size_t)tb->front * tb->slotSize;
+}
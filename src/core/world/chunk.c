@@ -1,36 +1,392 @@
 #include "core/world/chunk.h"
+#include "core/thread.h"
+#include "core/epoch.h"
 #include <stdlib.h>
 #include <string.h>
 
+// ============================================================================
+// SEÇÕES INTERNADAS (tabela global por hash de conteúdo)
+// ============================================================================
+
+#define SECTION_TABLE_SIZE 4096
+#define SECTION_FNV64_OFFSET 0xcbf29ce484222325ULL
+#define SECTION_FNV64_PRIME  0x100000001b3ULL
+#define SECTION_RECYCLE_MAX  64   // Seções liberadas guardadas para reuso (32 KB cada)
+
+static struct {
+    SpinLock lock;
+    ChunkSection* buckets[SECTION_TABLE_SIZE];
+    int32_t uniqueCount;        // Seções internadas distintas
+    int32_t referenceCount;     // Soma dos refCounts
+    int32_t privateCount;       // Cópias privadas (atômico)
+    ChunkSection* recycled;     // Lista (nextInTable) de seções livres para Section_AllocPrivate
+    int32_t recycledCount;
+} g_sections;
+
+// Chunks e seções tirados de uso só são liberados quando nenhum leitor concorrente
+// (Chunk_ReadBegin/End) pode mais estar com o ponteiro.
+static EpochDomain g_chunkEpoch;
+
+static inline uint64_t Section_HashStep(uint64_t h, Voxel v) {
+    h ^= ((uint64_t)v.type << 8) | v.metadata;
+    return h * SECTION_FNV64_PRIME;
+}
+
+static uint64_t Section_Hash(const Voxel* blocks, int32_t* outSolidCount) {
+    uint64_t h = SECTION_FNV64_OFFSET;
+    int32_t solid = 0;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+        h = Section_HashStep(h, blocks[i]);
+        solid += (blocks[i].type != BLOCK_AIR);
+    }
+    *outSolidCount = solid;
+    return h;
+}
+
+static bool Section_Equal(const Voxel* a, const Voxel* b) {
+    // Campo a campo: Voxel tem padding
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+        if (a[i].type != b[i].type || a[i].metadata != b[i].metadata) return false;
+    }
+    return true;
+}
+
+static bool Section_IsUniform(const Voxel* blocks, Voxel v) {
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+        if (blocks[i].type != v.type || blocks[i].metadata != v.metadata) return false;
+    }
+    return true;
+}
+
+// Destino do Epoch_Retire das seções: volta para a lista de reuso (já sem leitores) ou free.
+// Cópias privadas nascem e morrem a cada edição e snapshot de mesh: assim não passam pelo heap.
+static void Section_Recycle(void* ptr) {
+    ChunkSection* section = (ChunkSection*)ptr;
+    SpinLock_Lock(&g_sections.lock);
+    if (g_sections.recycledCount < SECTION_RECYCLE_MAX) {
+        section->nextInTable = g_sections.recycled;
+        g_sections.recycled = section;
+        g_sections.recycledCount++;
+        section = NULL;
+    }
+    SpinLock_Unlock(&g_sections.lock);
+    free(section);
+}
+
+static ChunkSection* Section_AllocPrivate(void) {
+    SpinLock_Lock(&g_sections.lock);
+    ChunkSection* section = g_sections.recycled;
+    if (section) {
+        g_sections.recycled = section->nextInTable;
+        g_sections.recycledCount--;
+    }
+    SpinLock_Unlock(&g_sections.lock);
+    if (!section) section = (ChunkSection*)malloc(sizeof(ChunkSection));
+    if (!section) return NULL;
+    section->hash = 0;
+    section->solidCount = 0;
+    section->refCount = 1;
+    section->interned = false;
+    section->nextInTable = NULL;
+    __atomic_add_fetch(&g_sections.privateCount, 1, __ATOMIC_RELAXED);
+    return section;
+}
+
+static void Section_FreePrivate(ChunkSection* section) {
+    __atomic_sub_fetch(&g_sections.privateCount, 1, __ATOMIC_RELAXED);
+    Epoch_Retire(&g_chunkEpoch, section, Section_Recycle);
+}
+
+// Troca o ponteiro da seção (leitores concorrentes leem com acquire)
+static inline void Chunk_PublishSection(Chunk* chunk, int32_t section, ChunkSection* value) {
+    __atomic_store_n(&chunk->sections[section], value, __ATOMIC_RELEASE);
+}
+
+// Com o lock: insere uma seção recém-internada
+static void Section_InsertLocked(ChunkSection* section, uint64_t hash, int32_t solidCount) {
+    uint32_t bucket = (uint32_t)(hash % SECTION_TABLE_SIZE);
+    section->hash = hash;
+    section->solidCount = solidCount;
+    section->refCount = 1;
+    section->interned = true;
+    section->nextInTable = g_sections.buckets[bucket];
+    g_sections.buckets[bucket] = section;
+    g_sections.uniqueCount++;
+    g_sections.referenceCount++;
+}
+
+// Troca uma seção privada pela internada de mesmo conteúdo (ou a interna)
+static ChunkSection* Section_Intern(ChunkSection* section) {
+    int32_t solidCount = 0;
+    uint64_t hash = Section_Hash(section->blocks, &solidCount);
+    uint32_t bucket = (uint32_t)(hash % SECTION_TABLE_SIZE);
+
+    SpinLock_Lock(&g_sections.lock);
+    for (ChunkSection* it = g_sections.buckets[bucket]; it; it = it->nextInTable) {
+        if (it->hash == hash && Section_Equal(it->blocks, section->blocks)) {
+            it->refCount++;
+            g_sections.referenceCount++;
+            SpinLock_Unlock(&g_sections.lock);
+            Section_FreePrivate(section);
+            return it;
+        }
+    }
+    __atomic_sub_fetch(&g_sections.privateCount, 1, __ATOMIC_RELAXED);
+    Section_InsertLocked(section, hash, solidCount);
+    SpinLock_Unlock(&g_sections.lock);
+    return section;
+}
+
+// Seção internada toda preenchida com `v` (sem materializar uma cópia se já existir)
+static ChunkSection* Section_InternUniform(Voxel v) {
+    uint64_t hash = SECTION_FNV64_OFFSET;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) hash = Section_HashStep(hash, v);
+    uint32_t bucket = (uint32_t)(hash % SECTION_TABLE_SIZE);
+
+    SpinLock_Lock(&g_sections.lock);
+    for (ChunkSection* it = g_sections.buckets[bucket]; it; it = it->nextInTable) {
+        if (it->hash == hash && Section_IsUniform(it->blocks, v)) {
+            it->refCount++;
+            g_sections.referenceCount++;
+            SpinLock_Unlock(&g_sections.lock);
+            return it;
+        }
+    }
+    SpinLock_Unlock(&g_sections.lock);
+
+    ChunkSection* section = Section_AllocPrivate();
+    if (!section) return NULL;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) section->blocks[i] = v;
+    return Section_Intern(section); // outra thread pode ter criado no meio tempo
+}
+
+
+static void Section_Release(ChunkSection* section) {
+    if (!section) return;
+    if (!section->interned) {
+        Section_FreePrivate(section);
+        return;
+    }
+
+    SpinLock_Lock(&g_sections.lock);
+    g_sections.referenceCount--;
+    if (--section->refCount > 0) {
+        SpinLock_Unlock(&g_sections.lock);
+        return;
+    }
+    ChunkSection** link = &g_sections.buckets[section->hash % SECTION_TABLE_SIZE];
+    while (*link && *link != section) link = &(*link)->nextInTable;
+    if (*link) *link = section->nextInTable;
+    g_sections.uniqueCount--;
+    SpinLock_Unlock(&g_sections.lock);
+    Epoch_Retire(&g_chunkEpoch, section, Section_Recycle);
+}
+
+// ============================================================================
+// CHUNK
+// ============================================================================
+
+// Contador global: versões nunca se repetem, nem entre chunks recriados nas mesmas coordenadas
+static uint32_t g_chunkVersionCounter = 0;
+
+// sideMask: bits (1 << CHUNK_SIDE_*) das bordas que a alteração pode ter tocado
+static void Chunk_MarkChanged(Chunk* chunk, uint32_t sideMask) {
+    uint32_t version = __atomic_add_fetch(&g_chunkVersionCounter, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&chunk->version, version, __ATOMIC_RELEASE);
+    for (int32_t side = 0; side < 4; side++) {
+        if (sideMask & (1u << side)) __atomic_store_n(&chunk->borderVersions[side], version, __ATOMIC_RELEASE);
+    }
+}
+
 Chunk* Chunk_Create(int32_t chunkX, int32_t chunkZ, uint64_t chunkSeed) {
     Chunk* chunk = (Chunk*)calloc(1, sizeof(Chunk));
     if (!chunk) return NULL;
     
+    Chunk_Reset(chunk, chunkX, chunkZ, chunkSeed);
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        if (!chunk->sections[s]) {
+            Chunk_Destroy(chunk);
+            return NULL;
+        }
+    }
+    return chunk;
+}
+
+void Chunk_Reset(Chunk* chunk, int32_t chunkX, int32_t chunkZ, uint64_t chunkSeed) {
+    if (!chunk) return;
+    
     chunk->chunkX = chunkX;
     chunk->chunkZ = chunkZ;
     chunk->chunkSeed = chunkSeed;
-    chunk->state = CHUNK_STATE_GENERATING;
+    __atomic_store_n(&chunk->state, CHUNK_STATE_GENERATING, __ATOMIC_RELEASE);
     chunk->dirty = false;
+    chunk->storagePending = false;
     chunk->next = NULL;
     
-    // Inicializa todos os blocos como ar
-    for (int i = 0; i < CHUNK_VOLUME; i++) {
-        chunk->blocks[i].type = BLOCK_AIR;
-        chunk->blocks[i].metadata = 0;
+    // Inicializa todos os blocos como ar (uma seção compartilhada para todas)
+    Voxel air = {BLOCK_AIR, 0};
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        Chunk_FillSection(chunk, s, air);
     }
-    
-    return chunk;
+    Chunk_MarkChanged(chunk, CHUNK_SIDES_ALL); // coordenadas novas: versão nova mesmo se já era só ar
 }
 
 void Chunk_Destroy(Chunk* chunk) {
     if (chunk) {
+        for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+            Section_Release(chunk->sections[s]);
+        }
         free(chunk);
     }
 }
 
+static void Chunk_DestroyRetired(void* ptr) {
+    Chunk_Destroy((Chunk*)ptr);
+}
+
+void Chunk_Retire(Chunk* chunk) {
+    if (chunk) Epoch_Retire(&g_chunkEpoch, chunk, Chunk_DestroyRetired);
+}
+
+int32_t Chunk_ReadBegin(void) {
+    return Epoch_Enter(&g_chunkEpoch);
+}
+
+void Chunk_ReadEnd(int32_t guard) {
+    Epoch_Exit(&g_chunkEpoch, guard);
+}
+
+void Chunk_CollectRetired(bool waitForReaders) {
+    if (waitForReaders) {
+        Epoch_Synchronize(&g_chunkEpoch);
+        Epoch_Synchronize(&g_chunkEpoch); // seções soltas pelos chunks liberados na primeira passada
+    } else {
+        Epoch_Collect(&g_chunkEpoch);
+    }
+}
+
+int32_t Chunk_GetRetiredCount(void) {
+    return Epoch_GetPendingCount(&g_chunkEpoch);
+}
+
+bool Chunk_IsSectionEmpty(const Chunk* chunk, int32_t section) {
+    const ChunkSection* current = __atomic_load_n(&chunk->sections[section], __ATOMIC_ACQUIRE);
+    if (current->interned) return current->solidCount == 0;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+        if (current->blocks[i].type != BLOCK_AIR) return false;
+    }
+    return true;
+}
+
+static Voxel* Chunk_MakeSectionPrivate(Chunk* chunk, int32_t section) {
+    ChunkSection* current = chunk->sections[section];
+    if (!current->interned) return current->blocks;
+    
+    ChunkSection* copy = Section_AllocPrivate();
+    if (!copy) return NULL;
+    memcpy(copy->blocks, current->blocks, sizeof(copy->blocks));
+    Chunk_PublishSection(chunk, section, copy);
+    Section_Release(current);
+    return copy->blocks;
+}
+
+Voxel* Chunk_GetSectionMut(Chunk* chunk, int32_t section) {
+    Voxel* blocks = Chunk_MakeSectionPrivate(chunk, section);
+    if (blocks) Chunk_MarkChanged(chunk, CHUNK_SIDES_ALL); // o chamador vai escrever em qualquer lugar da seção
+    return blocks;
+}
+
+void Chunk_FillSection(Chunk* chunk, int32_t section, Voxel voxel) {
+    ChunkSection* shared = Section_InternUniform(voxel);
+    if (shared) {
+        ChunkSection* previous = chunk->sections[section];
+        Chunk_PublishSection(chunk, section, shared);
+        Section_Release(previous);
+        if (previous != shared) Chunk_MarkChanged(chunk, CHUNK_SIDES_ALL);
+        return;
+    }
+    
+    // Sem memória para a seção compartilhada: preenche a atual, se houver
+    Voxel* blocks = chunk->sections[section] ? Chunk_GetSectionMut(chunk, section) : NULL;
+    if (!blocks) return;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) blocks[i] = voxel;
+}
+
+void Chunk_InternSections(Chunk* chunk) {
+    if (!chunk) return;
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        ChunkSection* current = chunk->sections[s];
+        if (!current->interned) {
+            // Section_Intern pode aposentar `current`: publica a substituta antes de voltar
+            Chunk_PublishSection(chunk, s, Section_Intern(current));
+        }
+    }
+}
+
+// Seção de um chunk que outra thread pode estar trocando (dentro de Chunk_ReadBegin/End).
+// Internada: volta com uma referência a mais e *outShared = true. Privada: só os voxels
+// servem (*outShared = false). Internada com refCount 0 já foi substituída no chunk
+// (a troca publica antes de soltar): relê o ponteiro em vez de ressuscitá-la.
+static ChunkSection* Chunk_AcquireSection(const Chunk* chunk, int32_t section, bool* outShared) {
+    for (;;) {
+        ChunkSection* current = __atomic_load_n(&chunk->sections[section], __ATOMIC_ACQUIRE);
+        SpinLock_Lock(&g_sections.lock);
+        bool interned = current->interned;
+        bool alive = current->refCount > 0;
+        if (interned && alive) {
+            current->refCount++;
+            g_sections.referenceCount++;
+        }
+        SpinLock_Unlock(&g_sections.lock);
+        if (!interned || alive) {
+            *outShared = interned;
+            return current;
+        }
+    }
+}
+
+void Chunk_CopyBlocks(Chunk* dst, const Chunk* src) {
+    if (!dst || !src || dst == src) return;
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        bool shared = false;
+        ChunkSection* from = Chunk_AcquireSection(src, s, &shared);
+        if (shared) {
+            ChunkSection* previous = dst->sections[s];
+            Chunk_PublishSection(dst, s, from);
+            Section_Release(previous);
+            if (previous != from) Chunk_MarkChanged(dst, CHUNK_SIDES_ALL);
+        } else {
+            Voxel* to = Chunk_GetSectionMut(dst, s);
+            if (to) memcpy(to, from->blocks, sizeof(from->blocks));
+        }
+    }
+}
+
+bool Chunk_SameBlocks(const Chunk* a, const Chunk* b) {
+    for (int32_t s = 0; s < CHUNK_SECTION_COUNT; s++) {
+        const ChunkSection* sa = a->sections[s];
+        const ChunkSection* sb = b->sections[s];
+        if (sa == sb) continue;
+        if (sa->interned && sb->interned) return false; // conteúdo igual ⇒ mesmo ponteiro
+        if (!Section_Equal(sa->blocks, sb->blocks)) return false;
+    }
+    return true;
+}
+
+void Chunk_GetSectionStats(int32_t* outReferenced, int32_t* outUnique, int32_t* outPrivate) {
+    SpinLock_Lock(&g_sections.lock);
+    int32_t referenced = g_sections.referenceCount;
+    int32_t unique = g_sections.uniqueCount;
+    SpinLock_Unlock(&g_sections.lock);
+    
+    if (outReferenced) *outReferenced = referenced;
+    if (outUnique) *outUnique = unique;
+    if (outPrivate) *outPrivate = __atomic_load_n(&g_sections.privateCount, __ATOMIC_RELAXED);
+}
+
 static inline int32_t Chunk_GetIndex(int32_t localX, int32_t localY, int32_t localZ) {
-    // Indexação: [y][z][x] = y * (CHUNK_SIZE_Z * CHUNK_SIZE_X) + z * CHUNK_SIZE_X + x
-    return localY * (CHUNK_SIZE_Z * CHUNK_SIZE_X) + localZ * CHUNK_SIZE_X + localX;
+    // Indexação dentro da seção: [y][z][x] com y relativo à seção
+    return (localY % CHUNK_SECTION_HEIGHT) * (CHUNK_SIZE_Z * CHUNK_SIZE_X) + localZ * CHUNK_SIZE_X + localX;
 }
 
 Voxel Chunk_GetBlock(const Chunk* chunk, int32_t localX, int32_t localY, int32_t localZ) {
@@ -40,14 +396,26 @@ Voxel Chunk_GetBlock(const Chunk* chunk, int32_t localX, int32_t localY, int32_t
     }
     
     int32_t index = Chunk_GetIndex(localX, localY, localZ);
-    return chunk->blocks[index];
+    return Chunk_GetSectionVoxels(chunk, localY / CHUNK_SECTION_HEIGHT)[index];
 }
 
 void Chunk_SetBlock(Chunk* chunk, int32_t localX, int32_t localY, int32_t localZ, Voxel voxel) {
     if (!chunk || !Chunk_IsValidLocalPos(localX, localY, localZ)) return;
     
+    int32_t section = localY / CHUNK_SECTION_HEIGHT;
     int32_t index = Chunk_GetIndex(localX, localY, localZ);
-    chunk->blocks[index] = voxel;
+    const Voxel current = chunk->sections[section]->blocks[index];
+    if (current.type != voxel.type || current.metadata != voxel.metadata) {
+        Voxel* blocks = Chunk_MakeSectionPrivate(chunk, section); // cópia privada só aqui
+        if (!blocks) return;
+        blocks[index] = voxel;
+        uint32_t sides = 0;
+        if (localX == 0) sides |= 1u << CHUNK_SIDE_NEG_X;
+        if (localX == CHUNK_SIZE_X - 1) sides |= 1u << CHUNK_SIDE_POS_X;
+        if (localZ == 0) sides |= 1u << CHUNK_SIDE_NEG_Z;
+        if (localZ == CHUNK_SIZE_Z - 1) sides |= 1u << CHUNK_SIDE_POS_Z;
+        Chunk_MarkChanged(chunk, sides);
+    }
     chunk->dirty = true;
 }
 
@@ -0,0 +1,423 @@
+#include "core/world/chunk_codec.h"
+#include <string.h>
+
+/* Fases do encoder/decoder (máquina de estados; permite parar em qualquer byte). */
+enum {
+    ENC_HEADER = 0,
+    ENC_SECTION_BEGIN,
+    ENC_PALETTE,
+    ENC_RUNS,
+    ENC_CHECKSUM,
+    ENC_DONE
+};
+
+enum {
+    DEC_MAGIC = 0,
+    DEC_VERSION,
+    DEC_CHUNK_X,
+    DEC_CHUNK_Z,
+    DEC_SEED,
+    DEC_SECTION_COUNT,
+    DEC_SECTION_HEIGHT,
+    DEC_PALETTE_COUNT,
+    DEC_PALETTE_ENTRY,
+    DEC_RUN,
+    DEC_CHECKSUM,
+    DEC_DONE
+};
+
+static const uint8_t CODEC_MAGIC[4] = { 'B', 'T', 'D', 'C' };
+
+#define FNV32_OFFSET_BASIS 2166136261u
+#define FNV32_PRIME        16777619u
+#define PALETTE_ABSENT     0xFF
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static inline uint32_t Fnv32_Update(uint32_t hash, const uint8_t* bytes, int32_t length) {
+    for (int32_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= FNV32_PRIME;
+    }
+    return hash;
+}
+
+static inline int32_t WriteVarint(uint8_t* dst, uint64_t value) {
+    int32_t n = 0;
+    while (value >= 0x80) {
+        dst[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    dst[n++] = (uint8_t)value;
+    return n;
+}
+
+static inline uint64_t ZigZagEncode(int32_t v) {
+    return (uint64_t)(((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static inline int32_t ZigZagDecode(uint64_t v) {
+    return (int32_t)((uint32_t)(v >> 1) ^ (uint32_t)-(int32_t)(v & 1));
+}
+
+/* Chave única (type, metadata). Tipos inválidos viram ar (não propagam lixo para o disco). */
+static inline uint16_t VoxelKey(Voxel v) {
+    uint32_t type = (uint32_t)v.type;
+    if (type >= BLOCK_COUNT) return 0;
+    return (uint16_t)(type * 256u + v.metadata);
+}
+
+static inline const Voxel* SectionVoxels(const Chunk* chunk, int32_t section) {
+    return Chunk_GetSectionVoxels(chunk, section);
+}
+
+static int32_t BitsForPalette(int32_t count) {
+    int32_t bits = 0;
+    while ((1 << bits) < count) bits++;
+    return bits;
+}
+
+// ============================================================================
+// ENCODER
+// ============================================================================
+
+/* Monta a paleta da seção atual; cai para modo direto se passar do limite. */
+static void Encoder_BuildPalette(ChunkEncoder* enc) {
+    for (int32_t i = 0; i < enc->paletteCount; i++) {
+        enc->paletteIndexOf[enc->palette[i]] = PALETTE_ABSENT;
+    }
+    enc->paletteCount = 0;
+
+    const Voxel* voxels = SectionVoxels(enc->chunk, enc->section);
+    bool direct = false;
+    uint16_t lastKey = 0xFFFF;
+    for (int32_t i = 0; i < CHUNK_SECTION_VOLUME; i++) {
+        uint16_t key = VoxelKey(voxels[i]);
+        if (key == lastKey) continue;
+        lastKey = key;
+        if (enc->paletteIndexOf[key] != PALETTE_ABSENT) continue;
+        if (enc->paletteCount >= CHUNK_CODEC_MAX_PALETTE) {
+            direct = true;
+            break;
+        }
+        enc->paletteIndexOf[key] = (uint8_t)enc->paletteCount;
+        enc->palette[enc->paletteCount++] = key;
+    }
+
+    enc->indexBits = direct ? CHUNK_CODEC_DIRECT_BITS : BitsForPalette(enc->paletteCount);
+}
+
+/* Produz o próximo token em enc->pending. */
+static void Encoder_NextToken(ChunkEncoder* enc) {
+    uint8_t* p = enc->pending;
+    int32_t n = 0;
+
+    switch (enc->phase) {
+        case ENC_HEADER:
+            memcpy(p, CODEC_MAGIC, sizeof(CODEC_MAGIC));
+            n = (int32_t)sizeof(CODEC_MAGIC);
+            n += WriteVarint(p + n, CHUNK_CODEC_VERSION);
+            n += WriteVarint(p + n, ZigZagEncode(enc->chunk->chunkX));
+            n += WriteVarint(p + n, ZigZagEncode(enc->chunk->chunkZ));
+            n += WriteVarint(p + n, enc->chunk->chunkSeed);
+            n += WriteVarint(p + n, CHUNK_SECTION_COUNT);
+            n += WriteVarint(p + n, CHUNK_SECTION_HEIGHT);
+            enc->section = 0;
+            enc->phase = ENC_SECTION_BEGIN;
+            break;
+
+        case ENC_SECTION_BEGIN: {
+            Encoder_BuildPalette(enc);
+            bool direct = (enc->indexBits == CHUNK_CODEC_DIRECT_BITS);
+            n = WriteVarint(p, direct ? 0u : (uint64_t)enc->paletteCount);
+            enc->cursor = 0;
+            enc->phase = direct ? ENC_RUNS : ENC_PALETTE;
+            break;
+        }
+
+        case ENC_PALETTE:
+            n = WriteVarint(p, enc->palette[enc->cursor++]);
+            if (enc->cursor >= enc->paletteCount) {
+                enc->cursor = 0;
+                if (enc->paletteCount > 1) {
+                    enc->phase = ENC_RUNS;
+                } else {
+                    /* Seção uniforme: a paleta já descreve tudo. */
+                    enc->section++;
+                    enc->phase = (enc->section < CHUNK_SECTION_COUNT) ? ENC_SECTION_BEGIN : ENC_CHECKSUM;
+                }
+            }
+            break;
+
+        case ENC_RUNS: {
+            const Voxel* voxels = SectionVoxels(enc->chunk, enc->section);
+            int32_t start = enc->cursor;
+            uint16_t key = VoxelKey(voxels[start]);
+            int32_t end = start + 1;
+            while (end < CHUNK_SECTION_VOLUME && VoxelKey(voxels[end]) == key) end++;
+
+            uint32_t index = (enc->indexBits == CHUNK_CODEC_DIRECT_BITS) ? key : enc->paletteIndexOf[key];
+            uint64_t token = ((uint64_t)(end - start - 1) << enc->indexBits) | index;
+            n = WriteVarint(p, token);
+
+            enc->cursor = end;
+            if (end >= CHUNK_SECTION_VOLUME) {
+                enc->section++;
+                enc->phase = (enc->section < CHUNK_SECTION_COUNT) ? ENC_SECTION_BEGIN : ENC_CHECKSUM;
+            }
+            break;
+        }
+
+        case ENC_CHECKSUM:
+            p[0] = (uint8_t)(enc->checksum);
+            p[1] = (uint8_t)(enc->checksum >> 8);
+            p[2] = (uint8_t)(enc->checksum >> 16);
+            p[3] = (uint8_t)(enc->checksum >> 24);
+            enc->pendingLen = 4;
+            enc->pendingPos = 0;
+            enc->phase = ENC_DONE;
+            return; /* checksum não entra no próprio hash */
+
+        default:
+            break;
+    }
+
+    enc->checksum = Fnv32_Update(enc->checksum, p, n);
+    enc->pendingLen = n;
+    enc->pendingPos = 0;
+}
+
+void ChunkEncoder_Begin(ChunkEncoder* enc, const Chunk* chunk) {
+    if (!enc) return;
+    memset(enc, 0, sizeof(ChunkEncoder));
+    memset(enc->paletteIndexOf, PALETTE_ABSENT, sizeof(enc->paletteIndexOf));
+    enc->chunk = chunk;
+    enc->phase = chunk ? ENC_HEADER : ENC_DONE;
+    enc->checksum = FNV32_OFFSET_BASIS;
+}
+
+ChunkCodecResult ChunkEncoder_Encode(ChunkEncoder* enc, uint8_t* out, size_t outCapacity, size_t* outWritten) {
+    size_t written = 0;
+    if (!enc || !out) {
+        if (outWritten) *outWritten = 0;
+        return CHUNK_CODEC_OK;
+    }
+
+    for (;;) {
+        if (enc->pendingPos < enc->pendingLen) {
+            size_t avail = outCapacity - written;
+            size_t left = (size_t)(enc->pendingLen - enc->pendingPos);
+            size_t n = (left < avail) ? left : avail;
+            memcpy(out + written, enc->pending + enc->pendingPos, n);
+            written += n;
+            enc->pendingPos += (int32_t)n;
+            if (enc->pendingPos < enc->pendingLen) break; /* saída cheia */
+        }
+        if (enc->phase == ENC_DONE) break;
+        Encoder_NextToken(enc);
+    }
+
+    if (outWritten) *outWritten = written;
+    bool finished = (enc->phase == ENC_DONE && enc->pendingPos >= enc->pendingLen);
+    return finished ? CHUNK_CODEC_OK : CHUNK_CODEC_NEED_OUTPUT;
+}
+
+// ============================================================================
+// DECODER
+// ============================================================================
+
+static inline Voxel* SectionVoxelsMut(Chunk* chunk, int32_t section) {
+    return Chunk_GetSectionMut(chunk, section); /* cópia privada; internada no fim */
+}
+
+static inline Voxel KeyToVoxel(uint16_t key) {
+    Voxel v = { (BlockType)(key >> 8), (uint8_t)(key & 0xFF) };
+    return v;
+}
+
+static bool Decoder_FillSection(ChunkDecoder* dec, int32_t from, int32_t count, uint16_t key) {
+    Voxel v = KeyToVoxel(key);
+    if (from == 0 && count == CHUNK_SECTION_VOLUME) {
+        Chunk_FillSection(dec->chunk, dec->section, v); /* seção uniforme: compartilhada */
+        return true;
+    }
+    Voxel* voxels = SectionVoxelsMut(dec->chunk, dec->section);
+    if (!voxels) return false;
+    for (int32_t i = 0; i < count; i++) voxels[from + i] = v;
+    return true;
+}
+
+static void Decoder_EndSection(ChunkDecoder* dec) {
+    dec->section++;
+    dec->cursor = 0;
+    dec->phase = (dec->section < CHUNK_SECTION_COUNT) ? DEC_PALETTE_COUNT : DEC_CHECKSUM;
+    dec->rawCount = 0;
+}
+
+/* Processa um varint completo conforme a fase atual. */
+static ChunkCodecResult Decoder_OnValue(ChunkDecoder* dec, uint64_t value) {
+    switch (dec->phase) {
+        case DEC_VERSION:
+            if (value != CHUNK_CODEC_VERSION) return CHUNK_CODEC_ERROR_VERSION;
+            dec->phase = DEC_CHUNK_X;
+            break;
+        case DEC_CHUNK_X:
+            dec->chunk->chunkX = ZigZagDecode(value);
+            dec->phase = DEC_CHUNK_Z;
+            break;
+        case DEC_CHUNK_Z:
+            dec->chunk->chunkZ = ZigZagDecode(value);
+            dec->phase = DEC_SEED;
+            break;
+        case DEC_SEED:
+            dec->chunk->chunkSeed = value;
+            dec->phase = DEC_SECTION_COUNT;
+            break;
+        case DEC_SECTION_COUNT:
+            if (value != CHUNK_SECTION_COUNT) return CHUNK_CODEC_ERROR_VERSION;
+            dec->phase = DEC_SECTION_HEIGHT;
+            break;
+        case DEC_SECTION_HEIGHT:
+            if (value != CHUNK_SECTION_HEIGHT) return CHUNK_CODEC_ERROR_VERSION;
+            dec->section = 0;
+            dec->phase = DEC_PALETTE_COUNT;
+            break;
+
+        case DEC_PALETTE_COUNT:
+            if (value > CHUNK_CODEC_MAX_PALETTE) return CHUNK_CODEC_ERROR_CORRUPT;
+            dec->paletteCount = (int32_t)value;
+            dec->paletteRemaining = (int32_t)value;
+            dec->cursor = 0;
+            if (value == 0) {
+                dec->indexBits = CHUNK_CODEC_DIRECT_BITS;
+                dec->phase = DEC_RUN;
+            } else {
+                dec->indexBits = BitsForPalette((int32_t)value);
+                dec->phase = DEC_PALETTE_ENTRY;
+            }
+            break;
+
+        case DEC_PALETTE_ENTRY:
+            if (value >= CHUNK_CODEC_KEY_COUNT) return CHUNK_CODEC_ERROR_CORRUPT;
+            dec->palette[dec->paletteCount - dec->paletteRemaining] = (uint16_t)value;
+            if (--dec->paletteRemaining == 0) {
+                if (dec->paletteCount == 1) {
+                    if (!Decoder_FillSection(dec, 0, CHUNK_SECTION_VOLUME, dec->palette[0])) return CHUNK_CODEC_ERROR_CORRUPT;
+                    Decoder_EndSection(dec);
+                } else {
+                    dec->phase = DEC_RUN;
+                }
+            }
+            break;
+
+        case DEC_RUN: {
+            uint64_t index = value & ((1u << dec->indexBits) - 1u);
+            uint64_t length = (value >> dec->indexBits) + 1;
+            if (length > (uint64_t)(CHUNK_SECTION_VOLUME - dec->cursor)) return CHUNK_CODEC_ERROR_CORRUPT;
+            uint16_t key;
+            if (dec->indexBits == CHUNK_CODEC_DIRECT_BITS) {
+                if (index >= CHUNK_CODEC_KEY_COUNT) return CHUNK_CODEC_ERROR_CORRUPT;
+                key = (uint16_t)index;
+            } else {
+                if (index >= (uint64_t)dec->paletteCount) return CHUNK_CODEC_ERROR_CORRUPT;
+                key = dec->palette[index];
+            }
+            if (!Decoder_FillSection(dec, dec->cursor, (int32_t)length, key)) return CHUNK_CODEC_ERROR_CORRUPT;
+            dec->cursor += (int32_t)length;
+            if (dec->cursor >= CHUNK_SECTION_VOLUME) Decoder_EndSection(dec);
+            break;
+        }
+
+        default:
+            return CHUNK_CODEC_ERROR_CORRUPT;
+    }
+    return CHUNK_CODEC_OK;
+}
+
+void ChunkDecoder_Begin(ChunkDecoder* dec, Chunk* chunk) {
+    if (!dec) return;
+    memset(dec, 0, sizeof(ChunkDecoder));
+    dec->chunk = chunk;
+    dec->phase = chunk ? DEC_MAGIC : DEC_DONE;
+    dec->checksum = FNV32_OFFSET_BASIS;
+}
+
+ChunkCodecResult ChunkDecoder_Decode(ChunkDecoder* dec, const uint8_t* in, size_t inLength, size_t* outConsumed) {
+    size_t i = 0;
+    ChunkCodecResult result = CHUNK_CODEC_NEED_INPUT;
+    if (!dec || (!in && inLength > 0)) {
+        if (outConsumed) *outConsumed = 0;
+        return CHUNK_CODEC_ERROR_CORRUPT;
+    }
+
+    while (i < inLength && dec->phase != DEC_DONE) {
+        uint8_t b = in[i++];
+
+        if (dec->phase == DEC_CHECKSUM) {
+            dec->storedChecksum |= (uint32_t)b << (8 * dec->rawCount);
+            if (++dec->rawCount == 4) {
+                if (dec->storedChecksum != dec->checksum) {
+                    result = CHUNK_CODEC_ERROR_CORRUPT;
+                    break;
+                }
+                dec->phase = DEC_DONE;
+                Chunk_InternSections(dec->chunk); /* seções iguais voltam a ser compartilhadas */
+            }
+            continue;
+        }
+
+        dec->checksum = Fnv32_Update(dec->checksum, &b, 1);
+
+        if (dec->phase == DEC_MAGIC) {
+            if (b != CODEC_MAGIC[dec->rawCount]) {
+                result = CHUNK_CODEC_ERROR_VERSION;
+                break;
+            }
+            if (++dec->rawCount == (int32_t)sizeof(CODEC_MAGIC)) {
+                dec->rawCount = 0;
+                dec->phase = DEC_VERSION;
+            }
+            continue;
+        }
+
+        if (dec->varShift > 63) {
+            result = CHUNK_CODEC_ERROR_CORRUPT;
+            break;
+        }
+        dec->varValue |= (uint64_t)(b & 0x7F) << dec->varShift;
+        dec->varShift += 7;
+        if (b & 0x80) continue;
+
+        uint64_t value = dec->varValue;
+        dec->varValue = 0;
+        dec->varShift = 0;
+        ChunkCodecResult r = Decoder_OnValue(dec, value);
+        if (r != CHUNK_CODEC_OK) {
+            result = r;
+            break;
+        }
+    }
+
+    if (outConsumed) *outConsumed = i;
+    if (dec->phase == DEC_DONE && result == CHUNK_CODEC_NEED_INPUT) result = CHUNK_CODEC_OK;
+    return result;
+}
+
+// ============================================================================
+// ATALHOS
+// ============================================================================
+
+ChunkCodecResult ChunkCodec_EncodeToBuffer(const Chunk* chunk, uint8_t* out, size_t outCapacity, size_t* outSize) {
+    ChunkEncoder enc;
+    ChunkEncoder_Begin(&enc, chunk);
+    return ChunkEncoder_Encode(&enc, out, outCapacity, outSize);
+}
+
+ChunkCodecResult ChunkCodec_DecodeFromBuffer(Chunk* chunk, const uint8_t* in, size_t inLength) {
+    ChunkDecoder dec;
+    size_t consumed = 0;
+    ChunkDecoder_Begin(&dec, chunk);
+    return ChunkDecoder_Decode(&dec, in, inLength, &consumed);
+}
@@ -0,0 +1,178 @@
+#include "core/world/region_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+static const uint8_t REGION_MAGIC[4] = { 'B', 'T', 'D', 'R' };
+
+static inline void PutU32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t GetU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void RegionData_Init(RegionData* region, int32_t regionX, int32_t regionZ) {
+    if (!region) return;
+    memset(region, 0, sizeof(RegionData));
+    region->regionX = regionX;
+    region->regionZ = regionZ;
+}
+
+void RegionData_Clear(RegionData* region) {
+    if (!region) return;
+    for (int32_t i = 0; i < REGION_CHUNK_COUNT; i++) {
+        free(region->blobs[i]);
+        region->blobs[i] = NULL;
+        region->sizes[i] = 0;
+    }
+    region->chunkCount = 0;
+}
+
+void RegionData_SetChunk(RegionData* region, int32_t slot, uint8_t* blob, uint32_t size) {
+    if (!region || slot < 0 || slot >= REGION_CHUNK_COUNT) {
+        free(blob);
+        return;
+    }
+    if (region->blobs[slot]) region->chunkCount--;
+    free(region->blobs[slot]);
+    if (blob && size == 0) {
+        free(blob);
+        blob = NULL;
+    }
+    region->blobs[slot] = blob;
+    region->sizes[slot] = blob ? size : 0;
+    if (blob) region->chunkCount++;
+}
+
+bool RegionFile_MakePath(char* out, size_t outSize, const char* directory, int32_t regionX, int32_t regionZ) {
+    if (!out || outSize == 0 || !directory) return false;
+    int n = snprintf(out, outSize, "%s/r.%d.%d.btdr", directory, (int)regionX, (int)regionZ);
+    return n > 0 && (size_t)n < outSize;
+}
+
+bool RegionFile_EnsureDirectory(const char* directory) {
+    if (!directory || !directory[0]) return false;
+#ifdef _WIN32
+    int r = _mkdir(directory);
+#else
+    int r = mkdir(directory, 0755);
+#endif
+    return r == 0 || errno == EEXIST;
+}
+
+bool RegionFile_Read(const char* path, RegionData* out) {
+    if (!path || !out) return false;
+    RegionData_Clear(out);
+
+    FILE* f = fopen(path, "rb");
+    if (!f) return true; /* sem arquivo = nenhuma edição nesta região */
+
+    bool ok = false;
+    uint8_t* header = (uint8_t*)malloc(REGION_HEADER_SIZE);
+    long fileSize = -1;
+    if (header && fseek(f, 0, SEEK_END) == 0) {
+        fileSize = ftell(f);
+        fseek(f, 0, SEEK_SET);
+    }
+    if (header && fileSize >= REGION_HEADER_SIZE &&
+        fread(header, 1, REGION_HEADER_SIZE, f) == REGION_HEADER_SIZE &&
+        memcmp(header, REGION_MAGIC, sizeof(REGION_MAGIC)) == 0 &&
+        GetU32(header + 4) == REGION_FILE_VERSION &&
+        (int32_t)GetU32(header + 8) == out->regionX &&
+        (int32_t)GetU32(header + 12) == out->regionZ) {
+        ok = true;
+        const uint8_t* offsets = header + 16;
+        const uint8_t* sizes = offsets + REGION_CHUNK_COUNT * 4;
+        for (int32_t i = 0; i < REGION_CHUNK_COUNT && ok; i++) {
+            uint32_t offset = GetU32(offsets + i * 4);
+            uint32_t size = GetU32(sizes + i * 4);
+            if (size == 0) continue;
+            if (offset < REGION_HEADER_SIZE || (uint64_t)offset + size > (uint64_t)fileSize) {
+                ok = false;
+                break;
+            }
+            uint8_t* blob = (uint8_t*)malloc(size);
+            if (!blob || fseek(f, (long)offset, SEEK_SET) != 0 || fread(blob, 1, size, f) != size) {
+                free(blob);
+                ok = false;
+                break;
+            }
+            RegionData_SetChunk(out, i, blob, size);
+        }
+    }
+
+    free(header);
+    fclose(f);
+    if (!ok) RegionData_Clear(out);
+    return ok;
+}
+
+uint8_t* RegionFile_Serialize(const RegionData* region, size_t* outSize) {
+    if (!region || !outSize) return NULL;
+    *outSize = 0;
+    if (region->chunkCount == 0) return NULL;
+
+    size_t total = REGION_HEADER_SIZE;
+    for (int32_t i = 0; i < REGION_CHUNK_COUNT; i++) total += region->sizes[i];
+
+    uint8_t* bytes = (uint8_t*)malloc(total);
+    if (!bytes) return NULL;
+
+    memcpy(bytes, REGION_MAGIC, sizeof(REGION_MAGIC));
+    PutU32(bytes + 4, REGION_FILE_VERSION);
+    PutU32(bytes + 8, (uint32_t)region->regionX);
+    PutU32(bytes + 12, (uint32_t)region->regionZ);
+
+    uint8_t* offsets = bytes + 16;
+    uint8_t* sizes = offsets + REGION_CHUNK_COUNT * 4;
+    size_t cursor = REGION_HEADER_SIZE;
+    for (int32_t i = 0; i < REGION_CHUNK_COUNT; i++) {
+        uint32_t size = region->blobs[i] ? region->sizes[i] : 0;
+        PutU32(offsets + i * 4, size ? (uint32_t)cursor : 0);
+        PutU32(sizes + i * 4, size);
+        if (size) {
+            memcpy(bytes + cursor, region->blobs[i], size);
+            cursor += size;
+        }
+    }
+
+    *outSize = total;
+    return bytes;
+}
+
+bool RegionFile_WriteBytes(const char* path, const uint8_t* bytes, size_t size) {
+    if (!path) return false;
+    if (!bytes || size == 0) {
+        remove(path); /* região voltou a ficar igual à seed */
+        return true;
+    }
+
+    char tmpPath[600];
+    int n = snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    if (n <= 0 || (size_t)n >= sizeof(tmpPath)) return false;
+
+    FILE* f = fopen(tmpPath, "wb");
+    if (!f) return false;
+    bool ok = fwrite(bytes, 1, size, f) == size;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        remove(tmpPath);
+        return false;
+    }
+    /* rename não sobrescreve no Windows: remove o antigo antes. */
+    remove(path);
+    return rename(tmpPath, path) == 0;
+}
@@ -0,0 +1,211 @@
+#include "core/world/seed_bake.h"
+#include "core/world/chunk.h"
+#include "core/world/chunk_codec.h"
+#include "core/world/voxel_world.h"
+#include "core/world/world_seed.h"
+#include "core/world/region_file.h"
+#include "core/file_map.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SEED_BAKE_WIDTH        (VOXEL_WORLD_MAX_CHUNK_X - VOXEL_WORLD_MIN_CHUNK_X + 1)
+#define SEED_BAKE_HEADER_SIZE  32
+#define SEED_BAKE_INDEX_SIZE   (SEED_BAKE_WIDTH * VOXEL_WORLD_CHUNK_ROWS * 8)
+
+/* Chunks regenerados no Open para detectar bake de um gerador antigo. */
+#define SEED_BAKE_VERIFY_SAMPLES  4
+
+static const uint8_t BAKE_MAGIC[4] = { 'B', 'T', 'D', 'B' };
+
+struct SeedBake {
+    FileMap* map;
+    const uint8_t* data;
+    size_t size;
+    uint64_t worldSeed;
+};
+
+static inline void PutU32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t GetU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void GenerateReference(Chunk* chunk, uint64_t worldSeed, int32_t chunkX, int32_t chunkZ) {
+    ChunkGenContext ctx;
+    Chunk_Reset(chunk, chunkX, chunkZ, WorldSeed_GetChunkSeed(worldSeed, chunkX, chunkZ));
+    VoxelWorld_BuildGenContextForSeed(worldSeed, chunkX, chunkZ, &ctx);
+    VoxelWorld_GenerateChunk(NULL, chunk, &ctx);
+    __atomic_store_n(&chunk->state, CHUNK_STATE_READY, __ATOMIC_RELEASE);
+}
+
+bool SeedBake_MakePath(char* out, size_t outSize, const char* directory, uint64_t worldSeed) {
+    if (!out || outSize == 0 || !directory) return false;
+    int n = snprintf(out, outSize, "%s/%016llx.btdb", directory, (unsigned long long)worldSeed);
+    return n > 0 && (size_t)n < outSize;
+}
+
+bool SeedBake_Build(const char* directory, uint64_t worldSeed, size_t* outFileSize) {
+    char path[512];
+    if (!SeedBake_MakePath(path, sizeof(path), directory, worldSeed)) return false;
+    if (!RegionFile_EnsureDirectory(directory)) return false;
+
+    Chunk* chunk = Chunk_Create(0, 0, 0);
+    uint8_t* encoded = (uint8_t*)malloc(CHUNK_CODEC_MAX_ENCODED_SIZE);
+    size_t capacity = SEED_BAKE_HEADER_SIZE + SEED_BAKE_INDEX_SIZE + (size_t)SEED_BAKE_WIDTH * VOXEL_WORLD_CHUNK_ROWS * 128;
+    uint8_t* bytes = (uint8_t*)malloc(capacity);
+    bool ok = chunk && encoded && bytes;
+
+    size_t cursor = SEED_BAKE_HEADER_SIZE + SEED_BAKE_INDEX_SIZE;
+    for (int32_t z = 0; z < VOXEL_WORLD_CHUNK_ROWS && ok; z++) {
+        for (int32_t x = 0; x < SEED_BAKE_WIDTH && ok; x++) {
+            GenerateReference(chunk, worldSeed, VOXEL_WORLD_MIN_CHUNK_X + x, z);
+
+            size_t size = 0;
+            ok = ChunkCodec_EncodeToBuffer(chunk, encoded, CHUNK_CODEC_MAX_ENCODED_SIZE, &size) == CHUNK_CODEC_OK;
+            if (!ok) break;
+            if (cursor + size > capacity) {
+                size_t grown = capacity * 2 + size;
+                uint8_t* bigger = (uint8_t*)realloc(bytes, grown);
+                if (!bigger) {
+                    ok = false;
+                    break;
+                }
+                bytes = bigger;
+                capacity = grown;
+            }
+            memcpy(bytes + cursor, encoded, size);
+
+            uint8_t* entry = bytes + SEED_BAKE_HEADER_SIZE + (size_t)(z * SEED_BAKE_WIDTH + x) * 8;
+            PutU32(entry, (uint32_t)cursor);
+            PutU32(entry + 4, (uint32_t)size);
+            cursor += size;
+        }
+    }
+
+    if (ok) {
+        memcpy(bytes, BAKE_MAGIC, sizeof(BAKE_MAGIC));
+        PutU32(bytes + 4, SEED_BAKE_VERSION);
+        PutU32(bytes + 8, CHUNK_CODEC_VERSION);
+        PutU32(bytes + 12, (uint32_t)worldSeed);
+        PutU32(bytes + 16, (uint32_t)(worldSeed >> 32));
+        PutU32(bytes + 20, (uint32_t)VOXEL_WORLD_MIN_CHUNK_X);
+        PutU32(bytes + 24, (uint32_t)SEED_BAKE_WIDTH);
+        PutU32(bytes + 28, (uint32_t)VOXEL_WORLD_CHUNK_ROWS);
+        /* Mesma gravação atômica (temporário + rename) dos region files */
+        ok = RegionFile_WriteBytes(path, bytes, cursor);
+    }
+    if (ok && outFileSize) *outFileSize = cursor;
+
+    free(bytes);
+    free(encoded);
+    Chunk_Destroy(chunk);
+    return ok;
+}
+
+/* Índice do chunk no bake, ou -1 fora da pista. */
+static int32_t BakeIndex(int32_t chunkX, int32_t chunkZ) {
+    if (chunkX < VOXEL_WORLD_MIN_CHUNK_X || chunkX > VOXEL_WORLD_MAX_CHUNK_X) return -1;
+    if (chunkZ < 0 || chunkZ >= VOXEL_WORLD_CHUNK_ROWS) return -1;
+    return chunkZ * SEED_BAKE_WIDTH + (chunkX - VOXEL_WORLD_MIN_CHUNK_X);
+}
+
+/* Cabeçalho e índice coerentes com esta versão do jogo. */
+static bool ValidateLayout(const SeedBake* bake) {
+    const uint8_t* d = bake->data;
+    if (bake->size < SEED_BAKE_HEADER_SIZE + SEED_BAKE_INDEX_SIZE) return false;
+    if (memcmp(d, BAKE_MAGIC, sizeof(BAKE_MAGIC)) != 0) return false;
+    if (GetU32(d + 4) != SEED_BAKE_VERSION || GetU32(d + 8) != CHUNK_CODEC_VERSION) return false;
+    uint64_t seed = (uint64_t)GetU32(d + 12) | ((uint64_t)GetU32(d + 16) << 32);
+    if (seed != bake->worldSeed) return false;
+    if ((int32_t)GetU32(d + 20) != VOXEL_WORLD_MIN_CHUNK_X ||
+        (int32_t)GetU32(d + 24) != SEED_BAKE_WIDTH ||
+        (int32_t)GetU32(d + 28) != VOXEL_WORLD_CHUNK_ROWS) {
+        return false;
+    }
+
+    const uint8_t* index = d + SEED_BAKE_HEADER_SIZE;
+    for (int32_t i = 0; i < SEED_BAKE_WIDTH * VOXEL_WORLD_CHUNK_ROWS; i++) {
+        uint64_t offset = GetU32(index + i * 8);
+        uint64_t size = GetU32(index + i * 8 + 4);
+        if (size == 0 || offset < SEED_BAKE_HEADER_SIZE + SEED_BAKE_INDEX_SIZE || offset + size > bake->size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Regenera algumas amostras espalhadas pela pista: se o gerador mudou, o bake está velho. */
+static bool VerifySamples(const SeedBake* bake) {
+    Chunk* baked = Chunk_Create(0, 0, 0);
+    Chunk* live = Chunk_Create(0, 0, 0);
+    bool ok = baked && live;
+
+    for (int32_t s = 0; s < SEED_BAKE_VERIFY_SAMPLES && ok; s++) {
+        int32_t chunkZ = (VOXEL_WORLD_CHUNK_ROWS - 1) * s / (SEED_BAKE_VERIFY_SAMPLES - 1);
+        int32_t chunkX = VOXEL_WORLD_MIN_CHUNK_X + (SEED_BAKE_WIDTH - 1) * s / (SEED_BAKE_VERIFY_SAMPLES - 1);
+        baked->chunkX = chunkX;
+        baked->chunkZ = chunkZ;
+        GenerateReference(live, bake->worldSeed, chunkX, chunkZ);
+        ok = SeedBake_LoadChunk(bake, baked) && Chunk_SameBlocks(baked, live);
+    }
+
+    Chunk_Destroy(baked);
+    Chunk_Destroy(live);
+    return ok;
+}
+
+SeedBake* SeedBake_Open(const char* directory, uint64_t worldSeed) {
+    char path[512];
+    if (!SeedBake_MakePath(path, sizeof(path), directory, worldSeed)) return NULL;
+
+    FileMap* map = FileMap_Open(path);
+    if (!map) return NULL;
+
+    SeedBake* bake = (SeedBake*)calloc(1, sizeof(SeedBake));
+    if (!bake) {
+        FileMap_Close(map);
+        return NULL;
+    }
+    bake->map = map;
+    bake->data = FileMap_GetData(map);
+    bake->size = FileMap_GetSize(map);
+    bake->worldSeed = worldSeed;
+
+    if (!ValidateLayout(bake) || !VerifySamples(bake)) {
+        SeedBake_Close(bake);
+        return NULL;
+    }
+    return bake;
+}
+
+void SeedBake_Close(SeedBake* bake) {
+    if (!bake) return;
+    FileMap_Close(bake->map);
+    free(bake);
+}
+
+bool SeedBake_LoadChunk(const SeedBake* bake, Chunk* chunk) {
+    if (!bake || !chunk) return false;
+
+    int32_t chunkX = chunk->chunkX;
+    int32_t chunkZ = chunk->chunkZ;
+    int32_t index = BakeIndex(chunkX, chunkZ);
+    if (index < 0) return false;
+
+    const uint8_t* entry = bake->data + SEED_BAKE_HEADER_SIZE + (size_t)index * 8;
+    uint32_t offset = GetU32(entry);
+    uint32_t size = GetU32(entry + 4);
+    if (ChunkCodec_DecodeFromBuffer(chunk, bake->data + offset, size) == CHUNK_CODEC_OK &&
+        chunk->chunkX == chunkX && chunk->chunkZ == chunkZ) {
+        return true;
+    }
+
+    Chunk_Reset(chunk, chunkX, chunkZ, WorldSeed_GetChunkSeed(bake->worldSeed, chunkX, chunkZ));
+    return false;
+}
@@ -5,13 +5,24 @@
 #include "core/world/event_system.h"
 #include "core/world/structure_spawner.h"
 #include "core/world/world_config.h"
+#include "core/world/chunk_codec.h"
+#include "core/world/region_file.h"
+#include "core/world/world_storage.h"
+#include "core/world/seed_bake.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
 #define HASH_TABLE_SIZE 256
 
-// Hash table de chunks
+/* Persistência: salva chunks editados a cada N atualizações de streaming (~5 s a 60 FPS)
+ * e lê as regiões com antecedência na direção da corrida. */
+#define STORAGE_SAVE_INTERVAL_UPDATES  300
+#define STORAGE_PREFETCH_AHEAD_CHUNKS  REGION_SIZE_CHUNKS
+
+// Hash table de chunks. Só a thread principal insere/remove; leitores de outras
+// threads percorrem sem lock (links publicados com release, lidos com acquire) e
+// chunks removidos passam por Chunk_Retire em vez de Chunk_Destroy.
 typedef struct {
     Chunk* buckets[HASH_TABLE_SIZE];
 } ChunkHashTable;
@@ -23,23 +34,41 @@ struct VoxelWorld {
     ChunkHashTable chunks;  // Hash table de chunks
     int32_t loadedChunkCount;
     int32_t generatingChunkCount;
+    uint32_t version;       // Atômico: sobe a cada chunk carregado/descarregado/editado
+    
+    /* Persistência (NULL = desligada) */
+    WorldStorage* storage;
+    char saveRoot[256];
+    uint8_t* encodeBuffer;  // CHUNK_CODEC_MAX_ENCODED_SIZE
+    int32_t updatesSinceSave;
+    int32_t prefetchMinRX, prefetchMaxRX, prefetchMinRZ, prefetchMaxRZ;
+    bool prefetchValid;
+    
+    /* Pista pré-gerada (NULL = gerar ao vivo) */
+    SeedBake* bake;
+    char bakeDir[256];
 };
 
+// Só o dono do mundo (quem carrega/edita) chama; leitores em outras threads veem o valor novo
+static inline void VoxelWorld_Touch(VoxelWorld* world) {
+    __atomic_add_fetch(&world->version, 1u, __ATOMIC_RELEASE);
+}
+
 static uint32_t ChunkHash_GetHash(int32_t chunkX, int32_t chunkZ) {
     // Hash simples baseado em coordenadas
     uint32_t h = (uint32_t)(chunkX * 73856093) ^ (uint32_t)(chunkZ * 19349663);
     return h % HASH_TABLE_SIZE;
 }
 
-static Chunk* ChunkHash_Find(ChunkHashTable* table, int32_t chunkX, int32_t chunkZ) {
+static Chunk* ChunkHash_Find(const ChunkHashTable* table, int32_t chunkX, int32_t chunkZ) {
     uint32_t hash = ChunkHash_GetHash(chunkX, chunkZ);
-    Chunk* chunk = table->buckets[hash];
+    Chunk* chunk = __atomic_load_n(&table->buckets[hash], __ATOMIC_ACQUIRE);
     
     while (chunk) {
         if (chunk->chunkX == chunkX && chunk->chunkZ == chunkZ) {
             return chunk;
         }
-        chunk = chunk->next;
+        chunk = __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE);
     }
     
     return NULL;
@@ -48,7 +77,13 @@ static Chunk* ChunkHash_Find(ChunkHashTable* table, int32_t chunkX, int32_t chun
 static void ChunkHash_Insert(ChunkHashTable* table, Chunk* chunk) {
     uint32_t hash = ChunkHash_GetHash(chunk->chunkX, chunk->chunkZ);
     chunk->next = table->buckets[hash];
-    table->buckets[hash] = chunk;
+    __atomic_store_n(&table->buckets[hash], chunk, __ATOMIC_RELEASE); /* publica já inicializado */
+}
+
+/* Desliga o chunk da lista; `next` dele fica intacto para leitores que estão passando por ele. */
+static void ChunkHash_Unlink(ChunkHashTable* table, uint32_t hash, Chunk* prev, Chunk* chunk) {
+    if (prev) __atomic_store_n(&prev->next, chunk->next, __ATOMIC_RELEASE);
+    else __atomic_store_n(&table->buckets[hash], chunk->next, __ATOMIC_RELEASE);
 }
 
 static void ChunkHash_Remove(ChunkHashTable* table, int32_t chunkX, int32_t chunkZ) {
@@ -58,12 +93,8 @@ static void ChunkHash_Remove(ChunkHashTable* table, int32_t chunkX, int32_t chun
     
     while (chunk) {
         if (chunk->chunkX == chunkX && chunk->chunkZ == chunkZ) {
-            if (prev) {
-                prev->next = chunk->next;
-            } else {
-                table->buckets[hash] = chunk->next;
-            }
-            Chunk_Destroy(chunk);
+            ChunkHash_Unlink(table, hash, prev, chunk);
+            Chunk_Retire(chunk);
             return;
         }
         prev = chunk;
@@ -71,6 +102,94 @@ static void ChunkHash_Remove(ChunkHashTable* table, int32_t chunkX, int32_t chun
     }
 }
 
+/* Remove e aposenta todos os chunks. */
+static void ChunkHash_Clear(ChunkHashTable* table) {
+    for (uint32_t i = 0; i < HASH_TABLE_SIZE; i++) {
+        Chunk* chunk = table->buckets[i];
+        __atomic_store_n(&table->buckets[i], NULL, __ATOMIC_RELEASE);
+        while (chunk) {
+            Chunk* next = chunk->next;
+            Chunk_Retire(chunk);
+            chunk = next;
+        }
+    }
+}
+
+/* Enfileira o chunk para gravação se foi editado (thread de I/O decide se difere da seed). */
+static void VoxelWorld_StoreChunk(VoxelWorld* world, Chunk* chunk) {
+    if (!world->storage || !chunk->dirty) return;
+    
+    size_t size = 0;
+    if (ChunkCodec_EncodeToBuffer(chunk, world->encodeBuffer, CHUNK_CODEC_MAX_ENCODED_SIZE, &size) != CHUNK_CODEC_OK) return;
+    uint8_t* blob = (uint8_t*)malloc(size);
+    if (!blob) return;
+    memcpy(blob, world->encodeBuffer, size);
+    WorldStorage_SaveChunk(world->storage, chunk->chunkX, chunk->chunkZ, blob, (uint32_t)size);
+    chunk->dirty = false;
+    Chunk_InternSections(chunk);  /* congela as cópias privadas das edições */
+}
+
+static void VoxelWorld_StoreAllChunks(VoxelWorld* world) {
+    if (!world->storage) return;
+    for (int i = 0; i < HASH_TABLE_SIZE; i++) {
+        for (Chunk* chunk = world->chunks.buckets[i]; chunk; chunk = chunk->next) {
+            VoxelWorld_StoreChunk(world, chunk);
+        }
+    }
+}
+
+/* Conteúdo salvo se houver; senão bake da seed ou geração ao vivo. Região ainda no disco → gera e reaplica depois. */
+static void VoxelWorld_LoadOrGenerateChunk(VoxelWorld* world, Chunk* chunk, const ChunkGenContext* ctx) {
+    StorageChunkStatus status = world->storage ? WorldStorage_LoadChunk(world->storage, chunk) : STORAGE_CHUNK_PRISTINE;
+    if (status != STORAGE_CHUNK_EDITED) {
+        if (!world->bake || !SeedBake_LoadChunk(world->bake, chunk)) {
+            VoxelWorld_GenerateChunk(world, chunk, ctx);
+        }
+    }
+    chunk->dirty = false;  /* geração não é edição */
+    chunk->storagePending = (status == STORAGE_CHUNK_PENDING);
+}
+
+/* Regiões chegaram do disco: reaplica edições em chunks gerados enquanto esperavam. */
+static void VoxelWorld_ResolvePendingChunks(VoxelWorld* world) {
+    if (!world->storage || !WorldStorage_PollRegionsLoaded(world->storage)) return;
+    
+    for (int i = 0; i < HASH_TABLE_SIZE; i++) {
+        for (Chunk* chunk = world->chunks.buckets[i]; chunk; chunk = chunk->next) {
+            if (!chunk->storagePending) continue;
+            if (chunk->dirty) {
+                chunk->storagePending = false;  /* editado no meio tempo: a versão atual vence */
+                continue;
+            }
+            chunk->storagePending = (WorldStorage_LoadChunk(world->storage, chunk) == STORAGE_CHUNK_PENDING);
+        }
+    }
+}
+
+static void VoxelWorld_PrefetchRegions(VoxelWorld* world, int32_t minChunkX, int32_t maxChunkX, int32_t minChunkZ, int32_t maxChunkZ) {
+    if (!world->storage) return;
+    
+    int32_t minRX = Region_FromChunk(minChunkX);
+    int32_t maxRX = Region_FromChunk(maxChunkX);
+    int32_t minRZ = Region_FromChunk(minChunkZ);
+    int32_t maxRZ = Region_FromChunk(maxChunkZ + STORAGE_PREFETCH_AHEAD_CHUNKS);
+    if (world->prefetchValid && minRX == world->prefetchMinRX && maxRX == world->prefetchMaxRX &&
+        minRZ == world->prefetchMinRZ && maxRZ == world->prefetchMaxRZ) {
+        return;
+    }
+    world->prefetchMinRX = minRX;
+    world->prefetchMaxRX = maxRX;
+    world->prefetchMinRZ = minRZ;
+    world->prefetchMaxRZ = maxRZ;
+    world->prefetchValid = true;
+    
+    for (int32_t rz = minRZ; rz <= maxRZ; rz++) {
+        for (int32_t rx = minRX; rx <= maxRX; rx++) {
+            WorldStorage_PrefetchRegion(world->storage, rx, rz);
+        }
+    }
+}
+
 VoxelWorld* VoxelWorld_Create(const char* seedString) {
     VoxelWorld* world = (VoxelWorld*)calloc(1, sizeof(VoxelWorld));
     if (!world) return NULL;
@@ -93,15 +212,15 @@ VoxelWorld* VoxelWorld_Create(const char* seedString) {
 void VoxelWorld_Destroy(VoxelWorld* world) {
     if (!world) return;
     
-    // Destrói todos os chunks
-    for (int i = 0; i < HASH_TABLE_SIZE; i++) {
-        Chunk* chunk = world->chunks.buckets[i];
-        while (chunk) {
-            Chunk* next = chunk->next;
-            Chunk_Destroy(chunk);
-            chunk = next;
-        }
-    }
+    // Salva o que foi editado (a thread de I/O termina a fila antes de sair)
+    VoxelWorld_StoreAllChunks(world);
+    WorldStorage_Destroy(world->storage);
+    free(world->encodeBuffer);
+    SeedBake_Close(world->bake);
+    
+    // Destrói todos os chunks (espera leitores de outras threads largarem os ponteiros)
+    ChunkHash_Clear(&world->chunks);
+    Chunk_CollectRetired(true);
     
     free(world);
 }
@@ -109,21 +228,56 @@ void VoxelWorld_Destroy(VoxelWorld* world) {
 void VoxelWorld_SetSeed(VoxelWorld* world, const char* seedString) {
     if (!world || !seedString) return;
     
+    // Edições pertencem à seed antiga: grava e troca de diretório
+    VoxelWorld_StoreAllChunks(world);
+    if (world->storage) {
+        WorldStorage_Destroy(world->storage);
+        world->storage = NULL;
+    }
+    SeedBake_Close(world->bake);
+    world->bake = NULL;
+    
     strncpy(world->seedString, seedString, sizeof(world->seedString) - 1);
     world->globalSeed = WorldSeed_StringToU64(seedString);
     
     // Limpa chunks existentes (seed mudou)
-    for (int i = 0; i < HASH_TABLE_SIZE; i++) {
-        Chunk* chunk = world->chunks.buckets[i];
-        while (chunk) {
-            Chunk* next = chunk->next;
-            Chunk_Destroy(chunk);
-            chunk = next;
-        }
-        world->chunks.buckets[i] = NULL;
-    }
+    ChunkHash_Clear(&world->chunks);
     world->loadedChunkCount = 0;
     world->generatingChunkCount = 0;
+    VoxelWorld_Touch(world);
+    
+    world->prefetchValid = false;
+    if (world->saveRoot[0]) {
+        world->storage = WorldStorage_Create(world->saveRoot, world->globalSeed);
+    }
+    if (world->bakeDir[0]) {
+        world->bake = SeedBake_Open(world->bakeDir, world->globalSeed);
+    }
+}
+
+bool VoxelWorld_UseSeedBake(VoxelWorld* world, const char* bakeDir) {
+    if (!world || !bakeDir) return false;
+    
+    strncpy(world->bakeDir, bakeDir, sizeof(world->bakeDir) - 1);
+    SeedBake_Close(world->bake);
+    world->bake = SeedBake_Open(world->bakeDir, world->globalSeed);
+    return world->bake != NULL;
+}
+
+bool VoxelWorld_EnablePersistence(VoxelWorld* world, const char* saveRoot) {
+    if (!world || !saveRoot) return false;
+    if (world->storage) return true;
+    
+    if (!world->encodeBuffer) {
+        world->encodeBuffer = (uint8_t*)malloc(CHUNK_CODEC_MAX_ENCODED_SIZE);
+        if (!world->encodeBuffer) return false;
+    }
+    world->storage = WorldStorage_Create(saveRoot, world->globalSeed);
+    if (!world->storage) return false;
+    
+    strncpy(world->saveRoot, saveRoot, sizeof(world->saveRoot) - 1);
+    world->prefetchValid = false;
+    return true;
 }
 
 uint64_t VoxelWorld_GetSeedU64(VoxelWorld* world) {
@@ -142,13 +296,11 @@ Chunk* VoxelWorld_GetChunk(VoxelWorld* world, int32_t chunkX, int32_t chunkZ) {
     chunk = Chunk_Create(chunkX, chunkZ, chunkSeed);
     if (!chunk) return NULL;
     
+    // Marca como pronto (geração será feita depois) antes de publicar para leitores
+    __atomic_store_n(&chunk->state, CHUNK_STATE_READY, __ATOMIC_RELEASE);
     ChunkHash_Insert(&world->chunks, chunk);
     world->loadedChunkCount++;
-    world->generatingChunkCount++;
-    
-    // Marca como pronto (geração será feita depois)
-    chunk->state = CHUNK_STATE_READY;
-    world->generatingChunkCount--;
+    VoxelWorld_Touch(world);
     
     return chunk;
 }
@@ -158,8 +310,10 @@ void VoxelWorld_UnloadChunk(VoxelWorld* world, int32_t chunkX, int32_t chunkZ) {
     
     Chunk* chunk = ChunkHash_Find(&world->chunks, chunkX, chunkZ);
     if (chunk) {
+        VoxelWorld_StoreChunk(world, chunk);
         ChunkHash_Remove(&world->chunks, chunkX, chunkZ);
         world->loadedChunkCount--;
+        VoxelWorld_Touch(world);
     }
 }
 
@@ -190,6 +344,7 @@ void VoxelWorld_SetBlock(VoxelWorld* world, int32_t x, int32_t y, int32_t z, Vox
     Chunk* chunk = VoxelWorld_GetChunk(world, chunkX, chunkZ);
     if (chunk) {
         Chunk_SetBlock(chunk, localX, localY, localZ, voxel);
+        VoxelWorld_Touch(world);
     }
 }
 
@@ -236,8 +391,8 @@ void VoxelWorld_UpdateStreamingFromRange(VoxelWorld* world, int32_t minMacroZ, i
     /* StreamingController usa chunks macro 32 m. Voxel chunk = 16 m → 1 macro = 2 voxel. */
     int32_t minVoxelZ = minMacroZ * 2;
     int32_t maxVoxelZ = maxMacroZ * 2 + 1; /* inclusivo; cobre o último macro */
-    if (maxVoxelZ > (CHUNKS_LONG * CHUNK_SIZE_M / CHUNK_SIZE_Z) - 1) {
-        maxVoxelZ = (CHUNKS_LONG * CHUNK_SIZE_M / CHUNK_SIZE_Z) - 1;
+    if (maxVoxelZ > VOXEL_WORLD_CHUNK_ROWS - 1) {
+        maxVoxelZ = VOXEL_WORLD_CHUNK_ROWS - 1;
     }
     
     /* Centro do corredor: mundo [-500..+500] → centerVX = floor((centerX_m + 500) / 16); hash -32..31 = centerVX - 31. */
@@ -247,20 +402,24 @@ void VoxelWorld_UpdateStreamingFromRange(VoxelWorld* world, int32_t minMacroZ, i
     int32_t centerChunkX = centerVX_0_62 - WORLD_X_CENTER_CHUNK_OFFSET; /* nosso hash: centro = 0 */
     int32_t minVoxelX = centerChunkX - STREAM_CORRIDOR_HALF_VOXEL_CHUNKS;
     int32_t maxVoxelX = centerChunkX + STREAM_CORRIDOR_HALF_VOXEL_CHUNKS;
-    if (minVoxelX < -32) minVoxelX = -32;
-    if (maxVoxelX > 31) maxVoxelX = 31;
+    if (minVoxelX < VOXEL_WORLD_MIN_CHUNK_X) minVoxelX = VOXEL_WORLD_MIN_CHUNK_X;
+    if (maxVoxelX > VOXEL_WORLD_MAX_CHUNK_X) maxVoxelX = VOXEL_WORLD_MAX_CHUNK_X;
+    
+    /* 0) Persistência: reaplica regiões que chegaram, pede as próximas e salva periodicamente */
+    if (world->storage) {
+        VoxelWorld_ResolvePendingChunks(world);
+        VoxelWorld_PrefetchRegions(world, minVoxelX, maxVoxelX, minVoxelZ, maxVoxelZ);
+        if (++world->updatesSinceSave >= STORAGE_SAVE_INTERVAL_UPDATES) {
+            world->updatesSinceSave = 0;
+            VoxelWorld_StoreAllChunks(world);
+        }
+    }
     
     /* 1) Carregar/gerar chunks na faixa [minVoxelX..maxVoxelX] x [minVoxelZ..maxVoxelZ] */
     for (int32_t vz = minVoxelZ; vz <= maxVoxelZ; vz++) {
-        int32_t macroChunkZ = vz / 2;
-        float corridorCenterX = SegmentManager_GetCorridorCenterX(world->globalSeed, macroChunkZ);
-        SegmentType segType = SegmentManager_GetTypeByChunkZ(macroChunkZ);
-        int32_t segmentIndex = SegmentManager_GetSegmentIndex(macroChunkZ);
-        SegmentEventType eventType = EventSystem_GetEventForSegment(world->globalSeed, segmentIndex);
-        LargeStructureType structType = LARGE_STRUCT_NONE;
-        if (StructureSpawner_ShouldSpawnAtChunk(world->globalSeed, macroChunkZ)) {
-            structType = StructureSpawner_GetTypeAtChunk(world->globalSeed, macroChunkZ);
-        }
+        /* Contexto só depende da linha Z (macro chunk); calcula uma vez por linha. */
+        ChunkGenContext ctx;
+        VoxelWorld_BuildGenContext(world, minVoxelX, vz, &ctx);
         
         for (int32_t vx = minVoxelX; vx <= maxVoxelX; vx++) {
             Chunk* chunk = ChunkHash_Find(&world->chunks, vx, vz);
@@ -268,23 +427,16 @@ void VoxelWorld_UpdateStreamingFromRange(VoxelWorld* world, int32_t minMacroZ, i
                 uint64_t chunkSeed = WorldSeed_GetChunkSeed(world->globalSeed, vx, vz);
                 chunk = Chunk_Create(vx, vz, chunkSeed);
                 if (!chunk) continue;
-                ChunkHash_Insert(&world->chunks, chunk);
-                world->loadedChunkCount++;
                 world->generatingChunkCount++;
                 
-                ChunkGenContext ctx = {
-                    .worldSeed = world->globalSeed,
-                    .chunkX = vx,
-                    .chunkZ = vz,
-                    .segType = segType,
-                    .corridorCenterX_m = corridorCenterX,
-                    .eventType = eventType,
-                    .structType = structType,
-                    .threatLevel = 0.0f,
-                };
-                VoxelWorld_GenerateChunk(world, chunk, &ctx);
-                chunk->state = CHUNK_STATE_READY;
+                /* Gera antes de inserir: leitores concorrentes só veem chunks prontos */
+                ctx.chunkX = vx;
+                VoxelWorld_LoadOrGenerateChunk(world, chunk, &ctx);
+                __atomic_store_n(&chunk->state, CHUNK_STATE_READY, __ATOMIC_RELEASE);
                 world->generatingChunkCount--;
+                ChunkHash_Insert(&world->chunks, chunk);
+                world->loadedChunkCount++;
+                VoxelWorld_Touch(world);
             }
         }
     }
@@ -301,18 +453,60 @@ void VoxelWorld_UpdateStreamingFromRange(VoxelWorld* world, int32_t minMacroZ, i
             int32_t outZ = (vz < minVoxelZ || vz > maxVoxelZ);
             int32_t outX = (vx < minVoxelX || vx > maxVoxelX);
             if (!isPlayerChunk && (outZ || outX)) {
-                if (prev) prev->next = next;
-                else world->chunks.buckets[i] = next;
-                Chunk_Destroy(chunk);
+                ChunkHash_Unlink(&world->chunks, (uint32_t)i, prev, chunk);
+                VoxelWorld_StoreChunk(world, chunk);
+                Chunk_Retire(chunk);  /* leitores concorrentes podem estar com ele */
                 world->loadedChunkCount--;
+                VoxelWorld_Touch(world);
                 chunk = next;
-                prev = prev; /* prev unchanged when we remove */
             } else {
                 prev = chunk;
                 chunk = next;
             }
         }
     }
+    
+    /* 3) Libera chunks aposentados que nenhum leitor enxerga mais */
+    Chunk_CollectRetired(false);
+}
+
+int32_t VoxelWorld_ReadBegin(void) {
+    return Chunk_ReadBegin();
+}
+
+void VoxelWorld_ReadEnd(int32_t guard) {
+    Chunk_ReadEnd(guard);
+}
+
+Chunk* VoxelWorld_FindChunk(const VoxelWorld* world, int32_t chunkX, int32_t chunkZ) {
+    if (!world) return NULL;
+    return ChunkHash_Find(&world->chunks, chunkX, chunkZ);
+}
+
+void VoxelWorld_BuildGenContext(const VoxelWorld* world, int32_t chunkX, int32_t chunkZ, ChunkGenContext* outCtx) {
+    if (!world) return;
+    VoxelWorld_BuildGenContextForSeed(world->globalSeed, chunkX, chunkZ, outCtx);
+}
+
+void VoxelWorld_BuildGenContextForSeed(uint64_t worldSeed, int32_t chunkX, int32_t chunkZ, ChunkGenContext* outCtx) {
+    if (!outCtx) return;
+    
+    /* Voxel chunk = 16 m; macro chunk (segmentos/eventos/estruturas) = 32 m. */
+    int32_t macroChunkZ = chunkZ / 2;
+    int32_t segmentIndex = SegmentManager_GetSegmentIndex(macroChunkZ);
+    LargeStructureType structType = LARGE_STRUCT_NONE;
+    if (StructureSpawner_ShouldSpawnAtChunk(worldSeed, macroChunkZ)) {
+        structType = StructureSpawner_GetTypeAtChunk(worldSeed, macroChunkZ);
+    }
+    
+    outCtx->worldSeed = worldSeed;
+    outCtx->chunkX = chunkX;
+    outCtx->chunkZ = chunkZ;
+    outCtx->segType = SegmentManager_GetTypeByChunkZ(macroChunkZ);
+    outCtx->corridorCenterX_m = SegmentManager_GetCorridorCenterX(worldSeed, macroChunkZ);
+    outCtx->eventType = EventSystem_GetEventForSegment(worldSeed, segmentIndex);
+    outCtx->structType = structType;
+    outCtx->threatLevel = 0.0f;
 }
 
 /* Mundo X = [-500..+500] m. vx (chunk -32..31) → worldX = (vx+32)*16 + localX + 0.5 - 500. */
@@ -381,6 +575,9 @@ void VoxelWorld_GenerateChunk(VoxelWorld* vw, Chunk* c, const ChunkGenContext* c
             Chunk_SetBlock(c, localX, 0, localZ, floor);
         }
     }
+    
+    /* Chão costuma ser de poucos tipos: seções iguais viram uma só, compartilhada */
+    Chunk_InternSections(c);
 }
 
 void VoxelWorld_GetStats(VoxelWorld* world, int32_t* loadedChunks, int32_t* generatingChunks) {
@@ -393,3 +590,20 @@ void VoxelWorld_GetStats(VoxelWorld* world, int32_t* loadedChunks, int32_t* gene
     if (loadedChunks) *loadedChunks = world->loadedChunkCount;
     if (generatingChunks) *generatingChunks = world->generatingChunkCount;
 }
+
+uint32_t VoxelWorld_GetVersion(const VoxelWorld* world) {
+    if (!world) return 0;
+    return __atomic_load_n(&world->version, __ATOMIC_ACQUIRE);
+}
+
+void VoxelWorld_GetSectionStats(int32_t* referencedSections, int32_t* storedSections, float* dedupRatio) {
+    int32_t referenced = 0, unique = 0, privateCount = 0;
+    Chunk_GetSectionStats(&referenced, &unique, &privateCount);
+    
+    /* Privadas contam dos dois lados (uma referência, uma cópia) */
+    int32_t logical = referenced + privateCount;
+    int32_t stored = unique + privateCount;
+    if (referencedSections) *referencedSections = logical;
+    if (storedSections) *storedSections = stored;
+    if (dedupRatio) *dedupRatio = (stored > 0) ? (float)logical / (float)stored : 1.0f;
+}
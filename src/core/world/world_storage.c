@@ -0,0 +1,464 @@
+#include "core/world/world_storage.h"
+#include "core/world/region_file.h"
+#include "core/world/chunk.h"
+#include "core/world/chunk_codec.h"
+#include "core/world/voxel_world.h"
+#include "core/world/world_seed.h"
+#include "core/thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STORAGE_MAX_REGIONS     32   /* Regiões em memória (LRU; ~12 KB de índice cada) */
+#define STORAGE_PREFETCH_QUEUE  64
+#define STORAGE_RETRY_MS        500  /* Espera entre gravações com o disco falhando */
+
+typedef enum {
+    REGION_SLOT_FREE = 0,
+    REGION_SLOT_LOADING,        /* Só a thread de I/O mexe */
+    REGION_SLOT_RESIDENT
+} RegionSlotState;
+
+typedef struct RegionSlot {
+    RegionSlotState state;
+    bool dirty;                 /* Difere do arquivo em disco */
+    uint32_t lastUse;
+    RegionData data;
+} RegionSlot;
+
+/* Save enfileirado. Fica na lista até ser instalado na região, então as
+ * consultas da thread principal continuam enxergando a versão mais nova. */
+typedef struct PendingSave {
+    int32_t chunkX, chunkZ;
+    uint8_t* blob;
+    uint32_t size;
+    struct PendingSave* next;
+} PendingSave;
+
+struct WorldStorage {
+    char directory[512];
+    uint64_t worldSeed;
+
+    Mutex* lock;
+    CondVar* wake;
+    Thread* thread;
+    bool quit;
+
+    /* Tudo abaixo é protegido por `lock` */
+    PendingSave* pendingHead;   /* mais antigo */
+    PendingSave* pendingTail;   /* mais novo */
+    int32_t pendingCount;
+    RegionSlot regions[STORAGE_MAX_REGIONS];
+    uint32_t useClock;
+    int32_t prefetchX[STORAGE_PREFETCH_QUEUE];
+    int32_t prefetchZ[STORAGE_PREFETCH_QUEUE];
+    int32_t prefetchHead, prefetchCount;
+    bool regionsLoaded;
+    WorldStorageStats stats;
+    Chunk* decodeScratch;       /* LoadChunk (thread principal, sob lock) */
+
+    /* Só a thread de I/O */
+    Chunk* ioDecoded;
+    Chunk* ioReference;
+};
+
+static int32_t FindRegion(const WorldStorage* storage, int32_t regionX, int32_t regionZ) {
+    for (int32_t i = 0; i < STORAGE_MAX_REGIONS; i++) {
+        const RegionSlot* slot = &storage->regions[i];
+        if (slot->state != REGION_SLOT_FREE &&
+            slot->data.regionX == regionX && slot->data.regionZ == regionZ) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void QueuePrefetch(WorldStorage* storage, int32_t regionX, int32_t regionZ) {
+    for (int32_t i = 0; i < storage->prefetchCount; i++) {
+        int32_t q = (storage->prefetchHead + i) % STORAGE_PREFETCH_QUEUE;
+        if (storage->prefetchX[q] == regionX && storage->prefetchZ[q] == regionZ) return;
+    }
+    if (storage->prefetchCount >= STORAGE_PREFETCH_QUEUE) return; /* será pedido de novo */
+    int32_t tail = (storage->prefetchHead + storage->prefetchCount) % STORAGE_PREFETCH_QUEUE;
+    storage->prefetchX[tail] = regionX;
+    storage->prefetchZ[tail] = regionZ;
+    storage->prefetchCount++;
+    CondVar_Signal(storage->wake);
+}
+
+/* Decodifica um blob e confere se é mesmo o chunk esperado. */
+static bool DecodeBlob(Chunk* out, const uint8_t* blob, uint32_t size, int32_t chunkX, int32_t chunkZ) {
+    if (ChunkCodec_DecodeFromBuffer(out, blob, size) != CHUNK_CODEC_OK) return false;
+    return out->chunkX == chunkX && out->chunkZ == chunkZ;
+}
+
+/* ---------------------------------------------------------------------------
+ * Thread de I/O. Funções abaixo são chamadas com `lock` travado e o soltam
+ * durante acesso a disco/trabalho pesado.
+ * --------------------------------------------------------------------------- */
+
+static void WriteRegion(WorldStorage* storage, int32_t index) {
+    RegionSlot* slot = &storage->regions[index];
+    size_t size = 0;
+    uint8_t* bytes = RegionFile_Serialize(&slot->data, &size);
+    if (!bytes && slot->data.chunkCount > 0) return; /* sem memória: tenta no próximo ciclo */
+
+    char path[600];
+    if (!RegionFile_MakePath(path, sizeof(path), storage->directory, slot->data.regionX, slot->data.regionZ)) {
+        free(bytes);
+        slot->dirty = false;
+        return;
+    }
+    slot->dirty = false;
+
+    Mutex_Unlock(storage->lock);
+    bool ok = RegionFile_WriteBytes(path, bytes, size);
+    free(bytes);
+    Mutex_Lock(storage->lock);
+
+    if (ok) storage->stats.regionWrites++;
+    else slot->dirty = true;
+}
+
+/* Garante a região em memória; despeja a menos usada (gravando se suja). -1 se a
+   única opção é uma região suja que não grava: ela fica em memória com as edições. */
+static int32_t AcquireRegion(WorldStorage* storage, int32_t regionX, int32_t regionZ) {
+    int32_t index = FindRegion(storage, regionX, regionZ);
+    if (index >= 0) {
+        storage->regions[index].lastUse = ++storage->useClock;
+        return index;
+    }
+
+    int32_t victim = -1;
+    for (int32_t i = 0; i < STORAGE_MAX_REGIONS && victim < 0; i++) {
+        if (storage->regions[i].state == REGION_SLOT_FREE) victim = i;
+    }
+    for (int32_t pass = 0; pass < 2 && victim < 0; pass++) {
+        /* 1ª passada: só limpas; 2ª: qualquer uma (grava antes) */
+        uint32_t oldest = UINT32_MAX;
+        for (int32_t i = 0; i < STORAGE_MAX_REGIONS; i++) {
+            RegionSlot* slot = &storage->regions[i];
+            if (slot->state != REGION_SLOT_RESIDENT) continue;
+            if (pass == 0 && slot->dirty) continue;
+            if (slot->lastUse < oldest) {
+                oldest = slot->lastUse;
+                victim = i;
+            }
+        }
+    }
+    if (victim < 0) return -1;
+
+    RegionSlot* slot = &storage->regions[victim];
+    if (slot->state == REGION_SLOT_RESIDENT && slot->dirty) {
+        WriteRegion(storage, victim);
+        if (slot->dirty) {
+            printf("[STORAGE] Falha ao gravar a regiao (%d, %d); mantida em memoria\n",
+                   slot->data.regionX, slot->data.regionZ);
+            return -1;
+        }
+    }
+
+    RegionData_Clear(&slot->data);
+    RegionData_Init(&slot->data, regionX, regionZ);
+    slot->state = REGION_SLOT_LOADING;
+    slot->dirty = false;
+
+    char path[600];
+    bool havePath = RegionFile_MakePath(path, sizeof(path), storage->directory, regionX, regionZ);
+
+    Mutex_Unlock(storage->lock);
+    /* Arquivo corrompido → região vazia (chunks voltam ao gerado pela seed) */
+    if (havePath) RegionFile_Read(path, &slot->data);
+    Mutex_Lock(storage->lock);
+
+    slot->state = REGION_SLOT_RESIDENT;
+    slot->lastUse = ++storage->useClock;
+    storage->stats.regionReads++;
+    storage->regionsLoaded = true;
+    return victim;
+}
+
+/* Instala o save mais antigo na sua região. Igual ao gerado → slot removido.
+   false = nenhuma região pôde ser despejada (disco falhando): o save fica na fila. */
+static bool ProcessOldestSave(WorldStorage* storage) {
+    PendingSave* save = storage->pendingHead;
+    int32_t index = AcquireRegion(storage, Region_FromChunk(save->chunkX), Region_FromChunk(save->chunkZ));
+    if (index < 0 && !storage->quit) return false;
+
+    /* O blob não muda enquanto está na fila: compara fora do lock */
+    Mutex_Unlock(storage->lock);
+    bool valid = DecodeBlob(storage->ioDecoded, save->blob, save->size, save->chunkX, save->chunkZ);
+    bool pristine = false;
+    if (valid) {
+        ChunkGenContext ctx;
+        uint64_t chunkSeed = WorldSeed_GetChunkSeed(storage->worldSeed, save->chunkX, save->chunkZ);
+        Chunk_Reset(storage->ioReference, save->chunkX, save->chunkZ, chunkSeed);
+        VoxelWorld_BuildGenContextForSeed(storage->worldSeed, save->chunkX, save->chunkZ, &ctx);
+        VoxelWorld_GenerateChunk(NULL, storage->ioReference, &ctx);
+        pristine = Chunk_SameBlocks(storage->ioDecoded, storage->ioReference);
+    }
+    Mutex_Lock(storage->lock);
+
+    if (index >= 0 && valid) {
+        RegionSlot* slot = &storage->regions[index];
+        int32_t chunkSlot = Region_SlotIndex(save->chunkX, save->chunkZ);
+        if (pristine) {
+            if (slot->data.blobs[chunkSlot]) {
+                RegionData_SetChunk(&slot->data, chunkSlot, NULL, 0);
+                slot->dirty = true;
+            }
+            free(save->blob);
+            storage->stats.chunksPristine++;
+        } else {
+            RegionData_SetChunk(&slot->data, chunkSlot, save->blob, save->size);
+            slot->dirty = true;
+            storage->stats.chunksStored++;
+        }
+    } else {
+        if (index < 0) {
+            printf("[STORAGE] Edicoes do chunk (%d, %d) perdidas: disco falhando no encerramento\n",
+                   save->chunkX, save->chunkZ);
+        }
+        free(save->blob);
+    }
+
+    storage->pendingHead = save->next;
+    if (!storage->pendingHead) storage->pendingTail = NULL;
+    storage->pendingCount--;
+    free(save);
+    return true;
+}
+
+/* Disco falhando: espera antes de tentar de novo, sem segurar o lock */
+static void StorageThread_Backoff(WorldStorage* storage) {
+    Mutex_Unlock(storage->lock);
+    Thread_Sleep(STORAGE_RETRY_MS);
+    Mutex_Lock(storage->lock);
+}
+
+static void StorageThread_Main(void* userData) {
+    WorldStorage* storage = (WorldStorage*)userData;
+
+    Mutex_Lock(storage->lock);
+    for (;;) {
+        if (storage->pendingHead) {
+            if (!ProcessOldestSave(storage)) StorageThread_Backoff(storage);
+            continue;
+        }
+        if (storage->prefetchCount > 0 && !storage->quit) {
+            int32_t regionX = storage->prefetchX[storage->prefetchHead];
+            int32_t regionZ = storage->prefetchZ[storage->prefetchHead];
+            storage->prefetchHead = (storage->prefetchHead + 1) % STORAGE_PREFETCH_QUEUE;
+            storage->prefetchCount--;
+            AcquireRegion(storage, regionX, regionZ);
+            continue;
+        }
+
+        /* Fila vazia: grava o que ficou sujo */
+        int32_t dirtyIndex = -1;
+        for (int32_t i = 0; i < STORAGE_MAX_REGIONS && dirtyIndex < 0; i++) {
+            if (storage->regions[i].state == REGION_SLOT_RESIDENT && storage->regions[i].dirty) dirtyIndex = i;
+        }
+        if (dirtyIndex >= 0) {
+            WriteRegion(storage, dirtyIndex);
+            if (!storage->regions[dirtyIndex].dirty) continue;
+            if (!storage->quit) {
+                StorageThread_Backoff(storage);
+                continue;
+            }
+            /* Disco falhando no encerramento: desiste, avisando o que se perde */
+            for (int32_t i = 0; i < STORAGE_MAX_REGIONS; i++) {
+                const RegionSlot* slot = &storage->regions[i];
+                if (slot->state != REGION_SLOT_RESIDENT || !slot->dirty) continue;
+                printf("[STORAGE] Edicoes da regiao (%d, %d) perdidas: disco falhando no encerramento\n",
+                       slot->data.regionX, slot->data.regionZ);
+            }
+            break;
+        }
+
+        if (storage->quit) break;
+        CondVar_Wait(storage->wake, storage->lock);
+    }
+    Mutex_Unlock(storage->lock);
+}
+
+/* ---------------------------------------------------------------------------
+ * API (thread principal)
+ * --------------------------------------------------------------------------- */
+
+WorldStorage* WorldStorage_Create(const char* saveRoot, uint64_t worldSeed) {
+    if (!saveRoot || !saveRoot[0]) return NULL;
+
+    WorldStorage* storage = (WorldStorage*)calloc(1, sizeof(WorldStorage));
+    if (!storage) return NULL;
+
+    storage->worldSeed = worldSeed;
+    int n = snprintf(storage->directory, sizeof(storage->directory), "%s/%016llx",
+                     saveRoot, (unsigned long long)worldSeed);
+    if (n <= 0 || (size_t)n >= sizeof(storage->directory) ||
+        !RegionFile_EnsureDirectory(saveRoot) ||
+        !RegionFile_EnsureDirectory(storage->directory)) {
+        free(storage);
+        return NULL;
+    }
+
+    storage->lock = Mutex_Create();
+    storage->wake = CondVar_Create();
+    storage->decodeScratch = Chunk_Create(0, 0, 0);
+    storage->ioDecoded = Chunk_Create(0, 0, 0);
+    storage->ioReference = Chunk_Create(0, 0, 0);
+    if (storage->lock && storage->wake && storage->decodeScratch && storage->ioDecoded && storage->ioReference) {
+        storage->thread = Thread_Create(StorageThread_Main, storage);
+    }
+    if (!storage->thread) {
+        Chunk_Destroy(storage->decodeScratch);
+        Chunk_Destroy(storage->ioDecoded);
+        Chunk_Destroy(storage->ioReference);
+        if (storage->wake) CondVar_Destroy(storage->wake);
+        if (storage->lock) Mutex_Destroy(storage->lock);
+        free(storage);
+        return NULL;
+    }
+
+    return storage;
+}
+
+void WorldStorage_Destroy(WorldStorage* storage) {
+    if (!storage) return;
+
+    Mutex_Lock(storage->lock);
+    storage->quit = true;
+    CondVar_Broadcast(storage->wake);
+    Mutex_Unlock(storage->lock);
+    Thread_Join(storage->thread);
+
+    while (storage->pendingHead) {
+        PendingSave* next = storage->pendingHead->next;
+        free(storage->pendingHead->blob);
+        free(storage->pendingHead);
+        storage->pendingHead = next;
+    }
+    for (int32_t i = 0; i < STORAGE_MAX_REGIONS; i++) {
+        RegionData_Clear(&storage->regions[i].data);
+    }
+
+    Chunk_Destroy(storage->decodeScratch);
+    Chunk_Destroy(storage->ioDecoded);
+    Chunk_Destroy(storage->ioReference);
+    CondVar_Destroy(storage->wake);
+    Mutex_Destroy(storage->lock);
+    free(storage);
+}
+
+void WorldStorage_PrefetchRegion(WorldStorage* storage, int32_t regionX, int32_t regionZ) {
+    if (!storage) return;
+
+    Mutex_Lock(storage->lock);
+    int32_t index = FindRegion(storage, regionX, regionZ);
+    if (index >= 0) {
+        storage->regions[index].lastUse = ++storage->useClock;
+    } else {
+        QueuePrefetch(storage, regionX, regionZ);
+    }
+    Mutex_Unlock(storage->lock);
+}
+
+void WorldStorage_SaveChunk(WorldStorage* storage, int32_t chunkX, int32_t chunkZ, uint8_t* blob, uint32_t size) {
+    if (!storage || !blob || size == 0) {
+        free(blob);
+        return;
+    }
+
+    PendingSave* save = (PendingSave*)malloc(sizeof(PendingSave));
+    if (!save) {
+        free(blob);
+        return;
+    }
+    save->chunkX = chunkX;
+    save->chunkZ = chunkZ;
+    save->blob = blob;
+    save->size = size;
+    save->next = NULL;
+
+    Mutex_Lock(storage->lock);
+    if (storage->pendingTail) storage->pendingTail->next = save;
+    else storage->pendingHead = save;
+    storage->pendingTail = save;
+    storage->pendingCount++;
+    CondVar_Signal(storage->wake);
+    Mutex_Unlock(storage->lock);
+}
+
+StorageChunkStatus WorldStorage_LoadChunk(WorldStorage* storage, Chunk* chunk) {
+    if (!storage || !chunk) return STORAGE_CHUNK_PRISTINE;
+
+    int32_t chunkX = chunk->chunkX;
+    int32_t chunkZ = chunk->chunkZ;
+    const uint8_t* blob = NULL;
+    uint32_t size = 0;
+    StorageChunkStatus status = STORAGE_CHUNK_PRISTINE;
+
+    Mutex_Lock(storage->lock);
+
+    /* 1) Save ainda na fila (o mais novo vence) */
+    for (PendingSave* save = storage->pendingHead; save; save = save->next) {
+        if (save->chunkX == chunkX && save->chunkZ == chunkZ) {
+            blob = save->blob;
+            size = save->size;
+        }
+    }
+
+    /* 2) Região em memória */
+    if (!blob) {
+        int32_t regionX = Region_FromChunk(chunkX);
+        int32_t regionZ = Region_FromChunk(chunkZ);
+        int32_t index = FindRegion(storage, regionX, regionZ);
+        if (index >= 0 && storage->regions[index].state == REGION_SLOT_RESIDENT) {
+            RegionSlot* slot = &storage->regions[index];
+            int32_t chunkSlot = Region_SlotIndex(chunkX, chunkZ);
+            slot->lastUse = ++storage->useClock;
+            blob = slot->data.blobs[chunkSlot];
+            size = slot->data.sizes[chunkSlot];
+        } else {
+            if (index < 0) QueuePrefetch(storage, regionX, regionZ);
+            status = STORAGE_CHUNK_PENDING;
+        }
+    }
+
+    if (blob) {
+        /* Decodifica no rascunho: um blob ruim não estraga o chunk do chamador */
+        if (DecodeBlob(storage->decodeScratch, blob, size, chunkX, chunkZ)) {
+            Chunk_CopyBlocks(chunk, storage->decodeScratch); /* compartilha as seções */
+            status = STORAGE_CHUNK_EDITED;
+        } else {
+            status = STORAGE_CHUNK_PRISTINE;
+        }
+    }
+
+    Mutex_Unlock(storage->lock);
+    return status;
+}
+
+bool WorldStorage_PollRegionsLoaded(WorldStorage* storage) {
+    if (!storage) return false;
+
+    Mutex_Lock(storage->lock);
+    bool loaded = storage->regionsLoaded;
+    storage->regionsLoaded = false;
+    Mutex_Unlock(storage->lock);
+    return loaded;
+}
+
+void WorldStorage_GetStats(WorldStorage* storage, WorldStorageStats* outStats) {
+    if (!outStats) return;
+    memset(outStats, 0, sizeof(WorldStorageStats));
+    if (!storage) return;
+
+    Mutex_Lock(storage->lock);
+    *outStats = storage->stats;
+    outStats->pendingSaves = storage->pendingCount;
+    for (int32_t i = 0; i < STORAGE_MAX_REGIONS; i++) {
+        if (storage->regions[i].state == REGION_SLOT_RESIDENT) outStats->residentRegions++;
+    }
+    Mutex_Unlock(storage->lock);
+}
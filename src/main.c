@@ -4,9 +4,28 @@
 #include "core/time.h"
 #include "app/settings/settings.h"
 #include "app/scenes/scene_manager.h"
+#include "core/world/seed_bake.h"
+#include "core/world/world_seed.h"
 #include <stdio.h>
+#include <string.h>
 
-int main(void) {
+// Modo bake (hosts dedicados): game --bake [seed] gera a pista inteira em bakes/ e sai
+static int BakeSeed(const char* seedString) {
+    uint64_t seed = WorldSeed_StringToU64(seedString);
+    size_t fileSize = 0;
+    if (!SeedBake_Build("bakes", seed, &fileSize)) {
+        fprintf(stderr, "Erro ao gerar bake da seed '%s'\n", seedString);
+        return 1;
+    }
+    printf("Bake da seed '%s' (%016llx): %lu bytes em bakes/\n", seedString, (unsigned long long)seed, (unsigned long)fileSize);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "--bake") == 0) {
+        return BakeSeed(argc > 2 ? argv[2] : "beware-the-dust");
+    }
+    
     const int screenWidth = 1920;
     const int screenHeight = 1080;
     
@@ -31,13 +50,14 @@ int main(void) {
         // Calcula dt
         float dt = Time_GetDeltaTime();
         
-        // Atualiza Core (lógica do jogo) - Net_Poll é chamado dentro de Core_Tick
+        // Atualiza Core (lógica do jogo) - Net_Poll é chamado dentro de Core_Tick,
+        // ou na thread de simulação enquanto a gameplay roda (Core_SimStep)
         Core_Tick(dt);
         
-        // Atualiza Scene (UI + input)
+        // Atualiza Scene (UI + input; na gameplay só amostra input para a simulação)
         SceneManager_Update(dt);
         
-        // Renderiza
+        // Renderiza (na gameplay: interpola os dois últimos snapshots da simulação)
         SceneManager_Draw();
     }
     